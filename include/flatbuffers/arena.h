@@ -0,0 +1,206 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_ARENA_H_
+#define FLATBUFFERS_ARENA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// clang-format off
+#if defined(_MSC_VER) && (_MSC_VER < 1900)
+  #define FLATBUFFERS_THREAD_LOCAL __declspec(thread)
+#else
+  #define FLATBUFFERS_THREAD_LOCAL thread_local
+#endif
+// clang-format on
+
+namespace flatbuffers {
+
+/// @brief A region allocator for object API types generated with
+/// `--cpp-arena`. While an `ArenaScope` is active on a thread, the
+/// `operator new` of those types and the `arena_allocator` of their vectors
+/// and strings take memory from a few large blocks owned by the arena,
+/// instead of going to the heap for every sub-object. Deleting such an object
+/// runs its destructor but frees nothing: the memory is returned all at once
+/// by `Reset()` or the destructor of the arena, so objects unpacked into an
+/// arena must be destroyed before that. Outside of a scope, the same types
+/// allocate from the heap as usual.
+class Arena {
+ public:
+  // Alignment of all allocations, enough for any force_align a schema may
+  // use. This is also the size of the header in front of each object, which
+  // records the arena it came from, or null and the heap allocation holding
+  // the object.
+  static const size_t kAlignment = FLATBUFFERS_MAX_ALIGNMENT;
+
+  explicit Arena(size_t initial_block_size = 4096)
+      : blocks_(nullptr),
+        cur_(nullptr),
+        end_(nullptr),
+        next_block_size_(initial_block_size),
+        num_blocks_(0),
+        size_(0) {}
+
+  ~Arena() { Reset(); }
+
+  // Returns `size` bytes of memory that stay valid until `Reset()`.
+  void *Allocate(size_t size) {
+    size = (size + kAlignment - 1) & ~(kAlignment - 1);
+    if (static_cast<size_t>(end_ - cur_) < size) NewBlock(size);
+    auto p = cur_;
+    cur_ += size;
+    size_ += size;
+    return p;
+  }
+
+  // Frees all blocks.
+  void Reset() {
+    while (blocks_) {
+      auto next = blocks_->next;
+      ::operator delete(blocks_);
+      blocks_ = next;
+    }
+    cur_ = end_ = nullptr;
+    num_blocks_ = 0;
+    size_ = 0;
+  }
+
+  // The number of blocks allocated from the heap, and the bytes handed out.
+  size_t num_blocks() const { return num_blocks_; }
+  size_t size() const { return size_; }
+
+  // The arena of the innermost `ArenaScope` on this thread, or null.
+  static Arena *Current() { return CurrentRef(); }
+
+  // Object memory, from the current arena if any, and from the heap
+  // otherwise. These implement the generated `operator new` / `delete`.
+  static void *AllocateObject(size_t size) {
+    auto arena = Current();
+    if (arena) {
+      auto p = static_cast<uint8_t *>(arena->Allocate(kAlignment + size));
+      reinterpret_cast<Header *>(p)->arena = arena;
+      return p + kAlignment;
+    }
+    // The heap may align to less than kAlignment, so leave room to align.
+    auto heap = ::operator new(2 * kAlignment - 1 + size);
+    auto p = AlignUp(static_cast<uint8_t *>(heap) + kAlignment);
+    auto header = reinterpret_cast<Header *>(p - kAlignment);
+    header->arena = nullptr;
+    header->heap = heap;
+    return p;
+  }
+
+  static void DeallocateObject(void *p) {
+    if (!p) return;
+    auto header =
+        reinterpret_cast<Header *>(static_cast<uint8_t *>(p) - kAlignment);
+    if (!header->arena) ::operator delete(header->heap);
+  }
+
+  // These may change access mode, leave these at end of public section
+  FLATBUFFERS_DELETE_FUNC(Arena(const Arena &other));
+  FLATBUFFERS_DELETE_FUNC(Arena &operator=(const Arena &other));
+
+ private:
+  friend class ArenaScope;
+
+  struct Block {
+    Block *next;
+  };
+
+  struct Header {
+    Arena *arena;
+    void *heap;
+  };
+  static_assert(sizeof(Header) <= kAlignment && sizeof(Block) <= kAlignment,
+                "Arena headers must fit in kAlignment");
+
+  static uint8_t *AlignUp(uint8_t *p) {
+    auto addr = reinterpret_cast<uintptr_t>(p);
+    return p + (((addr + kAlignment - 1) & ~(kAlignment - 1)) - addr);
+  }
+
+  void NewBlock(size_t size) {
+    auto block_size = (std::max)(next_block_size_, size);
+    auto block =
+        static_cast<Block *>(::operator new(2 * kAlignment + block_size));
+    block->next = blocks_;
+    blocks_ = block;
+    cur_ = AlignUp(reinterpret_cast<uint8_t *>(block) + sizeof(Block));
+    end_ = cur_ + block_size;
+    next_block_size_ = block_size * 2;
+    num_blocks_++;
+  }
+
+  static Arena *&CurrentRef() {
+    static FLATBUFFERS_THREAD_LOCAL Arena *current = nullptr;
+    return current;
+  }
+
+  Block *blocks_;
+  uint8_t *cur_;
+  uint8_t *end_;
+  size_t next_block_size_;
+  size_t num_blocks_;
+  size_t size_;
+};
+
+// Makes an arena the current one of this thread for its lifetime.
+class ArenaScope {
+ public:
+  explicit ArenaScope(Arena &arena) : previous_(Arena::CurrentRef()) {
+    Arena::CurrentRef() = &arena;
+  }
+
+  ~ArenaScope() { Arena::CurrentRef() = previous_; }
+
+ private:
+  Arena *previous_;
+};
+
+// A std allocator on top of `Arena::AllocateObject`, used for the vectors
+// and strings of types generated with `--cpp-arena`. It is stateless, since
+// each allocation records where it came from.
+template<typename T> class arena_allocator {
+ public:
+  typedef T value_type;
+  typedef T *pointer;
+  typedef const T *const_pointer;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  template<typename U> struct rebind { typedef arena_allocator<U> other; };
+
+  arena_allocator() {}
+  template<typename U> arena_allocator(const arena_allocator<U> &) {}
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(Arena::AllocateObject(n * sizeof(T)));
+  }
+
+  void deallocate(T *p, size_t) { Arena::DeallocateObject(p); }
+
+  bool operator==(const arena_allocator &) const { return true; }
+  bool operator!=(const arena_allocator &) const { return false; }
+};
+
+typedef std::basic_string<char, std::char_traits<char>, arena_allocator<char>>
+    arena_string;
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_ARENA_H_
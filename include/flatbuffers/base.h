@@ -192,6 +192,13 @@ namespace flatbuffers {
   #define FLATBUFFERS_NOEXCEPT
 #endif
 
+// Hint that memory at an address is about to be read.
+#if defined(__GNUC__) || defined(__clang__)
+  #define FLATBUFFERS_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+  #define FLATBUFFERS_PREFETCH(addr) ((void)(addr))
+#endif
+
 // NOTE: the FLATBUFFERS_DELETE_FUNC macro may change the access mode to
 // private, so be sure to put it at the end or reset access mode explicitly.
 #if (!defined(_MSC_VER) || _MSC_FULL_VER >= 180020827) && \
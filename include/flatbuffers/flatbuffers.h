@@ -425,6 +425,30 @@ template<typename T> static inline size_t VectorLength(const Vector<T> *v) {
   return v ? v->size() : 0;
 }
 
+// Copies a vector of scalars or enums to `dst`, which must have room for
+// `v.size()` elements of type U, the same size as T. On little-endian hosts
+// this is a single memcpy rather than an EndianScalar per element.
+template<typename T, typename U> void CopyVectorTo(const Vector<T> &v, U *dst) {
+  static_assert(sizeof(T) == sizeof(U), "invalid element type U");
+  // clang-format off
+  #if FLATBUFFERS_LITTLEENDIAN
+    if (v.size()) memcpy(dst, v.Data(), v.size() * sizeof(T));
+  #else
+    for (uoffset_t i = 0; i < v.size(); i++) dst[i] = static_cast<U>(v.Get(i));
+  #endif
+  // clang-format on
+}
+
+// Copies a vector of structs to `dst`. Structs are kept in wire format in
+// memory, so this is a single memcpy on any host.
+template<typename T, typename U>
+void CopyVectorTo(const Vector<const T *> &v, U *dst) {
+  static_assert(sizeof(T) == sizeof(U), "invalid element type U");
+  if (v.size()) {
+    memcpy(static_cast<void *>(dst), v.Data(), v.size() * sizeof(T));
+  }
+}
+
 // This is used as a helper type for accessing arrays.
 template<typename T, uint16_t length> class Array {
   typedef
@@ -650,6 +674,209 @@ static inline flatbuffers::string_view GetStringView(const String *str) {
 }
 #endif  // FLATBUFFERS_HAS_STRING_VIEW
 
+// Hashes of the key fields of tables and structs, as returned by their
+// generated `KeyHash()`, and of the values they are looked up with.
+inline uint64_t HashKeyMix(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  return h ^ (h >> 33);
+}
+
+template<typename T> inline uint64_t HashKey(T key) {
+  return HashKeyMix(static_cast<uint64_t>(key));
+}
+
+inline uint64_t HashKey(double key) {
+  key += 0.0;  // Hash -0.0 as 0.0, since they compare equal.
+  uint64_t bits;
+  memcpy(&bits, &key, sizeof(bits));
+  return HashKeyMix(bits);
+}
+
+inline uint64_t HashKey(float key) { return HashKey(static_cast<double>(key)); }
+
+// String keys are compared with strcmp, so only hash up to the first 0.
+inline uint64_t HashKey(const char *key) {
+  uint64_t h = 0xcbf29ce484222645ULL;  // FNV-1a.
+  for (; *key; ++key) {
+    h ^= static_cast<unsigned char>(*key);
+    h *= 0x00000100000001b3ULL;
+  }
+  return HashKeyMix(h);
+}
+
+inline uint64_t HashKey(const String *key) { return HashKey(key->c_str()); }
+
+// Structural hashes of whole tables and structs, as generated by --gen-hash.
+// They depend on the field values only, not on how they are laid out in the
+// buffer, and absent strings and vectors hash as empty ones, so an object
+// API type hashes the same as the table it was unpacked from.
+
+// The hash of an absent table, struct or optional scalar.
+const uint64_t kHashAbsent = 0x9ae16a3b2f90404fULL;
+
+inline uint64_t HashCombine(uint64_t seed, uint64_t value) {
+  return HashKeyMix(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) +
+                            (seed >> 2)));
+}
+
+// Hashes 32 bytes per iteration in 4 independent lanes, which keeps the
+// multiplies of a long vector in flight in parallel.
+inline uint64_t HashBytes(const void *data, size_t size) {
+  const uint64_t k = 0x9ddfea08eb382d69ULL;
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(data);
+  uint64_t h = HashKeyMix(size);
+  size_t i = 0;
+  if (size >= 32) {
+    uint64_t lanes[4] = { h, h + k, h - k, ~h };
+    for (; i + 32 <= size; i += 32) {
+      for (size_t l = 0; l < 4; l++) {
+        uint64_t w;
+        memcpy(&w, p + i + l * 8, sizeof(w));
+        lanes[l] = (lanes[l] ^ w) * k;
+        lanes[l] ^= lanes[l] >> 47;
+      }
+    }
+    h = HashCombine(HashCombine(lanes[0], lanes[1]),
+                    HashCombine(lanes[2], lanes[3]));
+  }
+  for (; i < size; i += 8) {
+    uint64_t w = 0;
+    memcpy(&w, p + i, (std::min)(size - i, sizeof(w)));
+    h = (h ^ w) * k;
+    h ^= h >> 47;
+  }
+  return HashKeyMix(h);
+}
+
+// Integers and enums are equal exactly when their bytes are, so they are
+// hashed in bulk. Floats are not (-0.0 == 0.0), so they are hashed one by
+// one.
+template<typename T>
+uint64_t HashScalars(const T *data, size_t count, std::false_type) {
+  return HashBytes(data, count * sizeof(T));
+}
+
+template<typename T>
+uint64_t HashScalars(const T *data, size_t count, std::true_type) {
+  uint64_t h = HashKey(count);
+  for (size_t i = 0; i < count; i++) h = HashCombine(h, HashKey(data[i]));
+  return h;
+}
+
+template<typename T> uint64_t HashScalars(const T *data, size_t count) {
+  return HashScalars(data, count, std::is_floating_point<T>());
+}
+
+template<typename T> uint64_t HashScalars(const Vector<T> *v) {
+  if (!v) return HashScalars(static_cast<const T *>(nullptr), 0);
+#if FLATBUFFERS_LITTLEENDIAN
+  return HashScalars(v->data(), v->size());
+#else
+  std::vector<T> elems(v->begin(), v->end());
+  return HashScalars(elems.data(), elems.size());
+#endif
+}
+
+template<typename T, typename Alloc>
+uint64_t HashScalars(const std::vector<T, Alloc> &v) {
+  return HashScalars(v.data(), v.size());
+}
+
+// Bools are stored as bytes in a buffer, so hash them the same way.
+template<typename Alloc>
+uint64_t HashScalars(const std::vector<bool, Alloc> &v) {
+  std::vector<uint8_t> bytes(v.begin(), v.end());
+  return HashScalars(bytes.data(), bytes.size());
+}
+
+inline uint64_t HashString(const String *s) {
+  return s ? HashBytes(s->data(), s->size()) : HashBytes(nullptr, 0);
+}
+
+template<typename S> uint64_t HashString(const S &s) {
+  return HashBytes(s.data(), s.size());
+}
+
+template<typename T> uint64_t HashOptional(const Optional<T> &v) {
+  return v.has_value() ? HashKey(*v) : kHashAbsent;
+}
+
+/// @brief A hash index over a vector of tables or structs with a key field,
+/// as an alternative to `Vector::LookupByKey` when many lookups are done in
+/// the same vector. Building it costs a pass over the vector, but then a
+/// lookup typically compares just one element to the key, where the binary
+/// search of `LookupByKey` visits log2(size) elements. The vector does not
+/// need to be sorted, and must outlive the index. With duplicate keys, the
+/// element found is the first of them.
+template<typename T> class KeyIndex {
+ public:
+  typedef typename Vector<T>::return_type return_type;
+  typedef typename std::remove_cv<
+      typename std::remove_pointer<return_type>::type>::type element_type;
+
+  explicit KeyIndex(const Vector<T> *vec) : vector_(vec), mask_(0) {
+    if (!vec || !vec->size()) return;
+    size_t num_slots = 2;
+    while (num_slots < 2 * static_cast<size_t>(vec->size())) num_slots *= 2;
+    slots_.resize(num_slots);
+    mask_ = num_slots - 1;
+    for (uoffset_t i = 0; i < vec->size(); i++) {
+      auto hash = vec->Get(i)->KeyHash();
+      auto slot = static_cast<size_t>(hash) & mask_;
+      while (slots_[slot].index) slot = (slot + 1) & mask_;
+      slots_[slot].tag = static_cast<uint32_t>(hash >> 32);
+      slots_[slot].index = i + 1;
+    }
+  }
+
+  // Keys are converted to the parameter type of `KeyCompareWithValue`,
+  // the type of the key field, as `Vector::LookupByKey` does, so that they
+  // hash like the `KeyHash()` of the element they compare equal to.
+  template<typename K> return_type LookupByKey(K key) const {
+    typedef typename KeyArg<decltype(
+        &element_type::KeyCompareWithValue)>::type key_type;
+    return Find(static_cast<key_type>(key));
+  }
+
+  size_t size() const { return vector_ ? vector_->size() : 0; }
+
+ private:
+  template<typename F> struct KeyArg;
+  template<typename E, typename A> struct KeyArg<int (E::*)(A) const> {
+    typedef A type;
+  };
+
+  template<typename K> return_type Find(K key) const {
+    if (slots_.empty()) return nullptr;
+    auto hash = HashKey(key);
+    auto tag = static_cast<uint32_t>(hash >> 32);
+    for (auto slot = static_cast<size_t>(hash) & mask_;;
+         slot = (slot + 1) & mask_) {
+      const Slot &s = slots_[slot];
+      if (!s.index) return nullptr;  // Key not found.
+      if (s.tag != tag) continue;
+      auto element = vector_->Get(s.index - 1);
+      if (element->KeyCompareWithValue(key) == 0) return element;
+    }
+  }
+
+  // An empty slot has index 0, others the element index + 1, next to the
+  // upper bits of its hash that rule out most other elements without
+  // touching them.
+  struct Slot {
+    Slot() : tag(0), index(0) {}
+    uint32_t tag;
+    uoffset_t index;
+  };
+
+  const Vector<T> *vector_;
+  std::vector<Slot> slots_;
+  size_t mask_;
+};
+
 // Allocator interface. This is flatbuffers-specific and meant only for
 // `vector_downward` usage.
 class Allocator {
@@ -1154,6 +1381,8 @@ class FlatBufferBuilder {
         minalign_(1),
         force_defaults_(false),
         dedup_vtables_(true),
+        static_vtable_(nullptr),
+        static_vtable_offset_(0),
         string_pool(nullptr) {
     EndianCheck();
   }
@@ -1173,6 +1402,8 @@ class FlatBufferBuilder {
       minalign_(1),
       force_defaults_(false),
       dedup_vtables_(true),
+      static_vtable_(nullptr),
+      static_vtable_offset_(0),
       string_pool(nullptr) {
     EndianCheck();
     // Default construct and swap idiom.
@@ -1205,6 +1436,8 @@ class FlatBufferBuilder {
     swap(minalign_, other.minalign_);
     swap(force_defaults_, other.force_defaults_);
     swap(dedup_vtables_, other.dedup_vtables_);
+    swap(static_vtable_, other.static_vtable_);
+    swap(static_vtable_offset_, other.static_vtable_offset_);
     swap(string_pool, other.string_pool);
   }
 
@@ -1225,6 +1458,7 @@ class FlatBufferBuilder {
     nested = false;
     finished = false;
     minalign_ = 1;
+    static_vtable_ = nullptr;
     if (string_pool) string_pool->clear();
   }
 
@@ -1259,6 +1493,7 @@ class FlatBufferBuilder {
   FLATBUFFERS_ATTRIBUTE(deprecated("use Release() instead"))
   DetachedBuffer ReleaseBufferPointer() {
     Finished();
+    static_vtable_ = nullptr;
     return buf_.release();
   }
 
@@ -1266,6 +1501,7 @@ class FlatBufferBuilder {
   /// @return A `DetachedBuffer` that owns the buffer and its allocator.
   DetachedBuffer Release() {
     Finished();
+    static_vtable_ = nullptr;
     return buf_.release();
   }
 
@@ -1280,6 +1516,7 @@ class FlatBufferBuilder {
   /// called..
   uint8_t *ReleaseRaw(size_t &size, size_t &offset) {
     Finished();
+    static_vtable_ = nullptr;
     return buf_.release_raw(size, offset);
   }
 
@@ -1502,6 +1739,76 @@ class FlatBufferBuilder {
   // just been constructed.
   template<typename T> void Required(Offset<T> table, voffset_t field);
 
+  // The static layout creators generated with `--gen-static-layout` write
+  // a table without StartTable/AddElement/EndTable: StartStaticTable
+  // reserves its zeroed body, which has a layout computed by flatc, the
+  // SetStatic* functions store each field at its place in the body, and
+  // EndStaticTable points it to the precomputed vtable of that layout.
+  uoffset_t StartStaticTable(size_t size, size_t alignment) {
+    NotNested();
+    FLATBUFFERS_ASSERT(size % alignment == 0);
+    Align(alignment);
+    buf_.fill_big(size);
+    return GetSize();
+  }
+
+  template<typename T>
+  void SetStaticField(uoffset_t table, voffset_t field_offset, T value) {
+    WriteScalar(buf_.data_at(table) + field_offset, value);
+  }
+
+  template<typename T>
+  void SetStaticStruct(uoffset_t table, voffset_t field_offset,
+                       const T *value) {
+    // The layout has every field present.
+    FLATBUFFERS_ASSERT(value);
+    memcpy(buf_.data_at(table) + field_offset, value, sizeof(T));
+  }
+
+  template<typename T>
+  void SetStaticOffset(uoffset_t table, voffset_t field_offset,
+                       Offset<T> value) {
+    FLATBUFFERS_ASSERT(value.o && value.o < table - field_offset);
+    WriteScalar<uoffset_t>(buf_.data_at(table) + field_offset,
+                           table - field_offset - value.o);
+  }
+
+  // |vtable| must stay valid for the lifetime of the builder, since it is
+  // remembered to find where it was written in the buffer the next time.
+  uoffset_t EndStaticTable(uoffset_t table, const voffset_t *vtable) {
+    FLATBUFFERS_ASSERT(table == GetSize());
+    uoffset_t vt_use = 0;
+    if (vtable == static_vtable_ && dedup_vtables_) {
+      vt_use = static_vtable_offset_;
+    } else {
+      const auto vt_len = vtable[0] / sizeof(voffset_t);
+      if (dedup_vtables_) {
+        for (auto it = buf_.scratch_data(); it < buf_.scratch_end();
+             it += sizeof(uoffset_t)) {
+          auto vt_offset = *reinterpret_cast<uoffset_t *>(it);
+          auto vt = reinterpret_cast<voffset_t *>(buf_.data_at(vt_offset));
+          size_t i = 0;
+          while (i < vt_len && ReadScalar<voffset_t>(vt + i) == vtable[i]) i++;
+          if (i == vt_len) {
+            vt_use = vt_offset;
+            break;
+          }
+        }
+      }
+      if (!vt_use) {
+        auto vt = reinterpret_cast<voffset_t *>(buf_.make_space(vtable[0]));
+        for (size_t i = 0; i < vt_len; i++) WriteScalar(vt + i, vtable[i]);
+        vt_use = GetSize();
+        buf_.scratch_push_small(vt_use);
+      }
+      static_vtable_ = vtable;
+      static_vtable_offset_ = vt_use;
+    }
+    WriteScalar(buf_.data_at(table),
+                static_cast<soffset_t>(vt_use) - static_cast<soffset_t>(table));
+    return table;
+  }
+
   uoffset_t StartStruct(size_t alignment) {
     Align(alignment);
     return GetSize();
@@ -1724,7 +2031,8 @@ class FlatBufferBuilder {
   /// buffer as a `vector`.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
-  template<typename T> Offset<Vector<T>> CreateVector(const std::vector<T> &v) {
+  template<typename T, typename Alloc>
+  Offset<Vector<T>> CreateVector(const std::vector<T, Alloc> &v) {
     return CreateVector(data(v), v.size());
   }
 
@@ -1932,7 +2240,7 @@ class FlatBufferBuilder {
   /// where the vector is stored.
   template<typename T>
   Offset<Vector<const T *>> CreateVectorOfSortedStructs(T *v, size_t len) {
-    std::sort(v, v + len, StructKeyComparator<T>());
+    SortStructs(v, len, typename HasKeySortValue<T>::type());
     return CreateVectorOfStructs(v, len);
   }
 
@@ -1970,6 +2278,146 @@ class FlatBufferBuilder {
     FLATBUFFERS_DELETE_FUNC(
         TableKeyComparator &operator=(const TableKeyComparator &other));
   };
+
+  // The key of a table read once before sorting, next to its offset, so
+  // that the sort itself does not have to go through the buffer.
+  template<typename K> struct KeyedOffset {
+    K key;
+    uoffset_t o;
+  };
+
+  // Maps an integral key to an unsigned one of the same size and order.
+  template<typename K> static uint64_t RadixKey(K key) {
+    auto bits = static_cast<uint64_t>(key);
+    if (!flatbuffers::is_unsigned<K>::value) {
+      bits ^= uint64_t(1) << (sizeof(K) * 8 - 1);
+    }
+    return bits & (~uint64_t(0) >> (64 - sizeof(K) * 8));
+  }
+
+  template<typename K> struct KeyedOffsetRadixKey {
+    uint64_t operator()(const KeyedOffset<K> &e) const {
+      return RadixKey(e.key);
+    }
+  };
+
+  template<typename K> struct KeyedOffsetLessThan {
+    bool operator()(const KeyedOffset<K> &a, const KeyedOffset<K> &b) const {
+      return a.key < b.key;
+    }
+  };
+
+  struct StringKeyedOffsetLessThan {
+    bool operator()(const KeyedOffset<const String *> &a,
+                    const KeyedOffset<const String *> &b) const {
+      return *a.key < *b.key;
+    }
+  };
+
+  template<typename T, typename K> struct StructRadixKey {
+    uint64_t operator()(const T &e) const {
+      return RadixKey<K>(e.KeySortValue());
+    }
+  };
+
+  // Sorts |v| stably by |key|, with one counting pass per byte of the keys
+  // that is not the same in all of them. Below a few dozen elements, this
+  // costs more than a comparison sort.
+  static const size_t kMinRadixSortLength = 64;
+
+  template<typename E, typename KeyFn>
+  static void RadixSort(E *v, size_t len, size_t key_size, KeyFn key) {
+    std::vector<E> tmp(len);
+    E *src = v;
+    E *dst = data(tmp);
+    for (size_t shift = 0; shift < key_size * 8; shift += 8) {
+      size_t counts[256] = { 0 };
+      for (size_t i = 0; i < len; i++) {
+        counts[(key(src[i]) >> shift) & 0xFF]++;
+      }
+      if (counts[(key(src[0]) >> shift) & 0xFF] == len) continue;
+      size_t pos = 0;
+      for (size_t d = 0; d < 256; d++) {
+        auto count = counts[d];
+        counts[d] = pos;
+        pos += count;
+      }
+      for (size_t i = 0; i < len; i++) {
+        dst[counts[(key(src[i]) >> shift) & 0xFF]++] = src[i];
+      }
+      std::swap(src, dst);
+    }
+    if (src != v) std::copy(src, src + len, v);
+  }
+
+  template<typename K>
+  static void SortKeyedOffsets(KeyedOffset<K> *v, size_t len) {
+    if (len >= kMinRadixSortLength &&
+        !flatbuffers::is_floating_point<K>::value) {
+      RadixSort(v, len, sizeof(K), KeyedOffsetRadixKey<K>());
+    } else {
+      std::sort(v, v + len, KeyedOffsetLessThan<K>());
+    }
+  }
+
+  static void SortKeyedOffsets(KeyedOffset<const String *> *v, size_t len) {
+    std::sort(v, v + len, StringKeyedOffsetLessThan());
+  }
+
+  template<typename T, typename K>
+  void SortTablesByKey(Offset<T> *v, size_t len, K (T::*key)() const) {
+    std::vector<KeyedOffset<K>> keyed(len);
+    for (size_t i = 0; i < len; i++) {
+      keyed[i].key = (reinterpret_cast<T *>(buf_.data_at(v[i].o))->*key)();
+      keyed[i].o = v[i].o;
+    }
+    SortKeyedOffsets(data(keyed), len);
+    for (size_t i = 0; i < len; i++) v[i].o = keyed[i].o;
+  }
+
+  template<typename T, typename K>
+  static void SortStructsByKey(T *v, size_t len, K (T::*)() const) {
+    if (len >= kMinRadixSortLength &&
+        !flatbuffers::is_floating_point<K>::value) {
+      RadixSort(v, len, sizeof(K), StructRadixKey<T, K>());
+    } else {
+      std::sort(v, v + len, StructKeyComparator<T>());
+    }
+  }
+
+  // Whether T has a generated KeySortValue(). Code generated before it was
+  // added is still sorted, by comparing the elements.
+  template<typename T> struct HasKeySortValue {
+    template<typename U>
+    static char Test(decltype(&U::KeySortValue));
+    template<typename U> static int Test(...);
+    static const bool value = sizeof(Test<T>(nullptr)) == sizeof(char);
+    typedef flatbuffers::integral_constant<bool, value> type;
+  };
+
+  template<typename T>
+  static void SortStructs(T *v, size_t len,
+                          flatbuffers::integral_constant<bool, true>) {
+    SortStructsByKey(v, len, &T::KeySortValue);
+  }
+
+  template<typename T>
+  static void SortStructs(T *v, size_t len,
+                          flatbuffers::integral_constant<bool, false>) {
+    std::sort(v, v + len, StructKeyComparator<T>());
+  }
+
+  template<typename T>
+  void SortTables(Offset<T> *v, size_t len,
+                  flatbuffers::integral_constant<bool, true>) {
+    SortTablesByKey(v, len, &T::KeySortValue);
+  }
+
+  template<typename T>
+  void SortTables(Offset<T> *v, size_t len,
+                  flatbuffers::integral_constant<bool, false>) {
+    std::sort(v, v + len, TableKeyComparator<T>(buf_));
+  }
   /// @endcond
 
   /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
@@ -1983,7 +2431,7 @@ class FlatBufferBuilder {
   template<typename T>
   Offset<Vector<Offset<T>>> CreateVectorOfSortedTables(Offset<T> *v,
                                                        size_t len) {
-    std::sort(v, v + len, TableKeyComparator<T>(buf_));
+    SortTables(v, len, typename HasKeySortValue<T>::type());
     return CreateVector(v, len);
   }
 
@@ -2048,6 +2496,17 @@ class FlatBufferBuilder {
     AssertScalarT<T>();
     AssertScalarT<U>();
     StartVector(len, sizeof(T));
+    // clang-format off
+    #if FLATBUFFERS_LITTLEENDIAN
+      // Integers and enums of the same size are stored the same way.
+      if (len && sizeof(T) == sizeof(U) &&
+          !flatbuffers::is_floating_point<T>::value &&
+          !flatbuffers::is_floating_point<U>::value) {
+        PushBytes(reinterpret_cast<const uint8_t *>(v), len * sizeof(T));
+        return Offset<Vector<T>>(EndVector(len));
+      }
+    #endif
+    // clang-format on
     for (auto i = len; i > 0;) { PushElement(static_cast<T>(v[--i])); }
     return Offset<Vector<T>>(EndVector(len));
   }
@@ -2096,6 +2555,7 @@ class FlatBufferBuilder {
   void Finish(uoffset_t root, const char *file_identifier, bool size_prefix) {
     NotNested();
     buf_.clear_scratch();
+    static_vtable_ = nullptr;
     // This will cause the whole buffer to be aligned.
     PreAlign((size_prefix ? sizeof(uoffset_t) : 0) + sizeof(uoffset_t) +
                  (file_identifier ? kFileIdentifierLength : 0),
@@ -2136,6 +2596,10 @@ class FlatBufferBuilder {
 
   bool dedup_vtables_;
 
+  // The vtable last written by EndStaticTable, and where.
+  const voffset_t *static_vtable_;
+  uoffset_t static_vtable_offset_;
+
   struct StringOffsetCompare {
     StringOffsetCompare(const vector_downward &buf) : buf_(&buf) {}
     bool operator()(const Offset<String> &a, const Offset<String> &b) const {
@@ -2721,6 +3185,41 @@ typedef uint64_t hash_value_t;
 #endif
 // clang-format on
 
+/// @brief A set of fields of a table, given by the field enums of the
+/// generated code (e.g. `Monster::VT_NAME`). It selects the fields unpacked
+/// by the partial `UnPackTo` generated with `--gen-partial-unpack`.
+class FieldSet {
+ public:
+  FieldSet() {}
+
+  FieldSet &Add(voffset_t field) {
+    auto id = OffsetToId(field);
+    if (id / 64 >= bits_.size()) bits_.resize(id / 64 + 1, 0);
+    bits_[id / 64] |= uint64_t(1) << (id % 64);
+    return *this;
+  }
+
+  FieldSet &Remove(voffset_t field) {
+    auto id = OffsetToId(field);
+    if (id / 64 < bits_.size()) bits_[id / 64] &= ~(uint64_t(1) << (id % 64));
+    return *this;
+  }
+
+  bool Contains(voffset_t field) const {
+    auto id = OffsetToId(field);
+    return id / 64 < bits_.size() && ((bits_[id / 64] >> (id % 64)) & 1);
+  }
+
+ private:
+  static size_t OffsetToId(voffset_t field) {
+    FLATBUFFERS_ASSERT(field >= FieldIndexToOffset(0));
+    return static_cast<size_t>((field - FieldIndexToOffset(0)) /
+                               sizeof(voffset_t));
+  }
+
+  std::vector<uint64_t> bits_;
+};
+
 // Helper function to test if a field is present, using any of the field
 // enums in the generated code.
 // `table` must be a generated table type. Since this is a template parameter,
@@ -2735,6 +3234,164 @@ bool IsFieldPresent(const T *table, typename T::FlatBuffersVTableOffset field) {
       static_cast<voffset_t>(field));
 }
 
+/// @brief An iterator over a vector of tables that prefetches the tables
+/// `distance` elements ahead of it, and the vtables of those half as far,
+/// whose tables have been prefetched by then. This hides the cache misses of
+/// scans that go through every table of a large vector, where the tables are
+/// not laid out in the order of the vector. Dereferencing it yields the
+/// table pointer by value, which makes it an input iterator.
+template<typename T> class PrefetchIterator {
+ public:
+  typedef std::input_iterator_tag iterator_category;
+  typedef const T *value_type;
+  typedef ptrdiff_t difference_type;
+  typedef const T *pointer;
+  typedef const T *reference;
+
+  PrefetchIterator() : vec_(nullptr), i_(0), distance_(0) {}
+
+  PrefetchIterator(const Vector<Offset<T>> *vec, uoffset_t i,
+                   uoffset_t distance)
+      : vec_(vec), i_(i), distance_(distance) {
+    if (!vec_) return;
+    for (uoffset_t j = i_; j < i_ + distance_ && j < vec_->size(); j++) {
+      FLATBUFFERS_PREFETCH(vec_->Get(j));
+    }
+  }
+
+  bool operator==(const PrefetchIterator &other) const {
+    return i_ == other.i_;
+  }
+
+  bool operator!=(const PrefetchIterator &other) const {
+    return i_ != other.i_;
+  }
+
+  const T *operator*() const { return vec_->Get(i_); }
+
+  const T *operator->() const { return vec_->Get(i_); }
+
+  PrefetchIterator &operator++() {
+    ++i_;
+    auto size = vec_->size();
+    if (i_ + distance_ < size) FLATBUFFERS_PREFETCH(vec_->Get(i_ + distance_));
+    if (i_ + distance_ / 2 < size) {
+      auto table =
+          reinterpret_cast<const Table *>(vec_->Get(i_ + distance_ / 2));
+      FLATBUFFERS_PREFETCH(table->GetVTable());
+    }
+    return *this;
+  }
+
+  PrefetchIterator operator++(int) {
+    PrefetchIterator temp(*this);
+    ++*this;
+    return temp;
+  }
+
+ private:
+  const Vector<Offset<T>> *vec_;
+  uoffset_t i_;
+  uoffset_t distance_;
+};
+
+/// @brief A range over a vector of tables with `PrefetchIterator`, for use
+/// in range-based for loops, see `Prefetched()`.
+template<typename T> class PrefetchRange {
+ public:
+  typedef PrefetchIterator<T> iterator;
+  typedef PrefetchIterator<T> const_iterator;
+
+  PrefetchRange(const Vector<Offset<T>> *vec, uoffset_t distance)
+      : vec_(vec), distance_(distance) {}
+
+  iterator begin() const { return iterator(vec_, 0, distance_); }
+  iterator end() const { return iterator(vec_, size(), 0); }
+  uoffset_t size() const { return vec_ ? vec_->size() : 0; }
+
+ private:
+  const Vector<Offset<T>> *vec_;
+  uoffset_t distance_;
+};
+
+/// @brief Iterate over the tables of `vec` (which may be null) with
+/// prefetching, e.g. `for (auto monster : Prefetched(monsters)) ...`.
+template<typename T>
+PrefetchRange<T> Prefetched(const Vector<Offset<T>> *vec,
+                            uoffset_t distance = 16) {
+  return PrefetchRange<T>(vec, distance);
+}
+
+/// @brief A lazy view of the elements of a range for which a predicate holds,
+/// see `Filter()`. The predicate is evaluated while iterating, so nothing is
+/// copied, and filters compose: `Filter(Filter(range, a), b)`. Its input
+/// iterators refer to the predicate held by the range, so they must not
+/// outlive it, e.g. use `auto f = Filter(...); f.begin()` rather than
+/// `Filter(...).begin()`.
+template<typename Range, typename Pred> class FilterRange {
+ public:
+  typedef typename Range::const_iterator base_iterator;
+
+  class iterator {
+   public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef typename std::iterator_traits<base_iterator>::value_type value_type;
+    typedef ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef typename std::iterator_traits<base_iterator>::reference reference;
+
+    iterator(base_iterator it, base_iterator end, const Pred *pred)
+        : it_(it), end_(end), pred_(pred) {
+      SkipRejected();
+    }
+
+    bool operator==(const iterator &other) const { return it_ == other.it_; }
+    bool operator!=(const iterator &other) const { return it_ != other.it_; }
+
+    reference operator*() const { return *it_; }
+
+    iterator &operator++() {
+      ++it_;
+      SkipRejected();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator temp(*this);
+      ++*this;
+      return temp;
+    }
+
+   private:
+    void SkipRejected() {
+      while (it_ != end_ && !(*pred_)(*it_)) ++it_;
+    }
+
+    base_iterator it_;
+    base_iterator end_;
+    const Pred *pred_;
+  };
+  typedef iterator const_iterator;
+
+  FilterRange(const Range &range, Pred pred) : range_(range), pred_(pred) {}
+
+  iterator begin() const {
+    return iterator(range_.begin(), range_.end(), &pred_);
+  }
+  iterator end() const { return iterator(range_.end(), range_.end(), &pred_); }
+
+ private:
+  Range range_;
+  Pred pred_;
+};
+
+/// @brief Iterate over the elements of `range` (e.g. `Prefetched(vec)`, or
+/// another filter) for which `pred` returns true.
+template<typename Range, typename Pred>
+FilterRange<Range, Pred> Filter(const Range &range, Pred pred) {
+  return FilterRange<Range, Pred>(range, pred);
+}
+
 // Utility function for reverse lookups on the EnumNames*() functions
 // (in the generated C++ code)
 // names must be NULL terminated.
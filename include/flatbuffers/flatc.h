@@ -87,6 +87,14 @@ class FlatCompiler {
   void LoadBinarySchema(Parser &parser, const std::string &filename,
                         const std::string &contents);
 
+  // Parses the given JSON files with `jobs` worker threads, using parsers
+  // that share the definitions of `schema`, and runs the enabled data
+  // generators on each of them. Returns the number of input bytes processed.
+  size_t ConvertJsonFiles(const Parser &schema,
+                          const std::vector<std::string> &filenames,
+                          const std::vector<bool> &generator_enabled,
+                          const std::string &output_path, size_t jobs) const;
+
   void Warn(const std::string &warn, bool show_exe_name = true) const;
 
   void Error(const std::string &err, bool usage = true,
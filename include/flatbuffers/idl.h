@@ -561,9 +561,15 @@ struct IDLOptions {
   bool generate_name_strings;
   bool generate_object_based_api;
   bool gen_compare;
+  bool gen_json_printer;
+  bool gen_json_parser;
+  bool gen_hash;
   std::string cpp_object_api_pointer_type;
   std::string cpp_object_api_string_type;
   bool cpp_object_api_string_flexible_constructor;
+  bool cpp_object_api_arena;
+  bool gen_partial_unpack;
+  bool gen_static_layout;
   bool cpp_direct_copy;
   bool gen_nullable;
   bool java_checkerframework;
@@ -636,6 +642,12 @@ struct IDLOptions {
   // make the flatbuffer more compact.
   bool set_empty_vectors_to_null;
 
+  // If set, JSON tables that contain only scalar fields are written straight
+  // into the builder while they are parsed, in the order the fields appear,
+  // instead of being buffered and sorted by size first. This is faster for
+  // wide tables, but the layout may need more padding.
+  bool json_direct_scalar_tables;
+
   IDLOptions()
       : gen_jvmstatic(false),
         use_flexbuffers(false),
@@ -655,8 +667,14 @@ struct IDLOptions {
         generate_name_strings(false),
         generate_object_based_api(false),
         gen_compare(false),
+        gen_json_printer(false),
+        gen_json_parser(false),
+        gen_hash(false),
         cpp_object_api_pointer_type("std::unique_ptr"),
         cpp_object_api_string_flexible_constructor(false),
+        cpp_object_api_arena(false),
+        gen_partial_unpack(false),
+        gen_static_layout(false),
         cpp_direct_copy(true),
         gen_nullable(false),
         java_checkerframework(false),
@@ -683,7 +701,8 @@ struct IDLOptions {
         require_explicit_ids(false),
         lang_to_generate(0),
         set_empty_strings_to_null(true),
-        set_empty_vectors_to_null(true) {}
+        set_empty_vectors_to_null(true),
+        json_direct_scalar_tables(false) {}
 };
 
 // This encapsulates where the parser is in the current source file.
@@ -693,7 +712,8 @@ struct ParserState {
         line_start_(nullptr),
         line_(0),
         token_(-1),
-        attr_is_trivial_ascii_string_(true) {}
+        attr_is_trivial_ascii_string_(true),
+        attr_source_(nullptr) {}
 
  protected:
   void ResetState(const char *source) {
@@ -722,6 +742,10 @@ struct ParserState {
   // Used for number-in-string (and base64 string in future).
   bool attr_is_trivial_ascii_string_;
   std::string attribute_;
+  // If the text in attribute_ is a verbatim copy of the source (no escape
+  // sequences), this points at it, so it can be used without copying
+  // attribute_ after the next token has been read.
+  const char *attr_source_;
   std::vector<std::string> doc_comment_;
 };
 
@@ -781,6 +805,7 @@ class Parser : public ParserState {
         opts(options),
         uses_flexbuffers_(false),
         source_(nullptr),
+        schema_(nullptr),
         anonymous_counter_(0),
         parse_depth_counter_(0) {
     if (opts.force_defaults) { builder_.ForceDefaults(true); }
@@ -814,6 +839,17 @@ class Parser : public ParserState {
     known_attributes_["private"] = true;
   }
 
+  // Creates a lightweight parser for JSON data that is backed by the schema
+  // definitions of an already populated `schema` parser, instead of parsing
+  // the .fbs (or deserializing the .bfbs) again.
+  // The definitions are borrowed, not copied: the tables of this parser stay
+  // empty, `schema` must outlive it and must not be modified while it is in
+  // use. Every such parser has its own builder_ and parse state, so several
+  // of them may call ParseJson() concurrently from different threads.
+  // Anything that would add to or change the definitions (parsing a schema,
+  // Deserialize(), SetRootType(), ...) fails on such a parser.
+  Parser(const Parser &schema, const IDLOptions &options);
+
   ~Parser() {
     for (auto it = namespaces_.begin(); it != namespaces_.end(); ++it) {
       delete *it;
@@ -829,6 +865,10 @@ class Parser : public ParserState {
   // directory.
   // If the source was loaded from a file and isn't an include file,
   // supply its name in source_filename.
+  // A parser that is used for several files keeps the definitions of the
+  // includes it has parsed, and only parses the ones that changed on disk
+  // again, along with the files that depend on them. This cache lives in
+  // memory only, nothing is persisted between processes.
   // All paths specified in this call must be in posix format, if you accept
   // paths from user input, please call PosixPath on them first.
   bool Parse(const char *_source, const char **include_paths = nullptr,
@@ -915,6 +955,9 @@ class Parser : public ParserState {
                                                  F body);
   FLATBUFFERS_CHECKED_ERROR ParseTable(const StructDef &struct_def,
                                        std::string *value, uoffset_t *ovalue);
+  FLATBUFFERS_CHECKED_ERROR ParseScalarTable(const StructDef &struct_def,
+                                             std::string *value,
+                                             uoffset_t *ovalue);
   void SerializeStruct(const StructDef &struct_def, const Value &val);
   void SerializeStruct(FlatBufferBuilder &builder, const StructDef &struct_def,
                        const Value &val);
@@ -967,6 +1010,18 @@ class Parser : public ParserState {
                                     const char *source_filename,
                                     const char *include_filename);
   FLATBUFFERS_CHECKED_ERROR DoParseJson();
+  // A file removed by ForgetFile(), for ReparseFiles().
+  struct ForgottenFile {
+    ForgottenFile() : root(false), generated(false) {}
+    bool root;       // Parsed by Parse() rather than through an include.
+    bool generated;  // Its definitions were marked as generated.
+  };
+  typedef std::map<std::string, ForgottenFile> ForgottenFiles;
+  void ForgetChangedIncludes(const std::string &filename,
+                             ForgottenFiles *forgotten);
+  void ForgetFile(const std::string &filename, ForgottenFiles *forgotten);
+  void ReparseFiles(const ForgottenFiles &files, const char **include_paths,
+                    const char *source_filename);
   FLATBUFFERS_CHECKED_ERROR CheckClash(std::vector<FieldDef *> &fields,
                                        StructDef *struct_def,
                                        const char *suffix, BaseType baseType);
@@ -1001,6 +1056,14 @@ class Parser : public ParserState {
 
   std::map<uint64_t, std::string> included_files_;
   std::map<std::string, std::set<std::string>> files_included_per_file_;
+  // Hashes of the include files loaded during the current Parse(), so that
+  // restarting a file after each of its includes doesn't load them again.
+  std::map<std::string, uint64_t> include_file_hashes_;
+  // Hash of the contents each file was parsed from, by any Parse() call.
+  std::map<std::string, uint64_t> parsed_file_hashes_;
+  // Size and modification time of each file when it was last hashed, so
+  // that a file that wasn't written since isn't read and hashed again.
+  std::map<std::string, std::pair<uint64_t, int64_t>> file_times_;
   std::vector<std::string> native_included_files_;
 
   std::map<std::string, bool> known_attributes_;
@@ -1014,6 +1077,10 @@ class Parser : public ParserState {
   std::string file_being_parsed_;
 
   std::vector<std::pair<Value, FieldDef *>> field_stack_;
+  std::vector<bool> fields_seen_;  // Used by ParseScalarTable.
+
+  // The parser whose definitions are borrowed, if any.
+  const Parser *schema_;
 
   int anonymous_counter_;
   int parse_depth_counter_;  // stack-overflow guard
@@ -1038,6 +1105,23 @@ extern bool GenerateTextFromTable(const Parser &parser, const void *table,
                                   std::string *text);
 extern bool GenerateText(const Parser &parser, const void *flatbuffer,
                          std::string *text);
+
+// Destination for text generated incrementally, see the GenerateText
+// overloads below.
+class TextSink {
+ public:
+  virtual ~TextSink() {}
+  // Receives the next piece of text. Returning false aborts the generation.
+  virtual bool Write(const char *text, size_t size) = 0;
+};
+
+// As above, but the text is passed to `sink` in pieces of bounded size while
+// it is generated, instead of being accumulated in a single string.
+extern bool GenerateTextFromTable(const Parser &parser, const void *table,
+                                  const std::string &tablename,
+                                  TextSink *sink);
+extern bool GenerateText(const Parser &parser, const void *flatbuffer,
+                         TextSink *sink);
 extern bool GenerateTextFile(const Parser &parser, const std::string &path,
                              const std::string &file_name);
 
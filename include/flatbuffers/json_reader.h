@@ -0,0 +1,439 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_JSON_READER_H_
+#define FLATBUFFERS_JSON_READER_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/util.h"
+
+// Same limit as the schema parser, see idl.h.
+#if !defined(FLATBUFFERS_MAX_PARSING_DEPTH)
+#  define FLATBUFFERS_MAX_PARSING_DEPTH 64
+#endif
+
+namespace flatbuffers {
+
+// A small pull parser over null-terminated JSON text, used by the parsers
+// generated with flatc --gen-json-parser. It accepts the same relaxed JSON
+// as the schema parser: unquoted field names, trailing commas, comments,
+// and numbers given as strings.
+// The first error stops all further parsing; every method then returns
+// false and error() describes what went wrong and where.
+class JsonReader {
+ public:
+  explicit JsonReader(const char *json)
+      : json_(json), cursor_(json), error_(nullptr), depth_(0) {}
+
+  bool ok() const { return error_ == nullptr; }
+
+  // Returns "line:column: message" for the first error, or "" if none.
+  std::string error() const {
+    if (!error_) return "";
+    int line = 1;
+    const char *line_start = json_;
+    for (const char *p = json_; p < cursor_; p++) {
+      if (*p == '\n') {
+        line++;
+        line_start = p + 1;
+      }
+    }
+    return NumToString(line) + ":" +
+           NumToString(static_cast<int>(cursor_ - line_start)) + ": " +
+           error_;
+  }
+
+  bool Fail(const char *msg) {
+    if (!error_) error_ = msg;
+    return false;
+  }
+
+  // Remember a position to come back to later, e.g. for a union value that
+  // appears before its type field.
+  const char *position() const { return cursor_; }
+  void Seek(const char *position) { cursor_ = position; }
+
+  // Call once the root value has been parsed: only whitespace may follow.
+  bool End() {
+    if (!SkipSpace()) return false;
+    return *cursor_ ? Fail("unexpected text after the root value") : true;
+  }
+
+  // Returns the next significant character without consuming it.
+  char Peek() { return SkipSpace() ? *cursor_ : '\0'; }
+
+  bool Expect(char c) {
+    if (Peek() != c) return Fail("unexpected character");
+    cursor_++;
+    return true;
+  }
+
+  // Iterate over an object with:
+  //   bool first = true;
+  //   if (!reader.BeginObject()) return false;
+  //   while (reader.NextMember(&first, &key, &key_len)) { ... }
+  //   if (!reader.ok()) return false;
+  bool BeginObject() { return Enter('{'); }
+
+  bool NextMember(bool *first, const char **key, size_t *key_len) {
+    if (!Continue('}', first)) return false;
+    if (!ParseKey(key, key_len)) return false;
+    return Expect(':');
+  }
+
+  // Same as the above, for arrays.
+  bool BeginArray() { return Enter('['); }
+
+  bool NextElement(bool *first) { return Continue(']', first); }
+
+  // Consumes a null literal if that is what comes next.
+  bool AcceptNull() {
+    if (Peek() != 'n' || strncmp(cursor_, "null", 4) != 0 ||
+        is_alnum(cursor_[4]) || cursor_[4] == '_')
+      return false;
+    cursor_ += 4;
+    return true;
+  }
+
+  // Parses a string. Strings without escapes point straight into the
+  // input, others into a buffer that is reused by the next call.
+  bool ParseString(const char **str, size_t *len) {
+    const char quote = Peek();
+    if (quote != '\"' && quote != '\'') return Fail("expecting a string");
+    const char *start = ++cursor_;
+    while (*cursor_ != quote && *cursor_ != '\\' &&
+           static_cast<unsigned char>(*cursor_) >= ' ') {
+      if (*cursor_ & 0x80) {
+        if (FromUTF8(&cursor_) < 0) return Fail("illegal UTF-8 sequence");
+      } else {
+        cursor_++;
+      }
+    }
+    if (*cursor_ == quote) {
+      *str = start;
+      *len = static_cast<size_t>(cursor_++ - start);
+      return true;
+    }
+    scratch_.assign(start, cursor_);
+    if (!ParseEscapedString(quote)) return false;
+    *str = scratch_.c_str();
+    *len = scratch_.size();
+    return true;
+  }
+
+  // Parses a string or a bare identifier, e.g. an enum value given by name.
+  // Enum values may be a string of space separated names; call NextWord()
+  // to walk them.
+  bool ParseName(const char **str, size_t *len) {
+    if (Peek() == '\"' || Peek() == '\'') return ParseString(str, len);
+    if (!is_alpha(*cursor_) && *cursor_ != '_') return Fail("expecting a name");
+    *str = cursor_;
+    while (is_alnum(*cursor_) || *cursor_ == '_') cursor_++;
+    *len = static_cast<size_t>(cursor_ - *str);
+    return true;
+  }
+
+  static bool NextWord(const char **str, const char *end, const char **word,
+                       size_t *len) {
+    while (*str < end && **str == ' ') (*str)++;
+    if (*str == end) return false;
+    *word = *str;
+    while (*str < end && **str != ' ') (*str)++;
+    *len = static_cast<size_t>(*str - *word);
+    return true;
+  }
+
+  // True if the next value is a string or identifier rather than a number.
+  bool IsNextName() {
+    const char c = Peek();
+    return c == '\"' || c == '\'' || is_alpha(c) || c == '_';
+  }
+
+  // Parses a number, which may also be given as a string.
+  template<typename T> bool ParseScalar(T *val) {
+    char buf[64];
+    if (!ParseNumberToken(buf, sizeof(buf))) return false;
+    if (!strcmp(buf, "true")) {
+      *val = 1;
+    } else if (!strcmp(buf, "false")) {
+      *val = 0;
+    } else if (!StringToNumber(buf, val)) {
+      return Fail("invalid number");
+    }
+    return true;
+  }
+
+  bool ParseScalar(bool *val) {
+    uint8_t v = 0;
+    if (!ParseScalar(&v)) return false;
+    *val = v != 0;
+    return true;
+  }
+
+  // Skips over any value, e.g. that of a deprecated field.
+  bool Skip() {
+    const char c = Peek();
+    if (c == '{') {
+      bool first = true;
+      const char *key;
+      size_t key_len;
+      if (!BeginObject()) return false;
+      while (NextMember(&first, &key, &key_len)) {
+        if (!Skip()) return false;
+      }
+      return ok();
+    }
+    if (c == '[') {
+      bool first = true;
+      if (!BeginArray()) return false;
+      while (NextElement(&first)) {
+        if (!Skip()) return false;
+      }
+      return ok();
+    }
+    if (c == '\"' || c == '\'') {
+      const char *str;
+      size_t len;
+      return ParseString(&str, &len);
+    }
+    if (AcceptNull()) return true;
+    char buf[64];
+    return ParseNumberToken(buf, sizeof(buf));
+  }
+
+  // Parses any value into a FlexBuffer, for fields with the flexbuffer
+  // attribute. This is a template so that only callers need flexbuffers.h.
+  template<typename FlexBuilder> bool ParseFlexBufferValue(FlexBuilder *fbb) {
+    const char c = Peek();
+    if (c == '{') {
+      bool first = true;
+      const char *key;
+      size_t key_len;
+      const auto start = fbb->StartMap();
+      if (!BeginObject()) return false;
+      while (NextMember(&first, &key, &key_len)) {
+        fbb->Key(std::string(key, key_len));  // Must be null-terminated.
+        if (!ParseFlexBufferValue(fbb)) return false;
+      }
+      if (!ok()) return false;
+      fbb->EndMap(start);
+      if (fbb->HasDuplicateKeys())
+        return Fail("FlexBuffers map has duplicate keys");
+      return true;
+    }
+    if (c == '[') {
+      bool first = true;
+      const auto start = fbb->StartVector();
+      if (!BeginArray()) return false;
+      while (NextElement(&first)) {
+        if (!ParseFlexBufferValue(fbb)) return false;
+      }
+      if (!ok()) return false;
+      fbb->EndVector(start, false, false);
+      return true;
+    }
+    if (c == '\"' || c == '\'') {
+      const char *str;
+      size_t len;
+      if (!ParseString(&str, &len)) return false;
+      fbb->String(str, len);
+      return true;
+    }
+    if (AcceptNull()) {
+      fbb->Null();
+      return true;
+    }
+    char buf[64];
+    if (!ParseNumberToken(buf, sizeof(buf))) return false;
+    int64_t i;
+    double d;
+    if (!strcmp(buf, "true") || !strcmp(buf, "false")) {
+      fbb->Bool(buf[0] == 't');
+    } else if (StringToNumber(buf, &i)) {
+      fbb->Int(i);
+    } else if (StringToNumber(buf, &d)) {
+      fbb->Double(d);
+    } else {
+      return Fail("invalid number");
+    }
+    return true;
+  }
+
+ private:
+  bool SkipSpace() {
+    if (error_) return false;
+    for (;;) {
+      const char c = *cursor_;
+      if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+        cursor_++;
+      } else if (c == '/' && cursor_[1] == '/') {
+        while (*cursor_ && *cursor_ != '\n') cursor_++;
+      } else if (c == '/' && cursor_[1] == '*') {
+        const char *end = strstr(cursor_ + 2, "*/");
+        if (!end) return Fail("end of file in comment");
+        cursor_ = end + 2;
+      } else {
+        return true;
+      }
+    }
+  }
+
+  bool Enter(char open) {
+    if (!Expect(open)) return false;
+    if (++depth_ > FLATBUFFERS_MAX_PARSING_DEPTH)
+      return Fail("nesting is too deep");
+    return true;
+  }
+
+  bool Continue(char close, bool *first) {
+    if (Peek() == close) {
+      cursor_++;
+      depth_--;
+      return false;
+    }
+    if (!*first) {
+      if (!Expect(',')) return false;
+      // Trailing commas are allowed.
+      if (Peek() == close) {
+        cursor_++;
+        depth_--;
+        return false;
+      }
+    }
+    *first = false;
+    return ok();
+  }
+
+  bool ParseKey(const char **key, size_t *key_len) {
+    const char c = Peek();
+    if (c == '\"' || c == '\'') return ParseString(key, key_len);
+    if (!is_alpha(c) && c != '_') return Fail("expecting a field name");
+    *key = cursor_;
+    while (is_alnum(*cursor_) || *cursor_ == '_') cursor_++;
+    *key_len = static_cast<size_t>(cursor_ - *key);
+    return true;
+  }
+
+  // Continues a string at an escape sequence, appending to scratch_.
+  bool ParseEscapedString(char quote) {
+    for (;;) {
+      const char c = *cursor_;
+      if (c == quote) {
+        cursor_++;
+        return true;
+      }
+      if (static_cast<unsigned char>(c) < ' ')
+        return Fail("illegal character in string constant");
+      if (c & 0x80) {
+        const char *start = cursor_;
+        if (FromUTF8(&cursor_) < 0) return Fail("illegal UTF-8 sequence");
+        scratch_.append(start, cursor_);
+        continue;
+      }
+      cursor_++;
+      if (c != '\\') {
+        scratch_ += c;
+        continue;
+      }
+      switch (*cursor_++) {
+        case 'n': scratch_ += '\n'; break;
+        case 't': scratch_ += '\t'; break;
+        case 'r': scratch_ += '\r'; break;
+        case 'b': scratch_ += '\b'; break;
+        case 'f': scratch_ += '\f'; break;
+        case '\"': scratch_ += '\"'; break;
+        case '\'': scratch_ += '\''; break;
+        case '\\': scratch_ += '\\'; break;
+        case '/': scratch_ += '/'; break;
+        case 'x': {
+          uint32_t val;
+          if (!ParseHex(2, &val)) return false;
+          scratch_ += static_cast<char>(val);
+          break;
+        }
+        case 'u': {
+          uint32_t val;
+          if (!ParseHex(4, &val)) return false;
+          if (val >= 0xD800 && val <= 0xDBFF) {
+            // A high surrogate must be followed by a low one.
+            uint32_t low;
+            if (cursor_[0] != '\\' || cursor_[1] != 'u')
+              return Fail("illegal Unicode sequence (unpaired high surrogate)");
+            cursor_ += 2;
+            if (!ParseHex(4, &low)) return false;
+            if (low < 0xDC00 || low > 0xDFFF)
+              return Fail("illegal Unicode sequence (unpaired high surrogate)");
+            val = 0x10000 + ((val & 0x3FF) << 10) + (low & 0x3FF);
+          } else if (val >= 0xDC00 && val <= 0xDFFF) {
+            return Fail("illegal Unicode sequence (unpaired low surrogate)");
+          }
+          ToUTF8(val, &scratch_);
+          break;
+        }
+        default:
+          cursor_--;
+          return Fail("unknown escape code in string constant");
+      }
+    }
+  }
+
+  bool ParseHex(int digits, uint32_t *val) {
+    *val = 0;
+    for (int i = 0; i < digits; i++) {
+      const char c = *cursor_;
+      if (!is_xdigit(c))
+        return Fail("escape code must be followed by hex digits");
+      const int digit = is_digit(c) ? c - '0' : (c & 0xDF) - 'A' + 10;
+      *val = (*val << 4) | static_cast<uint32_t>(digit);
+      cursor_++;
+    }
+    return true;
+  }
+
+  // Copies the text of a number (or true/false) into buf, null-terminated.
+  bool ParseNumberToken(char *buf, size_t size) {
+    char quote = Peek();
+    if (quote == '\"' || quote == '\'') {
+      cursor_++;
+    } else {
+      quote = '\0';
+    }
+    const char *start = cursor_;
+    while (is_alnum(*cursor_) || *cursor_ == '+' || *cursor_ == '-' ||
+           *cursor_ == '.' || *cursor_ == '_')
+      cursor_++;
+    const auto len = static_cast<size_t>(cursor_ - start);
+    if (!len) return Fail("expecting a number");
+    if (len >= size) return Fail("number is too long");
+    memcpy(buf, start, len);
+    buf[len] = '\0';
+    if (quote) {
+      if (*cursor_ != quote) return Fail("expecting a number");
+      cursor_++;
+    }
+    return true;
+  }
+
+  const char *json_;
+  const char *cursor_;
+  const char *error_;
+  int depth_;
+  std::string scratch_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_JSON_READER_H_
@@ -66,6 +66,10 @@ struct IterationVisitor {
   virtual void Element(size_t /*i*/, ElementaryType /*type*/,
                        const TypeTable * /*type_table*/,
                        const uint8_t * /*val*/) {}
+  // Called after StartVector() with the number of elements. Returning less
+  // visits only that many, followed by a call to ElementsSkipped().
+  virtual size_t ElementsToVisit(size_t size) { return size; }
+  virtual void ElementsSkipped(size_t /*visited*/, size_t /*skipped*/) {}
   virtual ~IterationVisitor() {}
 };
 
@@ -268,12 +272,14 @@ inline void IterateObject(const uint8_t *obj, const TypeTable *type_table,
           ++array_idx;
         }
         visitor->StartVector();
-        for (size_t j = 0; j < size; j++) {
+        const auto visited = (std::min)(visitor->ElementsToVisit(size), size);
+        for (size_t j = 0; j < visited; j++) {
           visitor->Element(j, type, ref, elem_ptr);
           IterateValue(type, elem_ptr, ref, prev_val, static_cast<soffset_t>(j),
                        visitor);
           elem_ptr += InlineSize(type, ref);
         }
+        if (visited < size) visitor->ElementsSkipped(visited, size - visited);
         visitor->EndVector();
       } else {
         IterateValue(type, val, ref, prev_val, -1, visitor);
@@ -292,126 +298,209 @@ inline void IterateFlatBuffer(const uint8_t *buffer,
 
 // Outputting a Flatbuffer to a string. Tries to conform as close to JSON /
 // the output generated by idl_gen_text.cpp.
+// The text goes to any Sink with an append(const char *, size_t) method, such
+// as a std::string that is cleared and reused between buffers. Numbers are
+// formatted without allocating.
 
-struct ToStringVisitor : public IterationVisitor {
-  std::string s;
+template<typename Sink> struct BasicToStringVisitor : public IterationVisitor {
+  Sink *sink;
   std::string d;
   bool q;
   std::string in;
   size_t indent_level;
   bool vector_delimited;
-  ToStringVisitor(std::string delimiter, bool quotes, std::string indent,
-                  bool vdelimited = true)
-      : d(delimiter),
+  // If non-zero, vectors are cut short after this many elements, to bound
+  // the size of the output.
+  size_t max_vector_elements;
+  std::string escaped;  // Reused by String().
+  BasicToStringVisitor(Sink &output, std::string delimiter, bool quotes,
+                       std::string indent, bool vdelimited = true,
+                       size_t max_elements = 0)
+      : sink(&output),
+        d(delimiter),
         q(quotes),
         in(indent),
         indent_level(0),
-        vector_delimited(vdelimited) {}
-  ToStringVisitor(std::string delimiter)
-      : d(delimiter),
-        q(false),
-        in(""),
-        indent_level(0),
-        vector_delimited(true) {}
+        vector_delimited(vdelimited),
+        max_vector_elements(max_elements) {}
+
+  void append(const char *str, size_t len) { sink->append(str, len); }
+  void append(const char *str) { append(str, strlen(str)); }
+  void append(const std::string &str) { append(str.c_str(), str.size()); }
 
   void append_indent() {
-    for (size_t i = 0; i < indent_level; i++) { s += in; }
+    for (size_t i = 0; i < indent_level; i++) { append(in); }
+  }
+
+  void append_separator() {
+    append(",");
+    if (vector_delimited) {
+      append(d);
+      append_indent();
+    } else {
+      append(" ");
+    }
   }
 
   void StartSequence() {
-    s += "{";
-    s += d;
+    append("{");
+    append(d);
     indent_level++;
   }
   void EndSequence() {
-    s += d;
+    append(d);
     indent_level--;
     append_indent();
-    s += "}";
+    append("}");
   }
   void Field(size_t /*field_idx*/, size_t set_idx, ElementaryType /*type*/,
              bool /*is_vector*/, const TypeTable * /*type_table*/,
              const char *name, const uint8_t *val) {
     if (!val) return;
     if (set_idx) {
-      s += ",";
-      s += d;
+      append(",");
+      append(d);
     }
     append_indent();
     if (name) {
-      if (q) s += "\"";
-      s += name;
-      if (q) s += "\"";
-      s += ": ";
+      if (q) append("\"");
+      append(name);
+      if (q) append("\"");
+      append(": ");
     }
   }
   template<typename T> void Named(T x, const char *name) {
     if (name) {
-      if (q) s += "\"";
-      s += name;
-      if (q) s += "\"";
+      if (q) append("\"");
+      append(name);
+      if (q) append("\"");
     } else {
-      s += NumToString(x);
+      char buf[20];
+      append(buf, IntToChars(static_cast<int64_t>(x), buf));
     }
   }
   void UType(uint8_t x, const char *name) { Named(x, name); }
-  void Bool(bool x) { s += x ? "true" : "false"; }
+  void Bool(bool x) { append(x ? "true" : "false"); }
   void Char(int8_t x, const char *name) { Named(x, name); }
   void UChar(uint8_t x, const char *name) { Named(x, name); }
   void Short(int16_t x, const char *name) { Named(x, name); }
   void UShort(uint16_t x, const char *name) { Named(x, name); }
   void Int(int32_t x, const char *name) { Named(x, name); }
   void UInt(uint32_t x, const char *name) { Named(x, name); }
-  void Long(int64_t x) { s += NumToString(x); }
-  void ULong(uint64_t x) { s += NumToString(x); }
-  void Float(float x) { s += NumToString(x); }
-  void Double(double x) { s += NumToString(x); }
+  void Long(int64_t x) {
+    char buf[20];
+    append(buf, IntToChars(x, buf));
+  }
+  void ULong(uint64_t x) {
+    char buf[20];
+    append(buf, UIntToChars(x, buf));
+  }
+  void Float(float x) {
+    char buf[330];
+    append(buf, FloatToChars(x, 6, buf, sizeof(buf)));
+  }
+  void Double(double x) {
+    char buf[330];
+    append(buf, FloatToChars(x, 12, buf, sizeof(buf)));
+  }
   void String(const struct String *str) {
-    EscapeString(str->c_str(), str->size(), &s, true, false);
+    const char *chars = str->c_str();
+    const size_t size = str->size();
+    size_t i = 0;
+    while (i < size && chars[i] >= ' ' && chars[i] <= '~' && chars[i] != '\"' &&
+           chars[i] != '\\')
+      i++;
+    if (i == size) {  // Nothing to escape.
+      append("\"");
+      append(chars, size);
+      append("\"");
+      return;
+    }
+    escaped.clear();
+    EscapeString(chars, size, &escaped, true, false);
+    append(escaped);
   }
-  void Unknown(const uint8_t *) { s += "(?)"; }
+  void Unknown(const uint8_t *) { append("(?)"); }
   void StartVector() {
-    s += "[";
+    append("[");
     if (vector_delimited) {
-      s += d;
+      append(d);
       indent_level++;
       append_indent();
     } else {
-      s += " ";
+      append(" ");
     }
   }
   void EndVector() {
     if (vector_delimited) {
-      s += d;
+      append(d);
       indent_level--;
       append_indent();
     } else {
-      s += " ";
+      append(" ");
     }
-    s += "]";
+    append("]");
   }
   void Element(size_t i, ElementaryType /*type*/,
                const TypeTable * /*type_table*/, const uint8_t * /*val*/) {
-    if (i) {
-      s += ",";
-      if (vector_delimited) {
-        s += d;
-        append_indent();
-      } else {
-        s += " ";
-      }
-    }
+    if (i) append_separator();
+  }
+  size_t ElementsToVisit(size_t size) {
+    return max_vector_elements ? (std::min)(size, max_vector_elements) : size;
+  }
+  // Cut short vectors end in e.g. "... 7 more".
+  void ElementsSkipped(size_t visited, size_t skipped) {
+    if (visited) append_separator();
+    char buf[20];
+    append("... ");
+    append(buf, UIntToChars(skipped, buf));
+    append(" more");
+  }
+};
+
+struct ToStringVisitor : public BasicToStringVisitor<std::string> {
+  std::string s;
+  ToStringVisitor(std::string delimiter, bool quotes, std::string indent,
+                  bool vdelimited = true)
+      : BasicToStringVisitor<std::string>(s, delimiter, quotes, indent,
+                                          vdelimited) {}
+  ToStringVisitor(std::string delimiter)
+      : BasicToStringVisitor<std::string>(s, delimiter, false, "") {}
+  // Copies write to their own `s`, not to that of the original.
+  ToStringVisitor(const ToStringVisitor &other)
+      : BasicToStringVisitor<std::string>(other), s(other.s) {
+    sink = &s;
+  }
+  ToStringVisitor &operator=(const ToStringVisitor &other) {
+    BasicToStringVisitor<std::string>::operator=(other);
+    s = other.s;
+    sink = &s;
+    return *this;
   }
 };
 
+// If max_vector_elements is non-zero, only that many elements of each vector
+// are printed.
+template<typename Sink>
+inline void FlatBufferToSink(Sink &sink, const uint8_t *buffer,
+                             const TypeTable *type_table,
+                             bool multi_line = false,
+                             bool vector_delimited = true,
+                             size_t max_vector_elements = 0) {
+  BasicToStringVisitor<Sink> visitor(sink, multi_line ? "\n" : " ", false, "",
+                                     vector_delimited, max_vector_elements);
+  IterateFlatBuffer(buffer, type_table, &visitor);
+}
+
 inline std::string FlatBufferToString(const uint8_t *buffer,
                                       const TypeTable *type_table,
                                       bool multi_line = false,
-                                      bool vector_delimited = true) {
-  ToStringVisitor tostring_visitor(multi_line ? "\n" : " ", false, "",
-                                   vector_delimited);
-  IterateFlatBuffer(buffer, type_table, &tostring_visitor);
-  return tostring_visitor.s;
+                                      bool vector_delimited = true,
+                                      size_t max_vector_elements = 0) {
+  std::string s;
+  FlatBufferToSink(s, buffer, type_table, multi_line, vector_delimited,
+                   max_vector_elements);
+  return s;
 }
 
 }  // namespace flatbuffers
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_PATCH_H_
+#define FLATBUFFERS_PATCH_H_
+
+#include "flatbuffers/reflection.h"
+// Generated from reflection/patch.fbs, see reflection/generate_code.sh
+#include "flatbuffers/patch_generated.h"
+
+namespace flatbuffers {
+
+// Generic diffing of FlatBuffers of the same schema: Diff creates a patch
+// (a FlatBuffer with a reflection::patch::TablePatch root, see
+// reflection/patch.fbs) that holds only the fields that changed between
+// "old_table" and "new_table", descending into tables present in both.
+// ApplyPatch then creates a copy of "old_table" with the patch applied.
+// Like CopyTable, this copies DAGs as trees and does not support vectors of
+// unions.
+Offset<reflection::patch::TablePatch> Diff(FlatBufferBuilder &fbb,
+                                           const reflection::Schema &schema,
+                                           const reflection::Object &objectdef,
+                                           const Table &old_table,
+                                           const Table &new_table);
+
+Offset<const Table *> ApplyPatch(FlatBufferBuilder &fbb,
+                                 const reflection::Schema &schema,
+                                 const reflection::Object &objectdef,
+                                 const Table &old_table,
+                                 const reflection::patch::TablePatch &patch);
+
+// The same for whole buffers with the schema's root type: "patch" or "fbb"
+// are finished with the patch or the new buffer respectively.
+void Diff(const reflection::Schema &schema, const uint8_t *old_buf,
+          const uint8_t *new_buf, FlatBufferBuilder *patch);
+
+void ApplyPatch(const reflection::Schema &schema, const uint8_t *old_buf,
+                const uint8_t *patch, FlatBufferBuilder *fbb);
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_PATCH_H_
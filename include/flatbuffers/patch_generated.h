@@ -0,0 +1,234 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_PATCH_REFLECTION_PATCH_H_
+#define FLATBUFFERS_GENERATED_PATCH_REFLECTION_PATCH_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace reflection {
+namespace patch {
+
+struct FieldPatch;
+struct FieldPatchBuilder;
+
+struct TablePatch;
+struct TablePatchBuilder;
+
+enum PatchOp {
+  Remove = 0,
+  Set = 1,
+  Modify = 2
+};
+
+inline const PatchOp (&EnumValuesPatchOp())[3] {
+  static const PatchOp values[] = {
+    Remove,
+    Set,
+    Modify
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesPatchOp() {
+  static const char * const names[4] = {
+    "Remove",
+    "Set",
+    "Modify",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNamePatchOp(PatchOp e) {
+  if (flatbuffers::IsOutRange(e, Remove, Modify)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesPatchOp()[index];
+}
+
+struct FieldPatch FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef FieldPatchBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_OFFSET = 4,
+    VT_OP = 6,
+    VT_DATA = 8,
+    VT_PATCH = 10
+  };
+  uint16_t offset() const {
+    return GetField<uint16_t>(VT_OFFSET, 0);
+  }
+  bool KeyCompareLessThan(const FieldPatch *o) const {
+    return offset() < o->offset();
+  }
+  int KeyCompareWithValue(uint16_t val) const {
+    return static_cast<int>(offset() > val) - static_cast<int>(offset() < val);
+  }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(offset());
+  }
+  uint16_t KeySortValue() const {
+    return offset();
+  }
+  reflection::patch::PatchOp op() const {
+    return static_cast<reflection::patch::PatchOp>(GetField<int8_t>(VT_OP, 0));
+  }
+  const flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  const reflection::patch::TablePatch *patch() const {
+    return GetPointer<const reflection::patch::TablePatch *>(VT_PATCH);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint16_t>(verifier, VT_OFFSET) &&
+           VerifyField<int8_t>(verifier, VT_OP) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           VerifyOffset(verifier, VT_PATCH) &&
+           verifier.VerifyTable(patch()) &&
+           verifier.EndTable();
+  }
+};
+
+struct FieldPatchBuilder {
+  typedef FieldPatch Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_offset(uint16_t offset) {
+    fbb_.AddElement<uint16_t>(FieldPatch::VT_OFFSET, offset, 0);
+  }
+  void add_op(reflection::patch::PatchOp op) {
+    fbb_.AddElement<int8_t>(FieldPatch::VT_OP, static_cast<int8_t>(op), 0);
+  }
+  void add_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(FieldPatch::VT_DATA, data);
+  }
+  void add_patch(flatbuffers::Offset<reflection::patch::TablePatch> patch) {
+    fbb_.AddOffset(FieldPatch::VT_PATCH, patch);
+  }
+  explicit FieldPatchBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<FieldPatch> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<FieldPatch>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<FieldPatch> CreateFieldPatch(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint16_t offset = 0,
+    reflection::patch::PatchOp op = reflection::patch::Remove,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0,
+    flatbuffers::Offset<reflection::patch::TablePatch> patch = 0) {
+  FieldPatchBuilder builder_(_fbb);
+  builder_.add_patch(patch);
+  builder_.add_data(data);
+  builder_.add_offset(offset);
+  builder_.add_op(op);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<FieldPatch> CreateFieldPatchDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint16_t offset = 0,
+    reflection::patch::PatchOp op = reflection::patch::Remove,
+    const std::vector<uint8_t> *data = nullptr,
+    flatbuffers::Offset<reflection::patch::TablePatch> patch = 0) {
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return reflection::patch::CreateFieldPatch(
+      _fbb,
+      offset,
+      op,
+      data__,
+      patch);
+}
+
+struct TablePatch FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef TablePatchBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_FIELDS = 4
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<reflection::patch::FieldPatch>> *fields() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<reflection::patch::FieldPatch>> *>(VT_FIELDS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_FIELDS) &&
+           verifier.VerifyVector(fields()) &&
+           verifier.VerifyVectorOfTables(fields()) &&
+           verifier.EndTable();
+  }
+};
+
+struct TablePatchBuilder {
+  typedef TablePatch Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_fields(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<reflection::patch::FieldPatch>>> fields) {
+    fbb_.AddOffset(TablePatch::VT_FIELDS, fields);
+  }
+  explicit TablePatchBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<TablePatch> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<TablePatch>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<TablePatch> CreateTablePatch(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<reflection::patch::FieldPatch>>> fields = 0) {
+  TablePatchBuilder builder_(_fbb);
+  builder_.add_fields(fields);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<TablePatch> CreateTablePatchDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    std::vector<flatbuffers::Offset<reflection::patch::FieldPatch>> *fields = nullptr) {
+  auto fields__ = fields ? _fbb.CreateVectorOfSortedTables<reflection::patch::FieldPatch>(fields) : 0;
+  return reflection::patch::CreateTablePatch(
+      _fbb,
+      fields__);
+}
+
+inline const reflection::patch::TablePatch *GetTablePatch(const void *buf) {
+  return flatbuffers::GetRoot<reflection::patch::TablePatch>(buf);
+}
+
+inline const reflection::patch::TablePatch *GetSizePrefixedTablePatch(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<reflection::patch::TablePatch>(buf);
+}
+
+inline bool VerifyTablePatchBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<reflection::patch::TablePatch>(nullptr);
+}
+
+inline bool VerifySizePrefixedTablePatchBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<reflection::patch::TablePatch>(nullptr);
+}
+
+inline void FinishTablePatchBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<reflection::patch::TablePatch> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedTablePatchBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<reflection::patch::TablePatch> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace patch
+}  // namespace reflection
+
+#endif  // FLATBUFFERS_GENERATED_PATCH_REFLECTION_PATCH_H_
@@ -279,6 +279,174 @@ T *GetAnyFieldAddressOf(const Struct &st, const reflection::Field &field) {
   return reinterpret_cast<T *>(st.GetAddressOf(field.offset()));
 }
 
+// A field resolved once from a dotted path such as "pos.x" or "enemy.name",
+// going through fields that are tables or structs. Accessing it only
+// follows the precomputed offsets, with no lookups in the schema, which
+// makes it much faster than finding the fields for every access.
+class FieldPath {
+ public:
+  FieldPath() : field_(nullptr) {}
+  FieldPath(const reflection::Schema &schema,
+            const reflection::Object &objectdef, const char *path)
+      : field_(nullptr) {
+    Resolve(schema, objectdef, path);
+  }
+
+  // Returns false if "path" does not name a field of "objectdef".
+  bool Resolve(const reflection::Schema &schema,
+               const reflection::Object &objectdef, const char *path);
+
+  bool ok() const { return field_ != nullptr; }
+  // The last field of the path.
+  const reflection::Field &field() const { return *field_; }
+  reflection::BaseType base_type() const { return base_type_; }
+
+  // The address of the field inside "root", or nullptr if it or any table
+  // leading to it is not present.
+  const uint8_t *GetAddressOf(const Table &root) const {
+    auto p = reinterpret_cast<const uint8_t *>(&root);
+    for (auto it = steps_.begin(); it != steps_.end(); ++it) {
+      if (it->in_table) {
+        p = reinterpret_cast<const Table *>(p)->GetAddressOf(it->offset);
+        if (!p) return nullptr;
+      } else {
+        p += it->offset;
+      }
+      if (it->indirect) p += ReadScalar<uoffset_t>(p);
+    }
+    return p;
+  }
+  uint8_t *GetAddressOf(Table *root) const {
+    return const_cast<uint8_t *>(GetAddressOf(*root));
+  }
+
+  // Get a scalar field, if you know its exact type.
+  template<typename T> T Get(const Table &root) const {
+    FLATBUFFERS_ASSERT(sizeof(T) == GetTypeSize(base_type_));
+    auto p = GetAddressOf(root);
+    return p ? ReadScalar<T>(p)
+             : static_cast<T>(IsFloat(base_type_) ? default_real_
+                                                  : default_integer_);
+  }
+
+  // Get any scalar field as a 64bit int or double.
+  int64_t GetI(const Table &root) const {
+    auto p = GetAddressOf(root);
+    return p ? GetAnyValueI(base_type_, p) : default_integer_;
+  }
+  double GetF(const Table &root) const {
+    auto p = GetAddressOf(root);
+    return p ? GetAnyValueF(base_type_, p) : default_real_;
+  }
+
+  const String *GetS(const Table &root) const {
+    FLATBUFFERS_ASSERT(base_type_ == reflection::String);
+    auto p = GetAddressOf(root);
+    return p ? reinterpret_cast<const String *>(p + ReadScalar<uoffset_t>(p))
+             : nullptr;
+  }
+
+  // Set a scalar field, if you know its exact type. Like SetField, this
+  // fails if the field is not present in the buffer.
+  template<typename T> bool Set(Table *root, T val) const {
+    FLATBUFFERS_ASSERT(sizeof(T) == GetTypeSize(base_type_));
+    auto p = GetAddressOf(root);
+    if (!p) return false;
+    WriteScalar(p, val);
+    return true;
+  }
+
+ private:
+  struct Step {
+    voffset_t offset;  // Vtable offset in a table, or offset in a struct.
+    bool in_table;
+    bool indirect;  // Holds an offset to a table that the path goes into.
+  };
+
+  std::vector<Step> steps_;
+  const reflection::Field *field_;
+  reflection::BaseType base_type_;
+  int64_t default_integer_;
+  double default_real_;
+};
+
+// Finds a table field like Table::GetOptionalFieldOffset, but remembers
+// where it is for the last few vtables seen, for scanning many tables that
+// share a handful of vtables between them.
+class FieldOffsetCache {
+ public:
+  explicit FieldOffsetCache(voffset_t field) : field_(field), next_(0) {
+    for (size_t i = 0; i < kSize; i++) vtables_[i] = nullptr;
+  }
+
+  // Offset of the field from the start of "table", or 0 if not present.
+  voffset_t Get(const Table &table) {
+    auto vtable = table.GetVTable();
+    for (size_t i = 0; i < kSize; i++) {
+      if (vtables_[i] == vtable) return offsets_[i];
+    }
+    auto offset = table.GetOptionalFieldOffset(field_);
+    vtables_[next_] = vtable;
+    offsets_[next_] = offset;
+    next_ = (next_ + 1) % kSize;
+    return offset;
+  }
+
+ private:
+  static const size_t kSize = 4;
+  voffset_t field_;
+  size_t next_;
+  const uint8_t *vtables_[kSize];
+  voffset_t offsets_[kSize];
+};
+
+template<typename S, typename T>
+void ExtractColumnOf(const Vector<Offset<Table>> &vec,
+                     const reflection::Field &field, span<T> out) {
+  auto def = IsFloat(field.type()->base_type())
+                 ? static_cast<T>(field.default_real())
+                 : static_cast<T>(field.default_integer());
+  FieldOffsetCache cache(field.offset());
+  for (uoffset_t i = 0; i < vec.size(); i++) {
+    auto table = vec.Get(i);
+    auto offset = cache.Get(*table);
+    out[i] = offset ? static_cast<T>(ReadScalar<S>(
+                          reinterpret_cast<const uint8_t *>(table) + offset))
+                    : def;
+  }
+}
+
+// Reads the scalar "field" of every table in "vec" into "out", which must
+// have room for vec.size() elements, converted to T. Absent fields read as
+// their default. Much faster than calling GetAnyFieldF and friends for each
+// table, since the vtable lookups are shared by tables with the same vtable.
+// Returns false if "field" is not a scalar.
+template<typename T>
+bool ExtractColumn(const Vector<Offset<Table>> &vec,
+                   const reflection::Field &field, span<T> out) {
+  FLATBUFFERS_ASSERT(out.size() >= vec.size());
+  // clang-format off
+  #define FLATBUFFERS_EXTRACT(S) ExtractColumnOf<S, T>(vec, field, out)
+  switch (field.type()->base_type()) {
+    case reflection::UType:
+    case reflection::Bool:
+    case reflection::UByte:  FLATBUFFERS_EXTRACT(uint8_t);  break;
+    case reflection::Byte:   FLATBUFFERS_EXTRACT(int8_t);   break;
+    case reflection::Short:  FLATBUFFERS_EXTRACT(int16_t);  break;
+    case reflection::UShort: FLATBUFFERS_EXTRACT(uint16_t); break;
+    case reflection::Int:    FLATBUFFERS_EXTRACT(int32_t);  break;
+    case reflection::UInt:   FLATBUFFERS_EXTRACT(uint32_t); break;
+    case reflection::Long:   FLATBUFFERS_EXTRACT(int64_t);  break;
+    case reflection::ULong:  FLATBUFFERS_EXTRACT(uint64_t); break;
+    case reflection::Float:  FLATBUFFERS_EXTRACT(float);    break;
+    case reflection::Double: FLATBUFFERS_EXTRACT(double);   break;
+    default: return false;
+  }
+  #undef FLATBUFFERS_EXTRACT
+  // clang-format on
+  return true;
+}
+
 // ------------------------- SETTERS -------------------------
 
 // Set any scalar field, if you know its exact type.
@@ -454,6 +622,80 @@ void ResizeVector(const reflection::Schema &schema, uoffset_t newsize, T val,
   }
 }
 
+// Every call to SetString or ResizeAnyVector above walks the entire buffer
+// and moves all bytes after the edit, so N of them cost O(N * buffer size).
+// ResizeBatch instead records any number of such edits, and applies them all
+// in Apply() with a single walk over the buffer and a single copy.
+// All strings and vectors passed in must live inside "flatbuf" as it was
+// when the batch was created, and must not be modified until Apply(); edits
+// of the same string or vector replace earlier ones. Apply() invalidates all
+// pointers into "flatbuf", including pointer_inside_vector ones.
+// If your FlatBuffer's root table is not the schema's root table, you should
+// pass in your root_table type as well.
+class ResizeBatch {
+ public:
+  ResizeBatch(const reflection::Schema &schema, std::vector<uint8_t> *flatbuf,
+              const reflection::Object *root_table = nullptr)
+      : schema_(schema), buf_(*flatbuf), root_table_(root_table) {}
+
+  void SetString(const String *str, const std::string &val);
+
+  // New elements are set to zero, or to the "elem_size" bytes at "fill".
+  void ResizeAnyVector(const VectorOfAny *vec, uoffset_t newsize,
+                       uoffset_t num_elems, uoffset_t elem_size,
+                       const uint8_t *fill = nullptr);
+
+  template<typename T>
+  void ResizeVector(const Vector<T> *vec, uoffset_t newsize, T val) {
+    uint8_t fill[sizeof(T)];
+    if (flatbuffers::is_scalar<T>::value) {
+      WriteScalar(fill, val);
+    } else {  // struct
+      memcpy(fill, &val, sizeof(T));
+    }
+    ResizeAnyVector(reinterpret_cast<const VectorOfAny *>(vec), newsize,
+                    vec->size(), static_cast<uoffset_t>(sizeof(T)), fill);
+  }
+
+  // Number of edits recorded and not yet applied.
+  size_t size() const { return edits_.size(); }
+
+  // Applies all recorded edits to the buffer, and clears the batch.
+  void Apply();
+
+ private:
+  struct Edit {
+    uoffset_t obj;        // Location of the length field.
+    uoffset_t start;      // Insertion (or deletion end) point.
+    int delta;            // Bytes inserted at start, rounded to alignment.
+    uoffset_t old_bytes;  // Old size of the data in bytes.
+    uoffset_t newsize;    // New length field.
+    uoffset_t new_bytes;  // New size of the data in bytes.
+    bool is_string;
+    std::string payload;  // String contents, or the fill element.
+    bool operator<(const Edit &o) const { return start < o.start; }
+  };
+
+  void AddEdit(uoffset_t obj, uoffset_t old_bytes, uoffset_t newsize,
+               uoffset_t new_bytes, bool is_string, const std::string &payload);
+
+  uoffset_t Map(uoffset_t pos) const;
+  bool Erased(uoffset_t pos) const;
+  void FixOffset(uoffset_t loc, std::vector<uint8_t> &newbuf) const;
+  void FixTable(const reflection::Object &objectdef, uoffset_t table,
+                std::vector<uint8_t> &newbuf);
+
+  const reflection::Schema &schema_;
+  std::vector<uint8_t> &buf_;
+  const reflection::Object *root_table_;
+  std::vector<Edit> edits_;
+  // Filled in by Apply(): insertion points in order, and the sum of the
+  // deltas up to and including each.
+  std::vector<uoffset_t> starts_;
+  std::vector<int> shifts_;
+  std::vector<bool> visited_;
+};
+
 // Adds any new data (in the form of a new FlatBuffer) to an existing
 // FlatBuffer. This can be used when any of the above methods are not
 // sufficient, in particular for adding new tables and new fields.
@@ -465,6 +707,28 @@ void ResizeVector(const reflection::Schema &schema, uoffset_t newsize, T val,
 const uint8_t *AddFlatBuffer(std::vector<uint8_t> &flatbuf,
                              const uint8_t *newbuf, size_t newlen);
 
+// What Compact below did.
+struct CompactReport {
+  size_t old_size;
+  size_t new_size;
+  size_t vtables_merged;  // Vtables that were duplicates of another.
+  double seconds;
+};
+
+// Removes data from a FlatBuffer that is no longer reachable from its root,
+// such as what SetString, ResizeVector and AddFlatBuffer above leave behind,
+// and merges identical vtables. This is done in-place: live data is moved
+// down and offsets are adjusted, without copying the buffer like CopyTable.
+// Data is only moved by multiples of the largest alignment in the schema, so
+// gaps smaller than that remain.
+// Returns false (with the buffer unchanged) if the buffer contains union
+// values of a type not in the schema.
+// If your FlatBuffer's root table is not the schema's root table, you should
+// pass in your root_table type as well.
+bool Compact(const reflection::Schema &schema, std::vector<uint8_t> *flatbuf,
+             const reflection::Object *root_table = nullptr,
+             CompactReport *report = nullptr);
+
 inline bool SetFieldT(Table *table, const reflection::Field &field,
                       const uint8_t *val) {
   FLATBUFFERS_ASSERT(sizeof(uoffset_t) ==
@@ -489,6 +753,79 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
                                 const Table &table,
                                 bool use_string_pooling = false);
 
+// The engine behind CopyTable, for when you copy many tables or whole
+// buffers: it keeps its scratch memory between calls, can tell how large a
+// copy will get before making it, and can copy large vectors of tables in
+// parallel on threads of your choosing.
+class TableCopier {
+ public:
+  explicit TableCopier(const reflection::Schema &schema,
+                       bool use_string_pooling = false);
+
+  // Calls task(0) .. task(num_chunks - 1), possibly at the same time, and
+  // returns once all of them have finished. E.g. with std::thread:
+  //   [](size_t num_chunks, const std::function<void(size_t)> &task) {
+  //     std::vector<std::thread> threads;
+  //     for (size_t i = 1; i < num_chunks; i++)
+  //       threads.push_back(std::thread(task, i));
+  //     task(0);
+  //     for (auto &t : threads) t.join();
+  //   }
+  typedef std::function<void(size_t num_chunks,
+                             const std::function<void(size_t chunk)> &task)>
+      ParallelFor;
+
+  // Splits vectors of at least "min_elements" tables into up to
+  // "num_chunks" chunks, that "parallel_for" copies each into a
+  // FlatBufferBuilder of its own whose contents are then appended to the
+  // output. Vtables and pooled strings are not shared between those
+  // builders, so the result may be slightly larger.
+  void SetParallelism(const ParallelFor &parallel_for, size_t num_chunks,
+                      size_t min_elements) {
+    parallel_for_ = parallel_for;
+    num_chunks_ = num_chunks;
+    min_parallel_elements_ = min_elements;
+  }
+
+  // An upper bound of the size of a buffer holding a copy of this table,
+  // including the scratch memory of the builder and what Finish() adds, e.g.
+  // to size a FlatBufferBuilder such that it never reallocates.
+  size_t Measure(const reflection::Object &objectdef, const Table &table) const;
+
+  Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
+                                  const reflection::Object &objectdef,
+                                  const Table &table);
+
+  // Copies the value of a field of "table" that is not stored inline (a
+  // string, vector, table or union), and returns its offset. Returns 0 for
+  // scalars and structs.
+  uoffset_t CopyValue(FlatBufferBuilder &fbb,
+                      const reflection::Object &objectdef,
+                      const reflection::Field &fielddef, const Table &table);
+
+ private:
+  size_t MeasureTable(const reflection::Object &objectdef,
+                      const Table &table) const;
+  size_t MeasureVector(const reflection::Field &fielddef,
+                       const Table &table) const;
+  uoffset_t CopyVector(FlatBufferBuilder &fbb,
+                       const reflection::Field &fielddef, const Table &table);
+  void CopyTablesParallel(FlatBufferBuilder &fbb,
+                          const reflection::Object &objectdef,
+                          const Vector<Offset<Table>> &vec);
+
+  const reflection::Schema &schema_;
+  bool use_string_pooling_;
+  ParallelFor parallel_for_;
+  size_t num_chunks_;
+  size_t min_parallel_elements_;
+  size_t max_align_;   // Of any type in the schema.
+  size_t max_fields_;  // Of any table in the schema.
+  // Offsets of subobjects of the tables and vectors being copied, as a
+  // stack shared by all levels of recursion.
+  std::vector<uoffset_t> offsets_;
+};
+
 // Verifies the provided flatbuffer using reflection.
 // root should point to the root type for this flatbuffer.
 // buf should point to the start of flatbuffer data.
@@ -200,6 +200,12 @@ struct KeyValue FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(key()->c_str(), val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(key());
+  }
+  const flatbuffers::String *KeySortValue() const {
+    return key();
+  }
   const flatbuffers::String *value() const {
     return GetPointer<const flatbuffers::String *>(VT_VALUE);
   }
@@ -278,6 +284,12 @@ struct EnumVal FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(int64_t val) const {
     return static_cast<int>(value() > val) - static_cast<int>(value() < val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(value());
+  }
+  int64_t KeySortValue() const {
+    return value();
+  }
   const reflection::Object *object() const {
     return GetPointer<const reflection::Object *>(VT_OBJECT);
   }
@@ -387,6 +399,12 @@ struct Enum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(name());
+  }
+  const flatbuffers::String *KeySortValue() const {
+    return name();
+  }
   const flatbuffers::Vector<flatbuffers::Offset<reflection::EnumVal>> *values() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<reflection::EnumVal>> *>(VT_VALUES);
   }
@@ -523,6 +541,12 @@ struct Field FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(name());
+  }
+  const flatbuffers::String *KeySortValue() const {
+    return name();
+  }
   const reflection::Type *type() const {
     return GetPointer<const reflection::Type *>(VT_TYPE);
   }
@@ -716,6 +740,12 @@ struct Object FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(name());
+  }
+  const flatbuffers::String *KeySortValue() const {
+    return name();
+  }
   const flatbuffers::Vector<flatbuffers::Offset<reflection::Field>> *fields() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<reflection::Field>> *>(VT_FIELDS);
   }
@@ -854,6 +884,12 @@ struct RPCCall FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(name());
+  }
+  const flatbuffers::String *KeySortValue() const {
+    return name();
+  }
   const reflection::Object *request() const {
     return GetPointer<const reflection::Object *>(VT_REQUEST);
   }
@@ -969,6 +1005,12 @@ struct Service FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(name());
+  }
+  const flatbuffers::String *KeySortValue() const {
+    return name();
+  }
   const flatbuffers::Vector<flatbuffers::Offset<reflection::RPCCall>> *calls() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<reflection::RPCCall>> *>(VT_CALLS);
   }
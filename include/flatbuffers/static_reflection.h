@@ -0,0 +1,353 @@
+/*
+ * Copyright 2021 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_STATIC_REFLECTION_H_
+#define FLATBUFFERS_STATIC_REFLECTION_H_
+
+// Generic algorithms over the tables and structs of code generated with
+// `--cpp-std c++17 --cpp-static-reflection`, using only the compile-time
+// `Traits` and `get_field<Index>()` of the generated types. Unlike
+// reflection.h and minireflect.h, nothing is looked up at runtime: every
+// field access is resolved at compile time.
+//
+// Union values are typed `const void *` in these traits, so their type is
+// only known at runtime: `StaticToJson` leaves them out (but not their type
+// fields), and the other algorithms reject tables with unions at compile
+// time.
+//
+// Requires C++17.
+
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/util.h"
+
+namespace flatbuffers {
+
+namespace internal {
+
+// Tables and structs generated with static reflection have a Traits member.
+template<typename T, typename = void>
+struct is_static_reflected : std::false_type {};
+
+template<typename T>
+struct is_static_reflected<T, std::void_t<typename T::Traits>>
+    : std::true_type {};
+
+template<typename T> struct is_static_vector : std::false_type {};
+
+template<typename T> struct is_static_vector<Vector<T>> : std::true_type {};
+
+// Vectors of scalars, which can be hashed in bulk.
+template<typename T> struct is_static_scalar_vector : std::false_type {};
+
+template<typename T>
+struct is_static_scalar_vector<Vector<T>>
+    : std::integral_constant<bool, std::is_scalar_v<T> &&
+                                       !std::is_pointer_v<T>> {};
+
+template<typename T> struct is_static_array : std::false_type {};
+
+template<typename T, uint16_t N>
+struct is_static_array<Array<T, N>> : std::true_type {};
+
+template<typename T> struct is_static_optional : std::false_type {};
+
+template<typename T>
+struct is_static_optional<Optional<T>> : std::true_type {};
+
+template<typename T> struct static_dependent_false : std::false_type {};
+
+template<typename T>
+using static_field_t = std::remove_cv_t<std::remove_pointer_t<T>>;
+
+template<typename T, typename F, size_t... Indexes>
+void ForEachFieldImpl(const T &obj, F &f, std::index_sequence<Indexes...>) {
+  (f(T::Traits::field_names[Indexes], obj.template get_field<Indexes>()),
+   ...);
+}
+
+template<typename T, typename F, size_t... Indexes>
+void ForEachFieldPairImpl(const T &a, const T &b, F &f,
+                          std::index_sequence<Indexes...>) {
+  (f(T::Traits::field_names[Indexes], a.template get_field<Indexes>(),
+     b.template get_field<Indexes>()),
+   ...);
+}
+
+}  // namespace internal
+
+/// @brief Calls `f(name, value)` for every field of a table or struct, in
+/// declaration order, with `value` as returned by the field's accessor.
+template<typename T, typename F> void ForEachField(const T &obj, F f) {
+  internal::ForEachFieldImpl(
+      obj, f, std::make_index_sequence<T::Traits::fields_number>{});
+}
+
+/// @brief Calls `f(name, a_value, b_value)` for every field of two tables
+/// or structs of the same type.
+template<typename T, typename F>
+void ForEachFieldPair(const T &a, const T &b, F f) {
+  internal::ForEachFieldPairImpl(
+      a, b, f, std::make_index_sequence<T::Traits::fields_number>{});
+}
+
+/// @brief Deep comparison of two field values: absent fields are equal to
+/// each other only, and strings, vectors, tables and structs are compared by
+/// content. Tables with union fields can not be compared.
+template<typename V> bool StaticValueEqual(const V &a, const V &b) {
+  if constexpr (std::is_pointer_v<V>) {
+    using P = internal::static_field_t<V>;
+    if constexpr (std::is_void_v<P>) {
+      static_assert(internal::static_dependent_false<V>::value,
+                    "StaticEqual and StaticDiff do not support unions");
+      return false;
+    } else {
+      if (!a || !b) return a == b;
+      return a == b || StaticValueEqual<P>(*a, *b);
+    }
+  } else if constexpr (internal::is_static_reflected<V>::value) {
+    bool equal = true;
+    ForEachFieldPair(a, b, [&equal](const char *, const auto &x,
+                                    const auto &y) {
+      equal = equal && StaticValueEqual(x, y);
+    });
+    return equal;
+  } else if constexpr (std::is_same_v<V, String>) {
+    return a.size() == b.size() && !memcmp(a.data(), b.data(), a.size());
+  } else if constexpr (internal::is_static_vector<V>::value ||
+                       internal::is_static_array<V>::value) {
+    if (a.size() != b.size()) return false;
+    for (uoffset_t i = 0; i < a.size(); i++) {
+      if (!StaticValueEqual(a.Get(i), b.Get(i))) return false;
+    }
+    return true;
+  } else {
+    // Scalars, enums and optional scalars.
+    return a == b;
+  }
+}
+
+/// @brief Compares two tables or structs field by field, recursively.
+template<typename T> bool StaticEqual(const T &a, const T &b) {
+  static_assert(internal::is_static_reflected<T>::value,
+                "T must be generated with --cpp-static-reflection");
+  return StaticValueEqual(a, b);
+}
+
+/// @brief Structural hash of a field value, consistent with
+/// `StaticValueEqual`: equal values have equal hashes. Tables with union
+/// fields can not be hashed.
+template<typename V> uint64_t StaticValueHash(const V &v) {
+  if constexpr (std::is_pointer_v<V>) {
+    using P = internal::static_field_t<V>;
+    if constexpr (std::is_void_v<P>) {
+      static_assert(internal::static_dependent_false<V>::value,
+                    "StaticHash does not support unions");
+      return 0;
+    } else {
+      return v ? StaticValueHash<P>(*v) : kHashAbsent;
+    }
+  } else if constexpr (internal::is_static_reflected<V>::value) {
+    uint64_t hash = V::Traits::fields_number;
+    ForEachField(v, [&hash](const char *, const auto &field) {
+      hash = HashCombine(hash, StaticValueHash(field));
+    });
+    return hash;
+  } else if constexpr (std::is_same_v<V, String>) {
+    return HashString(&v);
+  } else if constexpr (internal::is_static_scalar_vector<V>::value) {
+    return HashScalars(&v);
+  } else if constexpr (internal::is_static_vector<V>::value ||
+                       internal::is_static_array<V>::value) {
+    uint64_t hash = HashKey(v.size());
+    for (uoffset_t i = 0; i < v.size(); i++) {
+      hash = HashCombine(hash, StaticValueHash(v.Get(i)));
+    }
+    return hash;
+  } else if constexpr (internal::is_static_optional<V>::value) {
+    return HashOptional(v);
+  } else {
+    return HashKey(v);
+  }
+}
+
+/// @brief Structural hash of a table or struct, combining the hashes of all
+/// its fields recursively.
+template<typename T> uint64_t StaticHash(const T &obj) {
+  static_assert(internal::is_static_reflected<T>::value,
+                "T must be generated with --cpp-static-reflection");
+  return StaticValueHash(obj);
+}
+
+/// @brief Appends a field value as JSON to `json`. Returns false without
+/// appending anything if the value is absent.
+template<typename V> bool StaticValueToJson(const V &v, std::string *json) {
+  if constexpr (std::is_pointer_v<V>) {
+    using P = internal::static_field_t<V>;
+    if constexpr (std::is_void_v<P>) {
+      return false;  // Union value, its type is not statically known.
+    } else {
+      return v && StaticValueToJson<P>(*v, json);
+    }
+  } else if constexpr (internal::is_static_reflected<V>::value) {
+    *json += '{';
+    bool first = true;
+    ForEachField(v, [json, &first](const char *name, const auto &field) {
+      const auto size = json->size();
+      if (!first) *json += ',';
+      *json += '"';
+      *json += name;
+      *json += "\":";
+      if (StaticValueToJson(field, json)) {
+        first = false;
+      } else {
+        json->resize(size);
+      }
+    });
+    *json += '}';
+    return true;
+  } else if constexpr (std::is_same_v<V, String>) {
+    return EscapeString(v.c_str(), v.size(), json, true, true);
+  } else if constexpr (internal::is_static_vector<V>::value ||
+                       internal::is_static_array<V>::value) {
+    *json += '[';
+    for (uoffset_t i = 0; i < v.size(); i++) {
+      if (i) *json += ',';
+      if (!StaticValueToJson(v.Get(i), json)) *json += "null";
+    }
+    *json += ']';
+    return true;
+  } else if constexpr (internal::is_static_optional<V>::value) {
+    return v && StaticValueToJson(*v, json);
+  } else if constexpr (std::is_same_v<V, bool>) {
+    *json += v ? "true" : "false";
+    return true;
+  } else if constexpr (std::is_enum_v<V>) {
+    *json += NumToString(static_cast<std::underlying_type_t<V>>(v));
+    return true;
+  } else {
+    *json += NumToString(v);
+    return true;
+  }
+}
+
+/// @brief Converts a table or struct to compact JSON, leaving out absent
+/// fields. Enums are written as numbers, since their names are not part of
+/// the static traits.
+template<typename T> std::string StaticToJson(const T &obj) {
+  static_assert(internal::is_static_reflected<T>::value,
+                "T must be generated with --cpp-static-reflection");
+  std::string json;
+  StaticValueToJson(obj, &json);
+  return json;
+}
+
+template<typename T> Offset<T> StaticCopy(FlatBufferBuilder &fbb, const T &obj);
+
+namespace internal {
+
+// Converts a field value read from one buffer to the argument that
+// `Traits::Create` takes for it when building into `fbb`.
+template<typename V> auto StaticCopyValue(FlatBufferBuilder &fbb, const V &v) {
+  if constexpr (std::is_pointer_v<V>) {
+    using P = static_field_t<V>;
+    if constexpr (std::is_void_v<P>) {
+      static_assert(static_dependent_false<V>::value,
+                    "StaticCopy does not support unions");
+    } else if constexpr (std::is_same_v<P, String>) {
+      return v ? fbb.CreateString(v) : Offset<String>();
+    } else if constexpr (is_static_vector<P>::value) {
+      using E = typename P::return_type;
+      using R = decltype(StaticCopyValue(fbb, std::declval<E>()));
+      if (!v) return Offset<Vector<R>>();
+      if constexpr (std::is_pointer_v<E> &&
+                    std::is_same_v<R, std::remove_cv_t<E>>) {
+        // Structs are copied in place.
+        return fbb.CreateVectorOfStructs(
+            reinterpret_cast<const static_field_t<E> *>(v->Data()),
+            v->size());
+      } else if constexpr (std::is_scalar_v<E> && !std::is_pointer_v<E>) {
+#if FLATBUFFERS_LITTLEENDIAN
+        return fbb.CreateVector(v->data(), v->size());
+#else
+        std::vector<E> elems(v->begin(), v->end());
+        return fbb.CreateVector(elems);
+#endif
+      } else {
+        // Strings and tables are copied recursively.
+        std::vector<R> elems;
+        elems.reserve(v->size());
+        for (uoffset_t i = 0; i < v->size(); i++) {
+          elems.push_back(StaticCopyValue(fbb, v->Get(i)));
+        }
+        return fbb.CreateVector(elems);
+      }
+    } else if constexpr (std::is_base_of_v<Table, P>) {
+      return v ? StaticCopy(fbb, *v) : Offset<P>();
+    } else {
+      // Structs are passed by pointer and copied by Create.
+      return v;
+    }
+  } else {
+    // Scalars, enums and optional scalars.
+    return v;
+  }
+}
+
+template<typename T, size_t... Indexes>
+Offset<T> StaticCopyImpl(FlatBufferBuilder &fbb, const T &obj,
+                         std::index_sequence<Indexes...>) {
+  // Braced initialization evaluates the fields in order, so children are
+  // serialized in the order of their declaration.
+  std::tuple<decltype(
+      StaticCopyValue(fbb, obj.template get_field<Indexes>()))...>
+      args{ StaticCopyValue(fbb, obj.template get_field<Indexes>())... };
+  return std::apply(
+      [&fbb](const auto &... a) { return T::Traits::Create(fbb, a...); },
+      args);
+}
+
+}  // namespace internal
+
+/// @brief Deep copies a table into `fbb` through its generated `Create`
+/// function, re-serializing all strings, vectors and sub-tables it refers
+/// to. Returns the offset of the new table. Tables with union fields can not
+/// be copied.
+template<typename T>
+Offset<T> StaticCopy(FlatBufferBuilder &fbb, const T &obj) {
+  static_assert(std::is_base_of_v<Table, T>, "T must be a table");
+  return internal::StaticCopyImpl(
+      fbb, obj, std::make_index_sequence<T::Traits::fields_number>{});
+}
+
+/// @brief Calls `on_diff(name)` for every field whose value differs between
+/// `a` and `b`, using the deep comparison of `StaticValueEqual`.
+template<typename T, typename F>
+void StaticDiff(const T &a, const T &b, F on_diff) {
+  ForEachFieldPair(a, b,
+                   [&on_diff](const char *name, const auto &x, const auto &y) {
+                     if (!StaticValueEqual(x, y)) on_diff(name);
+                   });
+}
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_STATIC_REFLECTION_H_
@@ -18,6 +18,7 @@
 #define FLATBUFFERS_UTIL_H_
 
 #include <errno.h>
+#include <stdio.h>
 
 #include "flatbuffers/base.h"
 #include "flatbuffers/stl_emulation.h"
@@ -26,7 +27,6 @@
 #  include <sstream>
 #else  // FLATBUFFERS_PREFER_PRINTF
 #  include <float.h>
-#  include <stdio.h>
 #endif  // FLATBUFFERS_PREFER_PRINTF
 
 #include <iomanip>
@@ -195,6 +195,43 @@ template<> inline std::string NumToString<float>(float t) {
   return FloatToString(t, 6);
 }
 
+// Allocation-free versions of the above, for hot output paths. They write
+// the same text into `buf` and return its length, without a terminating 0.
+
+// `buf` must hold at least 20 characters.
+inline size_t UIntToChars(uint64_t t, char *buf) {
+  char digits[20];
+  size_t n = 0;
+  do {
+    digits[n++] = static_cast<char>('0' + t % 10);
+    t /= 10;
+  } while (t);
+  for (size_t i = 0; i < n; i++) buf[i] = digits[n - 1 - i];
+  return n;
+}
+
+// `buf` must hold at least 20 characters.
+inline size_t IntToChars(int64_t t, char *buf) {
+  if (t >= 0) return UIntToChars(static_cast<uint64_t>(t), buf);
+  buf[0] = '-';
+  return UIntToChars(0 - static_cast<uint64_t>(t), buf + 1) + 1;
+}
+
+// Formats like FloatToString(), with snprintf. Like the
+// FLATBUFFERS_PREFER_PRINTF build, this follows the C locale. 330 characters
+// are enough for any double with a precision up to 17.
+inline size_t FloatToChars(double t, int precision, char *buf, size_t size) {
+  const int n = snprintf(buf, size, "%.*f", precision, t);
+  if (n <= 0) return 0;
+  size_t len = static_cast<size_t>(n);
+  if (len >= size) len = size - 1;  // Truncated.
+  // Strip trailing zeroes. If it is a whole number, keep one zero.
+  size_t p = len;
+  while (p && buf[p - 1] == '0') p--;
+  if (p && p < len) len = p + (buf[p - 1] == '.' ? 1 : 0);
+  return len;
+}
+
 // Convert an integer value to a hexadecimal string.
 // The returned string length is always xdigits long, prefixed by 0 digits.
 // For example, IntToStringHex(0x23, 8) returns the string "00000023".
@@ -420,6 +457,12 @@ bool FileExists(const char *name);
 // Check if "name" exists and it is also a directory.
 bool DirExists(const char *name);
 
+// Get the size and modification time of file "name", which tell whether
+// it was written since, without reading it. Returns false if the file
+// can't be found, or if a custom LoadFile function is set, since the files
+// may then not come from the file system.
+bool FileSizeAndTime(const char *name, uint64_t *size, int64_t *mtime);
+
 // Load file "name" into "buf" returning true if successful
 // false otherwise.  If "binary" is false data is read
 // using ifstream's text mode, otherwise data is read with
@@ -651,6 +694,85 @@ inline bool EscapeString(const char *s, size_t length, std::string *_text,
   return true;
 }
 
+// Helpers for the JSON printers generated by flatc --gen-json-printer.
+// A sink is any object with an append(const char *, size_t) method, such as
+// std::string.
+
+// Appends the separator that precedes a field, followed by its pre-escaped
+// key, e.g. "\"name\":".
+template<typename Sink, size_t N>
+inline void JsonAppendKey(Sink &sink, char &separator, const char (&key)[N]) {
+  sink.append(&separator, 1);
+  separator = ',';
+  sink.append(key, N - 1);
+}
+
+template<typename Sink> inline void JsonAppendBool(Sink &sink, bool val) {
+  if (val)
+    sink.append("true", 4);
+  else
+    sink.append("false", 5);
+}
+
+// Numbers are written as NumToString() does, without allocating.
+template<typename Sink, typename T>
+inline void JsonAppendNumber(Sink &sink, T val) {
+  char buf[20];
+  if (flatbuffers::is_unsigned<T>::value)
+    sink.append(buf, UIntToChars(static_cast<uint64_t>(val), buf));
+  else
+    sink.append(buf, IntToChars(static_cast<int64_t>(val), buf));
+}
+
+// JSON has no NaN or infinities, these are written as null. The difference
+// of such a value with itself is NaN, and not equal to 0.
+template<typename Sink> inline void JsonAppendNumber(Sink &sink, float val) {
+  char buf[330];
+  if (val - val == 0)
+    sink.append(buf, FloatToChars(val, 6, buf, sizeof(buf)));
+  else
+    sink.append("null", 4);
+}
+
+template<typename Sink> inline void JsonAppendNumber(Sink &sink, double val) {
+  char buf[330];
+  if (val - val == 0)
+    sink.append(buf, FloatToChars(val, 12, buf, sizeof(buf)));
+  else
+    sink.append("null", 4);
+}
+
+// Enum values are written by name if they have one, as numbers otherwise.
+template<typename Sink, typename T>
+inline void JsonAppendEnum(Sink &sink, const char *name, T val) {
+  if (name && *name) {
+    sink.append("\"", 1);
+    sink.append(name, strlen(name));
+    sink.append("\"", 1);
+  } else {
+    JsonAppendNumber(sink, val);
+  }
+}
+
+// Returns false if the string is not valid UTF-8.
+template<typename Sink>
+inline bool JsonAppendString(Sink &sink, const char *s, size_t length) {
+  size_t i = 0;
+  while (i < length && s[i] >= ' ' && s[i] <= '~' && s[i] != '\"' &&
+         s[i] != '\\')
+    i++;
+  if (i == length) {  // Nothing to escape.
+    sink.append("\"", 1);
+    sink.append(s, length);
+    sink.append("\"", 1);
+    return true;
+  }
+  std::string escaped;
+  if (!EscapeString(s, length, &escaped, false, false)) return false;
+  sink.append(escaped.c_str(), escaped.size());
+  return true;
+}
+
 inline std::string BufferToHexText(const void *buffer, size_t buffer_size,
                                    size_t max_length,
                                    const std::string &wrapped_line_prefix,
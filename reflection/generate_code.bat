@@ -16,3 +16,4 @@ set buildtype=Release
 if "%1"=="-b" set buildtype=%2
 
 ..\%buildtype%\flatc.exe --cpp --cpp-std c++0x --no-prefix -o ../include/flatbuffers reflection.fbs || exit /b 1
+..\%buildtype%\flatc.exe --cpp --cpp-std c++0x --no-prefix -o ../include/flatbuffers patch.fbs || exit /b 1
@@ -16,16 +16,19 @@
 set -e
 
 tempDir="../include/flatbuffers/.tmp"
-originalFile="../include/flatbuffers/reflection_generated.h"
-newFile="$tempDir/reflection_generated.h"
 
-../flatc -c --cpp-std c++0x --no-prefix -o $tempDir reflection.fbs
+for schema in reflection patch; do
+  originalFile="../include/flatbuffers/${schema}_generated.h"
+  newFile="$tempDir/${schema}_generated.h"
 
-if [ -f "$newFile" ]; then
-  if ! cmp -s "$originalFile" "$newFile"; then
-    mv $newFile $originalFile
-  else
-    rm $newFile
+  ../flatc -c --cpp-std c++0x --no-prefix -o $tempDir $schema.fbs
+
+  if [ -f "$newFile" ]; then
+    if ! cmp -s "$originalFile" "$newFile"; then
+      mv $newFile $originalFile
+    else
+      rm $newFile
+    fi
   fi
-  rmdir $tempDir
-fi
+done
+rmdir $tempDir
@@ -133,6 +133,7 @@ struct EquipmentUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, Equipment type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, Equipment _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MyGame::Sample::WeaponT *AsWeapon() {
@@ -568,16 +569,15 @@ inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolv
 inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = pos(); if (_e) _o->pos = flatbuffers::unique_ptr<MyGame::Sample::Vec3>(new MyGame::Sample::Vec3(*_e)); }
+  { auto _e = pos(); if (_e) { if (_o->pos) *_o->pos = *_e; else _o->pos = flatbuffers::unique_ptr<MyGame::Sample::Vec3>(new MyGame::Sample::Vec3(*_e)); } else _o->pos = nullptr; }
   { auto _e = mana(); _o->mana = _e; }
   { auto _e = hp(); _o->hp = _e; }
-  { auto _e = name(); if (_e) _o->name = _e->str(); }
-  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } }
+  { auto _e = name(); if (_e) _o->name.assign(_e->c_str(), _e->size()); else _o->name.clear(); }
+  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } else _o->inventory.clear(); }
   { auto _e = color(); _o->color = _e; }
-  { auto _e = weapons(); if (_e) { _o->weapons.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->weapons[_i] = flatbuffers::unique_ptr<MyGame::Sample::WeaponT>(_e->Get(_i)->UnPack(_resolver)); } } }
-  { auto _e = equipped_type(); _o->equipped.type = _e; }
-  { auto _e = equipped(); if (_e) _o->equipped.value = MyGame::Sample::EquipmentUnion::UnPack(_e, equipped_type(), _resolver); }
-  { auto _e = path(); if (_e) { _o->path.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->path[_i] = *_e->Get(_i); } } }
+  { auto _e = weapons(); if (_e) { _o->weapons.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->weapons[_i]) _e->Get(_i)->UnPackTo(_o->weapons[_i].get(), _resolver); else _o->weapons[_i] = flatbuffers::unique_ptr<MyGame::Sample::WeaponT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->weapons.clear(); }
+  { auto _e = equipped(); if (_e) _o->equipped.UnPackTo(_e, equipped_type(), _resolver); else _o->equipped.Reset(); }
+  { auto _e = path(); if (_e) { _o->path.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->path)); } else _o->path.clear(); }
 }
 
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -621,7 +621,7 @@ inline WeaponT *Weapon::UnPack(const flatbuffers::resolver_function_t *_resolver
 inline void Weapon::UnPackTo(WeaponT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = name(); if (_e) _o->name = _e->str(); }
+  { auto _e = name(); if (_e) _o->name.assign(_e->c_str(), _e->size()); else _o->name.clear(); }
   { auto _e = damage(); _o->damage = _e; }
 }
 
@@ -676,6 +676,23 @@ inline void *EquipmentUnion::UnPack(const void *obj, Equipment type, const flatb
   }
 }
 
+inline void EquipmentUnion::UnPackTo(const void *obj, Equipment _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case Equipment_Weapon: {
+        auto ptr = reinterpret_cast<const MyGame::Sample::Weapon *>(obj);
+        auto dst = reinterpret_cast<MyGame::Sample::WeaponT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
 inline flatbuffers::Offset<void> EquipmentUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Equipment_Weapon: {
@@ -4,3 +4,4 @@ do
   git clang-format HEAD^ -- include/flatbuffers/* src/*.cpp tests/*.cpp samples/*.cpp grpc/src/compiler/schema_interface.h grpc/tests/*.cpp
 done
 git checkout include/flatbuffers/reflection_generated.h
+git checkout include/flatbuffers/patch_generated.h
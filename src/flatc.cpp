@@ -16,7 +16,10 @@
 
 #include "flatbuffers/flatc.h"
 
+#include <atomic>
+#include <chrono>
 #include <list>
+#include <thread>
 
 namespace flatbuffers {
 
@@ -47,6 +50,78 @@ void FlatCompiler::LoadBinarySchema(flatbuffers::Parser &parser,
   }
 }
 
+size_t FlatCompiler::ConvertJsonFiles(
+    const Parser &schema, const std::vector<std::string> &filenames,
+    const std::vector<bool> &generator_enabled, const std::string &output_path,
+    size_t jobs) const {
+  struct Result {
+    Result() : size(0) {}
+    size_t size;
+    std::string warning;
+    std::string error;
+  };
+  std::vector<Result> results(filenames.size());
+  std::atomic<size_t> next_file(0);
+  // Like a serial run, no new file is started once one has failed.
+  std::atomic<bool> failed(false);
+  auto worker = [&]() {
+    while (!failed) {
+      const size_t i = next_file++;
+      if (i >= filenames.size()) break;
+      auto &filename = filenames[i];
+      auto &result = results[i];
+      std::string contents;
+      if (!flatbuffers::LoadFile(filename.c_str(), true, &contents)) {
+        result.error = "unable to load file: " + filename;
+        failed = true;
+        continue;
+      }
+      result.size = contents.size();
+      if (contents.length() != strlen(contents.c_str())) {
+        result.error = "input file appears to be binary: " + filename;
+        failed = true;
+        continue;
+      }
+      flatbuffers::Parser parser(schema, schema.opts);
+      if (!parser.ParseJson(contents.c_str(), filename.c_str())) {
+        result.error = parser.error_;
+        failed = true;
+        continue;
+      }
+      result.warning = parser.error_;
+      std::string filebase =
+          flatbuffers::StripPath(flatbuffers::StripExtension(filename));
+      for (size_t g = 0; g < params_.num_generators; ++g) {
+        const Generator &generator = params_.generators[g];
+        if (!generator_enabled[g] || generator.schema_only) continue;
+        parser.opts.lang = generator.lang;
+        if (!generator.generate(parser, output_path, filebase)) {
+          result.error = std::string("Unable to generate ") +
+                         generator.lang_name + " for " + filebase;
+          failed = true;
+          break;
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < std::min(jobs, filenames.size()); ++i) {
+    workers.push_back(std::thread(worker));
+  }
+  worker();
+  for (auto it = workers.begin(); it != workers.end(); ++it) it->join();
+
+  // Report in input order, so the output doesn't depend on scheduling.
+  size_t total_size = 0;
+  for (auto it = results.begin(); it != results.end(); ++it) {
+    if (!it->warning.empty()) Warn(it->warning, false);
+    if (!it->error.empty()) Error(it->error, false);
+    total_size += it->size;
+  }
+  return total_size;
+}
+
 void FlatCompiler::Warn(const std::string &warn, bool show_exe_name) const {
   params_.warn_fn(this, warn, show_exe_name);
 }
@@ -90,6 +165,9 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "  --unknown-json         Allow fields in JSON that are not defined in the\n"
     "                         schema. These fields will be discared when generating\n"
     "                         binaries.\n"
+    "  --json-direct-scalars  Write JSON tables that only have scalar fields\n"
+    "                         directly while parsing, in field order. Faster,\n"
+    "                         but may produce larger binaries.\n"
     "  --no-prefix            Don\'t prefix enum values with the enum type in C++.\n"
     "  --scoped-enums         Use C++11 style scoped and strongly typed enums.\n"
     "                         also implies --no-prefix.\n"
@@ -103,6 +181,12 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "  --gen-name-strings     Generate type name functions for C++ and Rust.\n"
     "  --gen-object-api       Generate an additional object-based API.\n"
     "  --gen-compare          Generate operator== for object-based API types.\n"
+    "  --gen-json-printer     Generate a ToJson() function per table and struct\n"
+    "                         that writes it as JSON without a schema (C++ only).\n"
+    "  --gen-json-parser      Generate a FromJson() function per table and struct\n"
+    "                         that reads it from JSON without a schema (C++ only).\n"
+    "  --gen-hash             Generate a structural Hash() function per table and\n"
+    "                         struct, and std::hash for object-based API types.\n"
     "  --gen-nullable         Add Clang _Nullable for C++ pointer. or @Nullable for Java\n"
     "  --java-checkerframe    work Add @Pure for Java.\n"
     "  --gen-generated        Add @Generated annotation for Java\n"
@@ -121,6 +205,13 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "                         (see the --cpp-str-flex-ctor option to change this behavior).\n"
     "  --cpp-str-flex-ctor    Don't construct custom string types by passing std::string\n"
     "                         from Flatbuffers, but (char* + length).\n"
+    "  --cpp-arena            Allocate object API types, their vectors and strings\n"
+    "                         from the flatbuffers::Arena current on the thread, and\n"
+    "                         generate UnPack/UnPackTo overloads that take an arena.\n"
+    "  --gen-partial-unpack   Generate an UnPackTo overload per table that only unpacks\n"
+    "                         the fields in a flatbuffers::FieldSet.\n"
+    "  --gen-static-layout    Generate a CreateXStaticLayout function per table that\n"
+    "                         writes all fields into a layout computed by flatc.\n"
     "  --cpp-std CPP_STD      Generate a C++ code using features of selected C++ standard.\n"
     "                         Supported CPP_STD values:\n"
     "                          * 'c++0x' - generate code compatible with old compilers;\n"
@@ -169,6 +260,10 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "  --flexbuffers          Used with \"binary\" and \"json\" options, it generates\n"
     "                         data using schema-less FlexBuffers.\n"
     "  --no-warnings          Inhibit all warning messages.\n"
+    "  --jobs N               Convert JSON files with N parallel worker threads.\n"
+    "                         The schema is parsed once and shared by all jobs.\n"
+    "  --jobs-stats           Print the JSON conversion throughput of --jobs\n"
+    "                         to stderr.\n"
     "FILEs may be schemas (must end in .fbs), binary schemas (must end in .bfbs),\n"
     "or JSON files (conforming to preceding schema). FILEs after the -- must be\n"
     "binary flatbuffer format files.\n"
@@ -200,6 +295,8 @@ int FlatCompiler::Compile(int argc, const char **argv) {
   std::vector<bool> generator_enabled(params_.num_generators, false);
   size_t binary_files_from = std::numeric_limits<size_t>::max();
   std::string conform_to_schema;
+  uint32_t jobs = 1;
+  bool jobs_stats = false;
 
   for (int argi = 0; argi < argc; argi++) {
     std::string arg = argv[argi];
@@ -247,6 +344,8 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         opts.output_default_scalars_in_json = true;
       } else if (arg == "--unknown-json") {
         opts.skip_unexpected_fields_in_json = true;
+      } else if (arg == "--json-direct-scalars") {
+        opts.json_direct_scalar_tables = true;
       } else if (arg == "--no-prefix") {
         opts.prefixed_enums = false;
       } else if (arg == "--scoped-enums") {
@@ -262,6 +361,12 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         opts.generate_object_based_api = true;
       } else if (arg == "--gen-compare") {
         opts.gen_compare = true;
+      } else if (arg == "--gen-json-printer") {
+        opts.gen_json_printer = true;
+      } else if (arg == "--gen-json-parser") {
+        opts.gen_json_parser = true;
+      } else if (arg == "--gen-hash") {
+        opts.gen_hash = true;
       } else if (arg == "--cpp-include") {
         if (++argi >= argc) Error("missing include following: " + arg, true);
         opts.cpp_includes.push_back(argv[argi]);
@@ -273,6 +378,12 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         opts.cpp_object_api_string_type = argv[argi];
       } else if (arg == "--cpp-str-flex-ctor") {
         opts.cpp_object_api_string_flexible_constructor = true;
+      } else if (arg == "--cpp-arena") {
+        opts.cpp_object_api_arena = true;
+      } else if (arg == "--gen-partial-unpack") {
+        opts.gen_partial_unpack = true;
+      } else if (arg == "--gen-static-layout") {
+        opts.gen_static_layout = true;
       } else if (arg == "--no-cpp-direct-copy") {
         opts.cpp_direct_copy = false;
       } else if (arg == "--gen-nullable") {
@@ -365,6 +476,12 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         opts.cpp_std = arg.substr(std::string("--cpp-std=").size());
       } else if (arg == "--cpp-static-reflection") {
         opts.cpp_static_reflection = true;
+      } else if (arg == "--jobs") {
+        if (++argi >= argc) Error("missing job count following: " + arg, true);
+        if (!StringToNumber(argv[argi], &jobs) || !jobs)
+          Error("invalid job count: " + std::string(argv[argi]), true);
+      } else if (arg == "--jobs-stats") {
+        jobs_stats = true;
       } else {
         for (size_t i = 0; i < params_.num_generators; ++i) {
           if (arg == params_.generators[i].generator_opt_long ||
@@ -410,8 +527,40 @@ int FlatCompiler::Compile(int argc, const char **argv) {
 
   std::unique_ptr<flatbuffers::Parser> parser(new flatbuffers::Parser(opts));
 
+  // JSON files that follow a schema can be converted in parallel.
+  auto is_json_file = [&](std::vector<std::string>::const_iterator it) {
+    auto ext = flatbuffers::GetExtension(*it);
+    return static_cast<size_t>(it - filenames.begin()) < binary_files_from &&
+           ext != "fbs" && ext != "proto" &&
+           ext != reflection::SchemaExtension();
+  };
+  const bool parallel_json = jobs > 1 && !print_make_rules && !grpc_enabled &&
+                             !opts.use_flexbuffers && !opts.proto_mode;
+  size_t parallel_files = 0;
+  size_t parallel_bytes = 0;
+  double parallel_seconds = 0;
+
   for (auto file_it = filenames.begin(); file_it != filenames.end();
        ++file_it) {
+    if (parallel_json && !parser->structs_.vec.empty() &&
+        is_json_file(file_it)) {
+      auto batch_end = file_it;
+      while (batch_end != filenames.end() && is_json_file(batch_end))
+        ++batch_end;
+      std::vector<std::string> batch(file_it, batch_end);
+      flatbuffers::EnsureDirExists(output_path);
+      auto start = std::chrono::steady_clock::now();
+      parallel_bytes += ConvertJsonFiles(*parser.get(), batch,
+                                         generator_enabled, output_path, jobs);
+      parallel_seconds += std::chrono::duration<double>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+      parallel_files += batch.size();
+      parser->MarkGenerated();
+      file_it = batch_end - 1;
+      continue;
+    }
+
     auto &filename = *file_it;
     std::string contents;
     if (!flatbuffers::LoadFile(filename.c_str(), true, &contents))
@@ -548,6 +697,19 @@ int FlatCompiler::Compile(int argc, const char **argv) {
     // in any files coming up next.
     parser->MarkGenerated();
   }
+
+  if (jobs_stats && parallel_files) {
+    const double mb = static_cast<double>(parallel_bytes) / (1024 * 1024);
+    parallel_seconds = std::max(parallel_seconds, 1e-6);
+    fprintf(stderr,
+            "converted %s JSON files (%s MB) in %s s: %s files/s, %s MB/s "
+            "using %s jobs\n",
+            NumToString(parallel_files).c_str(), FloatToString(mb, 2).c_str(),
+            FloatToString(parallel_seconds, 3).c_str(),
+            FloatToString(parallel_files / parallel_seconds, 1).c_str(),
+            FloatToString(mb / parallel_seconds, 2).c_str(),
+            NumToString(jobs).c_str());
+  }
   return 0;
 }
 
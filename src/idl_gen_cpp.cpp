@@ -321,6 +321,14 @@ class CppGenerator : public BaseGenerator {
     if (parser_.uses_flexbuffers_) {
       code_ += "#include \"flatbuffers/flexbuffers.h\"";
     }
+    if (opts_.cpp_object_api_arena) {
+      code_ += "#include \"flatbuffers/arena.h\"";
+    }
+    if (opts_.gen_json_printer) { code_ += "#include \"flatbuffers/util.h\""; }
+    if (opts_.gen_json_parser) {
+      code_ += "#include \"flatbuffers/hash.h\"";
+      code_ += "#include \"flatbuffers/json_reader.h\"";
+    }
     code_ += "";
 
     if (opts_.include_dependence_headers) { GenIncludeDependencies(); }
@@ -423,6 +431,15 @@ class CppGenerator : public BaseGenerator {
       }
     }
 
+    // Generate JSON printers, once all the types they print are complete.
+    if (opts_.gen_json_printer) GenJsonPrinters();
+
+    // Generate JSON parsers, which build tables with their Create functions.
+    if (opts_.gen_json_parser) GenJsonParsers();
+
+    // Generate structural hashes, once all the types they hash are complete.
+    if (opts_.gen_hash) GenHashes();
+
     // Generate code for mini reflection.
     if (opts_.mini_reflect != IDLOptions::kNone) {
       // Then the unions/enums that may refer to them.
@@ -576,6 +593,8 @@ class CppGenerator : public BaseGenerator {
 
     if (cur_name_space_) SetNameSpace(nullptr);
 
+    if (opts_.gen_hash && opts_.generate_object_based_api) GenStdHashes();
+
     // Close the include guard.
     code_ += "#endif  // " + include_guard;
 
@@ -722,7 +741,10 @@ class CppGenerator : public BaseGenerator {
   const std::string NativeString(const FieldDef *field) {
     auto attr = field ? field->attributes.Lookup("cpp_str_type") : nullptr;
     auto &ret = attr ? attr->constant : opts_.cpp_object_api_string_type;
-    if (ret.empty()) { return "std::string"; }
+    if (ret.empty()) {
+      return opts_.cpp_object_api_arena ? "flatbuffers::arena_string"
+                                        : "std::string";
+    }
     return ret;
   }
 
@@ -730,7 +752,10 @@ class CppGenerator : public BaseGenerator {
     auto attr = field
                     ? (field->attributes.Lookup("cpp_str_flex_ctor") != nullptr)
                     : false;
-    auto ret = attr ? attr : opts_.cpp_object_api_string_flexible_constructor;
+    // arena_string can't be constructed from the std::string of String::str.
+    auto ret = attr ? attr
+                    : (opts_.cpp_object_api_string_flexible_constructor ||
+                       NativeString(field) == "flatbuffers::arena_string");
     return ret && NativeString(field) !=
                       "std::string";  // Only for custom string types.
   }
@@ -777,6 +802,9 @@ class CppGenerator : public BaseGenerator {
               type.struct_def->attributes.Lookup("native_custom_alloc");
           return "std::vector<" + type_name + "," +
                  native_custom_alloc->constant + "<" + type_name + ">>";
+        } else if (opts_.cpp_object_api_arena) {
+          return "std::vector<" + type_name +
+                 ", flatbuffers::arena_allocator<" + type_name + ">>";
         } else
           return "std::vector<" + type_name + ">";
       }
@@ -920,6 +948,12 @@ class CppGenerator : public BaseGenerator {
            " type, const flatbuffers::resolver_function_t *resolver)";
   }
 
+  std::string UnionUnPackToSignature(const EnumDef &enum_def, bool inclass) {
+    return "void " + (inclass ? "" : Name(enum_def) + "Union::") +
+           "UnPackTo(const void *obj, " + Name(enum_def) +
+           " _type, const flatbuffers::resolver_function_t *resolver)";
+  }
+
   std::string UnionPackSignature(const EnumDef &enum_def, bool inclass) {
     return "flatbuffers::Offset<void> " +
            (inclass ? "" : Name(enum_def) + "Union::") +
@@ -963,6 +997,35 @@ class CppGenerator : public BaseGenerator {
            (inclass ? " = nullptr" : "") + ") const";
   }
 
+  std::string TableArenaUnPackSignature(const StructDef &struct_def,
+                                        bool inclass, const IDLOptions &opts) {
+    return NativeName(Name(struct_def), &struct_def, opts) + " *" +
+           (inclass ? "" : Name(struct_def) + "::") +
+           "UnPack(flatbuffers::Arena &_arena, "
+           "const flatbuffers::resolver_function_t *_resolver" +
+           (inclass ? " = nullptr" : "") + ") const";
+  }
+
+  std::string TableArenaUnPackToSignature(const StructDef &struct_def,
+                                          bool inclass,
+                                          const IDLOptions &opts) {
+    return "void " + (inclass ? "" : Name(struct_def) + "::") + "UnPackTo(" +
+           NativeName(Name(struct_def), &struct_def, opts) + " *" +
+           "_o, flatbuffers::Arena &_arena, "
+           "const flatbuffers::resolver_function_t *_resolver" +
+           (inclass ? " = nullptr" : "") + ") const";
+  }
+
+  std::string TablePartialUnPackToSignature(const StructDef &struct_def,
+                                            bool inclass,
+                                            const IDLOptions &opts) {
+    return "void " + (inclass ? "" : Name(struct_def) + "::") + "UnPackTo(" +
+           NativeName(Name(struct_def), &struct_def, opts) + " *" +
+           "_o, const flatbuffers::FieldSet &_fields, "
+           "const flatbuffers::resolver_function_t *_resolver" +
+           (inclass ? " = nullptr" : "") + ") const";
+  }
+
   void GenMiniReflectPre(const StructDef *struct_def) {
     code_.SetValue("NAME", struct_def->name);
     code_ += "inline const flatbuffers::TypeTable *{{NAME}}TypeTable();";
@@ -1319,6 +1382,7 @@ class CppGenerator : public BaseGenerator {
         code_ += "";
       }
       code_ += "  " + UnionUnPackSignature(enum_def, true) + ";";
+      code_ += "  " + UnionUnPackToSignature(enum_def, true) + ";";
       code_ += "  " + UnionPackSignature(enum_def, true) + ";";
       code_ += "";
 
@@ -1490,6 +1554,46 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      // Generate union UnPackTo(), which unpacks into the existing value
+      // when it has the same type.
+      code_ += "inline " + UnionUnPackToSignature(enum_def, false) + " {";
+      code_ += "  if (type == _type && value) {";
+      code_ += "    switch (_type) {";
+      for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end();
+           ++it) {
+        const auto &ev = **it;
+        if (ev.IsZero()) { continue; }
+
+        code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+        code_.SetValue("TYPE", GetUnionElement(ev, false, opts_));
+        code_.SetValue("NATIVE_TYPE", GetUnionElement(ev, true, opts_));
+        code_ += "      case {{LABEL}}: {";
+        code_ += "        auto ptr = reinterpret_cast<const {{TYPE}} *>(obj);";
+        code_ +=
+            "        auto dst = reinterpret_cast<{{NATIVE_TYPE}} *>(value);";
+        if (ev.union_type.base_type == BASE_TYPE_STRUCT) {
+          if (ev.union_type.struct_def->fixed) {
+            code_ += "        *dst = *ptr;";
+          } else {
+            code_ += "        ptr->UnPackTo(dst, resolver);";
+          }
+        } else if (IsString(ev.union_type)) {
+          code_ += "        dst->assign(ptr->c_str(), ptr->size());";
+        } else {
+          FLATBUFFERS_ASSERT(false);
+        }
+        code_ += "        return;";
+        code_ += "      }";
+      }
+      code_ += "      default: break;";
+      code_ += "    }";
+      code_ += "  }";
+      code_ += "  Reset();";
+      code_ += "  value = UnPack(obj, _type, resolver);";
+      code_ += "  type = _type;";
+      code_ += "}";
+      code_ += "";
+
       code_ += "inline " + UnionPackSignature(enum_def, false) + " {";
       code_ += "  switch (type) {";
       for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end();
@@ -1831,174 +1935,1267 @@ class CppGenerator : public BaseGenerator {
     code_ += "";
   }
 
-  void GenOperatorNewDelete(const StructDef &struct_def) {
-    if (auto native_custom_alloc =
-            struct_def.attributes.Lookup("native_custom_alloc")) {
-      code_ += "  inline void *operator new (std::size_t count) {";
-      code_ += "    return " + native_custom_alloc->constant +
-               "<{{NATIVE_NAME}}>().allocate(count / sizeof({{NATIVE_NAME}}));";
-      code_ += "  }";
-      code_ += "  inline void operator delete (void *ptr) {";
-      code_ += "    return " + native_custom_alloc->constant +
-               "<{{NATIVE_NAME}}>().deallocate(static_cast<{{NATIVE_NAME}}*>("
-               "ptr),1);";
-      code_ += "  }";
-    }
+  std::string JsonPrinterSignature(const StructDef &struct_def) {
+    return "template<typename Sink> inline bool ToJson(const " +
+           Name(struct_def) + " *obj, Sink &sink)";
   }
 
-  void GenNativeTable(const StructDef &struct_def) {
-    const auto native_name = NativeName(Name(struct_def), &struct_def, opts_);
-    code_.SetValue("STRUCT_NAME", Name(struct_def));
-    code_.SetValue("NATIVE_NAME", native_name);
-
-    // Generate a C++ object that can hold an unpacked version of this table.
-    code_ += "struct {{NATIVE_NAME}} : public flatbuffers::NativeTable {";
-    code_ += "  typedef {{STRUCT_NAME}} TableType;";
-    GenFullyQualifiedNameGetter(struct_def, native_name);
-    for (auto it = struct_def.fields.vec.begin();
-         it != struct_def.fields.vec.end(); ++it) {
-      GenMember(**it);
-    }
-    GenOperatorNewDelete(struct_def);
-    GenDefaultConstructor(struct_def);
-    code_ += "};";
-    if (opts_.gen_compare) GenCompareOperator(struct_def);
-    code_ += "";
+  std::string UnionJsonPrinterSignature(const EnumDef &enum_def) {
+    return "template<typename Sink> inline bool ToJson" + Name(enum_def) +
+           "(const void *obj, " + Name(enum_def) + " type, Sink &sink)";
   }
 
-  // Generate the code to call the appropriate Verify function(s) for a field.
-  void GenVerifyCall(const FieldDef &field, const char *prefix) {
-    code_.SetValue("PRE", prefix);
-    code_.SetValue("NAME", Name(field));
-    code_.SetValue("REQUIRED", field.IsRequired() ? "Required" : "");
-    code_.SetValue("SIZE", GenTypeSize(field.value.type));
-    code_.SetValue("OFFSET", GenFieldOffsetName(field));
-    if (IsScalar(field.value.type.base_type) || IsStruct(field.value.type)) {
-      code_ +=
-          "{{PRE}}VerifyField{{REQUIRED}}<{{SIZE}}>(verifier, {{OFFSET}})\\";
+  // Generate the statements that append `value`, an expression of the given
+  // type, to the sink.
+  void GenJsonValue(const Type &type, const std::string &value,
+                    const std::string &indent) {
+    code_.SetValue("VALUE", value);
+    if (type.base_type == BASE_TYPE_BOOL) {
+      code_ += indent + "flatbuffers::JsonAppendBool(sink, {{VALUE}});";
+    } else if (IsScalar(type.base_type) && type.enum_def) {
+      const auto &enum_def = *type.enum_def;
+      code_.SetValue("ENUM_TYPE", WrapInNameSpace(enum_def));
+      code_.SetValue("ENUM_NAME_FN",
+                     WrapInNameSpace(enum_def.defined_namespace,
+                                     "EnumName" + Name(enum_def)));
+      code_.SetValue("UNDERLYING", GenTypeBasic(type, false));
+      code_ += indent + "{";
+      code_ += indent +
+               "  const auto e = static_cast<{{ENUM_TYPE}}>({{VALUE}});";
+      code_ += indent +
+               "  flatbuffers::JsonAppendEnum(sink, {{ENUM_NAME_FN}}(e),";
+      code_ += indent +
+               "                              static_cast<{{UNDERLYING}}>(e));";
+      code_ += indent + "}";
+    } else if (IsScalar(type.base_type)) {
+      code_ += indent + "flatbuffers::JsonAppendNumber(sink, {{VALUE}});";
+    } else if (IsString(type)) {
+      code_ += indent + "{";
+      code_ += indent + "  const auto s = {{VALUE}};";
+      code_ += indent +
+               "  if (!flatbuffers::JsonAppendString(sink, s->c_str(), "
+               "s->size())) return false;";
+      code_ += indent + "}";
+    } else if (IsStruct(type) || type.base_type == BASE_TYPE_STRUCT) {
+      code_ += indent + "if (!ToJson({{VALUE}}, sink)) return false;";
     } else {
-      code_ += "{{PRE}}VerifyOffset{{REQUIRED}}(verifier, {{OFFSET}})\\";
+      FLATBUFFERS_ASSERT(false);
     }
+  }
 
-    switch (field.value.type.base_type) {
-      case BASE_TYPE_UNION: {
-        code_.SetValue("ENUM_NAME", field.value.type.enum_def->name);
+  // Generate a printer for a table or struct that writes it as compact JSON
+  // to any sink with an append(const char *, size_t) method. Scalar fields
+  // are always written, as with --defaults-json, since a table accessor
+  // can't tell a default value from an absent one.
+  void GenJsonPrinter(const StructDef &struct_def) {
+    code_ += JsonPrinterSignature(struct_def) + " {";
+    code_ += "  char sep = '{';";
+    bool printed_fields = false;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) continue;
+      const auto &type = field.value.type;
+      const auto accessor = "obj->" + Name(field) + "()";
+      printed_fields = true;
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("KEY", "\"\\\"" + field.name + "\\\":\"");
+      const std::string key =
+          "flatbuffers::JsonAppendKey(sink, sep, {{KEY}});";
+      if (struct_def.fixed) {
+        code_ += "  " + key;
+        if (IsArray(type)) {
+          const auto elem = type.VectorType();
+          code_ += "  {";
+          code_ += "    const auto a = obj->{{FIELD_NAME}}();";
+          code_ += "    sink.append(\"[\", 1);";
+          code_ +=
+              "    for (flatbuffers::uoffset_t i = 0; i < a->size(); i++) {";
+          code_ += "      if (i) sink.append(\",\", 1);";
+          GenJsonValue(elem, "a->Get(i)", "      ");
+          code_ += "    }";
+          code_ += "    sink.append(\"]\", 1);";
+          code_ += "  }";
+        } else if (IsStruct(type)) {
+          GenJsonValue(type, "&" + accessor, "  ");
+        } else {
+          GenJsonValue(type, accessor, "  ");
+        }
+        continue;
+      }
+      if (field.IsScalarOptional()) {
+        code_ += "  if (const auto v = obj->{{FIELD_NAME}}()) {";
+        code_ += "    " + key;
+        GenJsonValue(type, "*v", "    ");
+        code_ += "  }";
+      } else if (IsScalar(type.base_type)) {
+        code_ += "  " + key;
+        GenJsonValue(type, accessor, "  ");
+      } else if (type.base_type == BASE_TYPE_UNION) {
+        code_.SetValue("UNION_PRINTER",
+                       WrapInNameSpace(type.enum_def->defined_namespace,
+                                       "ToJson" + Name(*type.enum_def)));
         code_.SetValue("SUFFIX", UnionTypeFieldSuffix());
+        code_ += "  if (const auto u = obj->{{FIELD_NAME}}()) {";
+        code_ += "    " + key;
         code_ +=
-            "{{PRE}}Verify{{ENUM_NAME}}(verifier, {{NAME}}(), "
-            "{{NAME}}{{SUFFIX}}())\\";
-        break;
-      }
-      case BASE_TYPE_STRUCT: {
-        if (!field.value.type.struct_def->fixed) {
-          code_ += "{{PRE}}verifier.VerifyTable({{NAME}}())\\";
+            "    if (!{{UNION_PRINTER}}(u, obj->{{FIELD_NAME}}{{SUFFIX}}(), "
+            "sink)) return false;";
+        code_ += "  }";
+      } else if (field.flexbuffer) {
+        code_ += "  if (obj->{{FIELD_NAME}}()) {";
+        code_ += "    " + key;
+        code_ += "    std::string flex;";
+        code_ +=
+            "    obj->{{FIELD_NAME}}_flexbuffer_root().ToString(true, true, "
+            "flex);";
+        code_ += "    sink.append(flex.c_str(), flex.size());";
+        code_ += "  }";
+      } else if (field.nested_flatbuffer) {
+        code_ += "  if (obj->{{FIELD_NAME}}()) {";
+        code_ += "    " + key;
+        GenJsonValue(Type(BASE_TYPE_STRUCT, field.nested_flatbuffer),
+                     "obj->" + Name(field) + "_nested_root()", "    ");
+        code_ += "  }";
+      } else if (IsVector(type)) {
+        const auto elem = type.VectorType();
+        code_ += "  if (const auto v = obj->{{FIELD_NAME}}()) {";
+        if (elem.base_type == BASE_TYPE_UNION) {
+          code_.SetValue("UNION_PRINTER",
+                         WrapInNameSpace(elem.enum_def->defined_namespace,
+                                         "ToJson" + Name(*elem.enum_def)));
+          code_.SetValue("UNION_TYPE", WrapInNameSpace(*elem.enum_def));
+          code_.SetValue("SUFFIX", UnionTypeFieldSuffix());
+          code_ += "    const auto types = obj->{{FIELD_NAME}}{{SUFFIX}}();";
+          code_ +=
+              "    if (!types || types->size() != v->size()) return false;";
         }
-        break;
-      }
-      case BASE_TYPE_STRING: {
-        code_ += "{{PRE}}verifier.VerifyString({{NAME}}())\\";
-        break;
-      }
-      case BASE_TYPE_VECTOR: {
-        code_ += "{{PRE}}verifier.VerifyVector({{NAME}}())\\";
-
-        switch (field.value.type.element) {
-          case BASE_TYPE_STRING: {
-            code_ += "{{PRE}}verifier.VerifyVectorOfStrings({{NAME}}())\\";
-            break;
-          }
-          case BASE_TYPE_STRUCT: {
-            if (!field.value.type.struct_def->fixed) {
-              code_ += "{{PRE}}verifier.VerifyVectorOfTables({{NAME}}())\\";
-            }
-            break;
-          }
-          case BASE_TYPE_UNION: {
-            code_.SetValue("ENUM_NAME", field.value.type.enum_def->name);
-            code_ +=
-                "{{PRE}}Verify{{ENUM_NAME}}Vector(verifier, {{NAME}}(), "
-                "{{NAME}}_type())\\";
-            break;
-          }
-          default: break;
+        code_ += "    " + key;
+        code_ += "    sink.append(\"[\", 1);";
+        code_ += "    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {";
+        code_ += "      if (i) sink.append(\",\", 1);";
+        if (elem.base_type == BASE_TYPE_UNION) {
+          code_ +=
+              "      if (!{{UNION_PRINTER}}(v->Get(i), "
+              "types->GetEnum<{{UNION_TYPE}}>(i), sink))";
+          code_ += "        return false;";
+        } else {
+          GenJsonValue(elem, "v->Get(i)", "      ");
         }
-        break;
-      }
-      default: {
-        break;
+        code_ += "    }";
+        code_ += "    sink.append(\"]\", 1);";
+        code_ += "  }";
+      } else {
+        code_ += "  if (const auto p = obj->{{FIELD_NAME}}()) {";
+        code_ += "    " + key;
+        GenJsonValue(type, "p", "    ");
+        code_ += "  }";
       }
     }
+    if (!printed_fields) code_ += "  (void)obj;";
+    code_ += "  if (sep == '{') sink.append(\"{\", 1);";
+    code_ += "  sink.append(\"}\", 1);";
+    code_ += "  return true;";
+    code_ += "}";
+    code_ += "";
   }
 
-  // Generate CompareWithValue method for a key field.
-  void GenKeyFieldMethods(const FieldDef &field) {
-    FLATBUFFERS_ASSERT(field.key);
-    const bool is_string = (IsString(field.value.type));
-
-    code_ += "  bool KeyCompareLessThan(const {{STRUCT_NAME}} *o) const {";
-    if (is_string) {
-      // use operator< of flatbuffers::String
-      code_ += "    return *{{FIELD_NAME}}() < *o->{{FIELD_NAME}}();";
-    } else {
-      code_ += "    return {{FIELD_NAME}}() < o->{{FIELD_NAME}}();";
+  void GenUnionJsonPrinter(const EnumDef &enum_def) {
+    code_ += UnionJsonPrinterSignature(enum_def) + " {";
+    code_ += "  switch (type) {";
+    for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end(); ++it) {
+      const auto &ev = **it;
+      if (ev.IsZero()) continue;
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+      code_.SetValue("TYPE", GetUnionElement(ev, false, opts_));
+      code_ += "    case {{LABEL}}: {";
+      code_ +=
+          "      const auto ptr = reinterpret_cast<const {{TYPE}} *>(obj);";
+      if (IsString(ev.union_type)) {
+        code_ +=
+            "      return flatbuffers::JsonAppendString(sink, ptr->c_str(), "
+            "ptr->size());";
+      } else {
+        code_ += "      return ToJson(ptr, sink);";
+      }
+      code_ += "    }";
     }
+    code_ += "    default: return false;";
     code_ += "  }";
+    code_ += "}";
+    code_ += "";
+  }
 
-    if (is_string) {
-      code_ += "  int KeyCompareWithValue(const char *val) const {";
-      code_ += "    return strcmp({{FIELD_NAME}}()->c_str(), val);";
-      code_ += "  }";
-    } else {
-      FLATBUFFERS_ASSERT(IsScalar(field.value.type.base_type));
-      auto type = GenTypeBasic(field.value.type, false);
-      if (opts_.scoped_enums && field.value.type.enum_def &&
-          IsScalar(field.value.type.base_type)) {
-        type = GenTypeGet(field.value.type, " ", "const ", " *", true);
+  void GenJsonPrinters() {
+    // Declare all the printers first, since types may refer to each other.
+    for (auto it = parser_.enums_.vec.begin(); it != parser_.enums_.vec.end();
+         ++it) {
+      const auto &enum_def = **it;
+      if (enum_def.is_union && !enum_def.generated) {
+        SetNameSpace(enum_def.defined_namespace);
+        code_ += UnionJsonPrinterSignature(enum_def) + ";";
+      }
+    }
+    for (auto it = parser_.structs_.vec.begin();
+         it != parser_.structs_.vec.end(); ++it) {
+      const auto &struct_def = **it;
+      if (!struct_def.generated) {
+        SetNameSpace(struct_def.defined_namespace);
+        code_ += JsonPrinterSignature(struct_def) + ";";
+      }
+    }
+    code_ += "";
+    for (auto it = parser_.enums_.vec.begin(); it != parser_.enums_.vec.end();
+         ++it) {
+      const auto &enum_def = **it;
+      if (enum_def.is_union && !enum_def.generated) {
+        SetNameSpace(enum_def.defined_namespace);
+        GenUnionJsonPrinter(enum_def);
+      }
+    }
+    for (auto it = parser_.structs_.vec.begin();
+         it != parser_.structs_.vec.end(); ++it) {
+      const auto &struct_def = **it;
+      if (!struct_def.generated) {
+        SetNameSpace(struct_def.defined_namespace);
+        GenJsonPrinter(struct_def);
       }
-      // Returns {field<val: -1, field==val: 0, field>val: +1}.
-      code_.SetValue("KEY_TYPE", type);
-      code_ += "  int KeyCompareWithValue({{KEY_TYPE}} val) const {";
-      code_ +=
-          "    return static_cast<int>({{FIELD_NAME}}() > val) - "
-          "static_cast<int>({{FIELD_NAME}}() < val);";
-      code_ += "  }";
     }
   }
 
-  void GenTableUnionAsGetters(const FieldDef &field) {
-    const auto &type = field.value.type;
-    auto u = type.enum_def;
-
-    if (!type.enum_def->uses_multiple_type_instances)
-      code_ +=
-          "  template<typename T> "
-          "const T *{{NULLABLE_EXT}}{{FIELD_NAME}}_as() const;";
-
-    for (auto u_it = u->Vals().begin(); u_it != u->Vals().end(); ++u_it) {
-      auto &ev = **u_it;
-      if (ev.union_type.base_type == BASE_TYPE_NONE) { continue; }
-      auto full_struct_name = GetUnionElement(ev, false, opts_);
-
-      // @TODO: Mby make this decisions more universal? How?
-      code_.SetValue("U_GET_TYPE",
-                     EscapeKeyword(field.name + UnionTypeFieldSuffix()));
-      code_.SetValue("U_ELEMENT_TYPE", WrapInNameSpace(u->defined_namespace,
-                                                       GetEnumValUse(*u, ev)));
-      code_.SetValue("U_FIELD_TYPE", "const " + full_struct_name + " *");
-      code_.SetValue("U_FIELD_NAME", Name(field) + "_as_" + Name(ev));
-      code_.SetValue("U_NULLABLE", NullableExtension());
+  std::string HashSignature(const StructDef &struct_def, bool native) {
+    const auto name = native ? NativeName(Name(struct_def), &struct_def, opts_)
+                             : Name(struct_def);
+    return "inline uint64_t Hash(const " + name + " *obj)";
+  }
 
-      // `const Type *union_name_asType() const` accessor.
-      code_ += "  {{U_FIELD_TYPE}}{{U_NULLABLE}}{{U_FIELD_NAME}}() const {";
-      code_ +=
-          "    return {{U_GET_TYPE}}() == {{U_ELEMENT_TYPE}} ? "
-          "static_cast<{{U_FIELD_TYPE}}>({{FIELD_NAME}}()) "
-          ": nullptr;";
-      code_ += "  }";
+  std::string UnionHashSignature(const EnumDef &enum_def, bool native) {
+    if (native) {
+      return "inline uint64_t Hash(const " + Name(enum_def) + "Union &obj)";
     }
+    return "inline uint64_t Hash" + Name(enum_def) + "(const void *obj, " +
+           Name(enum_def) + " type)";
   }
 
-  void GenTableFieldGetter(const FieldDef &field) {
+  // Fields with a cpp_type are references to other objects by hash, which
+  // the object API resolves to pointers, so they are not part of the hash.
+  bool IsHashedField(const FieldDef &field) {
+    const auto &type = field.value.type;
+    return !field.deprecated && type.base_type != BASE_TYPE_UTYPE &&
+           !(IsVector(type) && type.element == BASE_TYPE_UTYPE) &&
+           !field.attributes.Lookup("cpp_type");
+  }
+
+  // The hash of `value`, an element or non-optional scalar of the given type
+  // read from a buffer, or of the object API type when `native` is set.
+  std::string GenHashValue(const Type &type, const std::string &value,
+                           bool native) {
+    if (IsScalar(type.base_type)) {
+      return "flatbuffers::HashKey(" + value + ")";
+    } else if (IsString(type)) {
+      return "flatbuffers::HashString(" + value + ")";
+    } else if (IsStruct(type) && native) {
+      return "Hash(&" + value + ")";
+    } else {
+      return "Hash(" + value + ")";
+    }
+  }
+
+  // Generate a structural hash for a table or struct, that combines the
+  // hashes of its fields in order. Vectors of scalars are hashed in bulk.
+  // Nested flatbuffers are hashed through their root table, but flexbuffers
+  // have no generated hash, and are hashed as bytes like other vectors.
+  void GenHash(const StructDef &struct_def, bool native) {
+    code_ += HashSignature(struct_def, native) + " {";
+    code_ += "  if (!obj) return flatbuffers::kHashAbsent;";
+    code_ += "  uint64_t h = 0;";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (!IsHashedField(field)) continue;
+      const auto &type = field.value.type;
+      const auto value = "obj->" + Name(field) + (native ? "" : "()");
+      code_.SetValue("FIELD_NAME", Name(field));
+      if (struct_def.fixed) {
+        if (IsArray(type)) {
+          code_ += "  {";
+          code_ += "    const auto a = obj->{{FIELD_NAME}}();";
+          code_ += "    uint64_t vh = flatbuffers::HashKey(a->size());";
+          code_ += "    for (flatbuffers::uoffset_t i = 0; i < a->size(); i++)";
+          code_ += "      vh = flatbuffers::HashCombine(vh, " +
+                   GenHashValue(type.VectorType(), "a->Get(i)", false) + ");";
+          code_ += "    h = flatbuffers::HashCombine(h, vh);";
+          code_ += "  }";
+        } else if (IsStruct(type)) {
+          code_ += "  h = flatbuffers::HashCombine(h, Hash(&" + value + "));";
+        } else {
+          code_ += "  h = flatbuffers::HashCombine(h, " +
+                   GenHashValue(type, value, false) + ");";
+        }
+        continue;
+      }
+      std::string hash;
+      if (field.IsScalarOptional()) {
+        hash = "flatbuffers::HashOptional(" + value + ")";
+      } else if (type.base_type == BASE_TYPE_UNION) {
+        if (native) {
+          hash = "Hash(" + value + ")";
+        } else {
+          hash = WrapInNameSpace(type.enum_def->defined_namespace,
+                                 "Hash" + Name(*type.enum_def)) +
+                 "(" + value + ", obj->" + Name(field) +
+                 UnionTypeFieldSuffix() + "())";
+        }
+      } else if (type.base_type == BASE_TYPE_STRUCT && native) {
+        if (IsStruct(type) &&
+            type.struct_def->attributes.Lookup("native_type")) {
+          continue;  // Only known to user code.
+        }
+        hash = IsStruct(type) && field.native_inline
+                   ? "Hash(&" + value + ")"
+                   : "Hash(" + value + GenPtrGet(field) + ")";
+      } else if (field.nested_flatbuffer) {
+        code_.SetValue("CPP_NAME", WrapInNameSpace(*field.nested_flatbuffer));
+        code_ += "  {";
+        if (native) {
+          code_ += "    const auto &v = obj->{{FIELD_NAME}};";
+          code_ += "    const auto root = v.empty() ? nullptr";
+          code_ += "        : flatbuffers::GetRoot<{{CPP_NAME}}>(v.data());";
+        } else {
+          code_ += "    const auto v = obj->{{FIELD_NAME}}();";
+          code_ += "    const auto root = v && v->size()";
+          code_ += "        ? obj->{{FIELD_NAME}}_nested_root() : nullptr;";
+        }
+        code_ += "    h = flatbuffers::HashCombine(h, Hash(root));";
+        code_ += "  }";
+        continue;
+      } else if (IsVector(type) && IsScalar(type.element)) {
+        hash = "flatbuffers::HashScalars(" + value + ")";
+      } else if (IsVector(type)) {
+        const auto elem = type.VectorType();
+        if (native && IsStruct(elem) &&
+            elem.struct_def->attributes.Lookup("native_type")) {
+          continue;
+        }
+        code_ += "  {";
+        if (native) {
+          std::string elem_value = "e";
+          if (elem.base_type == BASE_TYPE_STRUCT && !IsStruct(elem)) {
+            elem_value += GenPtrGet(field);
+          }
+          code_ += "    uint64_t vh = flatbuffers::HashKey(" + value +
+                   ".size());";
+          code_ += "    for (const auto &e : " + value + ")";
+          code_ += "      vh = flatbuffers::HashCombine(vh, " +
+                   (elem.base_type == BASE_TYPE_UNION
+                        ? "Hash(e)"
+                        : GenHashValue(elem, elem_value, true)) +
+                   ");";
+        } else {
+          code_ += "    const auto v = " + value + ";";
+          code_ += "    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);";
+          if (elem.base_type == BASE_TYPE_UNION) {
+            code_.SetValue("UNION_HASH",
+                           WrapInNameSpace(elem.enum_def->defined_namespace,
+                                           "Hash" + Name(*elem.enum_def)));
+            code_.SetValue("UNION_TYPE", WrapInNameSpace(*elem.enum_def));
+            code_.SetValue("SUFFIX", UnionTypeFieldSuffix());
+            code_ += "    const auto types = obj->{{FIELD_NAME}}{{SUFFIX}}();";
+            code_ += "    if (v && types && types->size() == v->size()) {";
+            code_ +=
+                "      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)";
+            code_ += "        vh = flatbuffers::HashCombine(";
+            code_ +=
+                "            vh, {{UNION_HASH}}(v->Get(i), "
+                "types->GetEnum<{{UNION_TYPE}}>(i)));";
+            code_ += "    }";
+          } else {
+            code_ += "    if (v) {";
+            code_ +=
+                "      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)";
+            code_ += "        vh = flatbuffers::HashCombine(vh, " +
+                     GenHashValue(elem, "v->Get(i)", false) + ");";
+            code_ += "    }";
+          }
+        }
+        code_ += "    h = flatbuffers::HashCombine(h, vh);";
+        code_ += "  }";
+        continue;
+      } else {
+        hash = GenHashValue(type, value, false);
+      }
+      code_ += "  h = flatbuffers::HashCombine(h, " + hash + ");";
+    }
+    code_ += "  return h;";
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Generate the hash of a union value, which combines its type with the
+  // hash of the value.
+  void GenUnionHash(const EnumDef &enum_def, bool native) {
+    code_ += UnionHashSignature(enum_def, native) + " {";
+    if (native) {
+      code_ += "  const auto h = flatbuffers::HashKey(obj.type);";
+      code_ += "  switch (obj.type) {";
+    } else {
+      code_ += "  const auto h = flatbuffers::HashKey(type);";
+      code_ += "  switch (type) {";
+    }
+    for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end(); ++it) {
+      const auto &ev = **it;
+      if (ev.IsZero()) continue;
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+      code_.SetValue("TYPE", GetUnionElement(ev, native, opts_));
+      code_.SetValue("OBJ", native ? "obj.value" : "obj");
+      code_ += "    case {{LABEL}}: {";
+      code_ +=
+          "      const auto ptr = reinterpret_cast<const {{TYPE}} *>({{OBJ}});";
+      if (IsString(ev.union_type)) {
+        code_ += native ? "      return flatbuffers::HashCombine("
+                          "h, flatbuffers::HashString(*ptr));"
+                        : "      return flatbuffers::HashCombine("
+                          "h, flatbuffers::HashString(ptr));";
+      } else {
+        code_ += "      return flatbuffers::HashCombine(h, Hash(ptr));";
+      }
+      code_ += "    }";
+    }
+    code_ += "    default: return h;";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+  }
+
+  void GenHashes() {
+    const bool native = opts_.generate_object_based_api;
+    // Declare all the hashes first, since types may refer to each other.
+    for (auto it = parser_.enums_.vec.begin(); it != parser_.enums_.vec.end();
+         ++it) {
+      const auto &enum_def = **it;
+      if (enum_def.is_union && !enum_def.generated) {
+        SetNameSpace(enum_def.defined_namespace);
+        code_ += UnionHashSignature(enum_def, false) + ";";
+        if (native) code_ += UnionHashSignature(enum_def, true) + ";";
+      }
+    }
+    for (auto it = parser_.structs_.vec.begin();
+         it != parser_.structs_.vec.end(); ++it) {
+      const auto &struct_def = **it;
+      if (!struct_def.generated) {
+        SetNameSpace(struct_def.defined_namespace);
+        code_ += HashSignature(struct_def, false) + ";";
+        if (native && !struct_def.fixed) {
+          code_ += HashSignature(struct_def, true) + ";";
+        }
+      }
+    }
+    code_ += "";
+    for (auto it = parser_.enums_.vec.begin(); it != parser_.enums_.vec.end();
+         ++it) {
+      const auto &enum_def = **it;
+      if (enum_def.is_union && !enum_def.generated) {
+        SetNameSpace(enum_def.defined_namespace);
+        GenUnionHash(enum_def, false);
+        if (native) GenUnionHash(enum_def, true);
+      }
+    }
+    for (auto it = parser_.structs_.vec.begin();
+         it != parser_.structs_.vec.end(); ++it) {
+      const auto &struct_def = **it;
+      if (!struct_def.generated) {
+        SetNameSpace(struct_def.defined_namespace);
+        GenHash(struct_def, false);
+        if (native && !struct_def.fixed) GenHash(struct_def, true);
+      }
+    }
+  }
+
+  // Specialize std::hash for the object API types, outside of any namespace.
+  void GenStdHashes() {
+    code_ += "namespace std {";
+    code_ += "";
+    for (auto it = parser_.structs_.vec.begin();
+         it != parser_.structs_.vec.end(); ++it) {
+      const auto &struct_def = **it;
+      if (struct_def.generated) continue;
+      code_.SetValue("NATIVE_NAME",
+                     WrapNativeNameInNameSpace(struct_def, opts_));
+      code_.SetValue("HASH",
+                     WrapInNameSpace(struct_def.defined_namespace, "Hash"));
+      code_ += "template<> struct hash<{{NATIVE_NAME}}> {";
+      code_ += "  size_t operator()(const {{NATIVE_NAME}} &obj) const {";
+      code_ += "    return static_cast<size_t>({{HASH}}(&obj));";
+      code_ += "  }";
+      code_ += "};";
+      code_ += "";
+    }
+    code_ += "}  // namespace std";
+    code_ += "";
+  }
+
+  std::string EnumJsonParserSignature(const EnumDef &enum_def) {
+    return "inline bool FromJson(flatbuffers::JsonReader &_reader, " +
+           Name(enum_def) + " *_val)";
+  }
+
+  std::string UnionJsonParserSignature(const EnumDef &enum_def) {
+    return "inline bool FromJson" + Name(enum_def) +
+           "(flatbuffers::JsonReader &_reader, "
+           "flatbuffers::FlatBufferBuilder &_fbb, " +
+           Name(enum_def) + " _type, flatbuffers::Offset<void> *_val)";
+  }
+
+  std::string JsonParserSignature(const StructDef &struct_def) {
+    if (struct_def.fixed) {
+      return "inline bool FromJson(flatbuffers::JsonReader &_reader, " +
+             Name(struct_def) + " *_val)";
+    }
+    return "inline bool FromJson(flatbuffers::JsonReader &_reader, "
+           "flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<" +
+           Name(struct_def) + "> *_val)";
+  }
+
+  // Generate the statements that parse a scalar of the given type into
+  // `var`, a variable of its user facing type.
+  void GenJsonScalarParser(const FieldDef &field, const Type &type,
+                           const std::string &var, const std::string &indent) {
+    code_.SetValue("VAR", var);
+    const auto hash = field.attributes.Lookup("hash");
+    if (type.enum_def) {
+      code_ += indent + "if (!FromJson(_reader, &{{VAR}})) return false;";
+    } else if (hash && IsInteger(type.base_type) &&
+               SizeOf(type.base_type) >= sizeof(uint32_t)) {
+      // Hashed fields may be given as the string to hash.
+      const auto bits = NumToString(SizeOf(type.base_type) * 8);
+      const auto fn = hash->constant.compare(0, 5, "fnv1a") == 0
+                          ? "flatbuffers::HashFnv1a"
+                          : "flatbuffers::HashFnv1";
+      code_.SetValue("HASH", std::string(fn) + "<uint" + bits + "_t>");
+      code_.SetValue("TYPE", GenTypeBasic(type, false));
+      code_ += indent + "if (_reader.IsNextName()) {";
+      code_ += indent + "  const char *_str;";
+      code_ += indent + "  size_t _len;";
+      code_ += indent + "  if (!_reader.ParseName(&_str, &_len)) return false;";
+      code_ += indent + "  const std::string _name(_str, _len);";
+      code_ += indent +
+               "  {{VAR}} = static_cast<{{TYPE}}>({{HASH}}(_name.c_str()));";
+      code_ += indent + "} else if (!_reader.ParseScalar(&{{VAR}})) {";
+      code_ += indent + "  return false;";
+      code_ += indent + "}";
+    } else {
+      code_ += indent + "if (!_reader.ParseScalar(&{{VAR}})) return false;";
+    }
+  }
+
+  // Generate the statements that parse a JSON array into the vector field
+  // `var`. The elements are collected in `elems`, or in a local if empty.
+  void GenJsonVectorParser(const FieldDef &field, const std::string &var,
+                           const std::string &elems,
+                           const std::string &indent) {
+    const auto vtype = field.value.type.VectorType();
+    std::string elem_type;
+    if (IsStruct(vtype)) {
+      elem_type = WrapInNameSpace(*vtype.struct_def);
+    } else {
+      elem_type = GenTypeWire(vtype, "", VectorElementUserFacing(vtype));
+    }
+    const auto elems_var = elems.empty() ? "_elems" : elems;
+    code_ += indent + "{";
+    if (elems.empty()) {
+      code_ += indent + "  std::vector<" + elem_type + "> _elems;";
+    } else {
+      code_ += indent + "  " + elems_var + ".clear();";
+    }
+    code_ += indent + "  bool _first_elem = true;";
+    code_ += indent + "  if (!_reader.BeginArray()) return false;";
+    code_ += indent + "  while (_reader.NextElement(&_first_elem)) {";
+    const auto inner = indent + "    ";
+    if (IsScalar(vtype.base_type)) {
+      const auto user_type = GenTypeBasic(vtype, true);
+      code_ += inner + user_type + " _v = " + user_type + "();";
+      GenJsonScalarParser(field, vtype, "_v", inner);
+      code_ += inner + elems_var + ".push_back(static_cast<" + elem_type +
+               ">(_v));";
+    } else if (IsString(vtype)) {
+      code_ += inner + "const char *_str;";
+      code_ += inner + "size_t _len;";
+      code_ += inner + "if (!_reader.ParseString(&_str, &_len)) return false;";
+      code_ += inner + elems_var + ".push_back(_fbb.CreateString(_str, _len));";
+    } else if (IsStruct(vtype)) {
+      code_ += inner + elems_var + ".push_back(" + elem_type + "());";
+      code_ += inner + "if (!FromJson(_reader, &" + elems_var +
+               ".back())) return false;";
+    } else {
+      code_ += inner + elem_type + " _elem;";
+      code_ += inner + "if (!FromJson(_reader, _fbb, &_elem)) return false;";
+      code_ += inner + elems_var + ".push_back(_elem);";
+    }
+    code_ += indent + "  }";
+    code_ += indent + "  if (!_reader.ok()) return false;";
+    const auto force_align = field.attributes.Lookup("force_align");
+    if (force_align && (IsScalar(vtype.base_type) || IsStruct(vtype))) {
+      code_ += indent + "  _fbb.ForceVectorAlignment(" + elems_var +
+               ".size(), sizeof(" + elem_type + "), " +
+               force_align->constant + ");";
+    }
+    std::string create = "CreateVector(" + elems_var + ")";
+    if (IsStruct(vtype)) {
+      create = TypeHasKey(vtype) ? "CreateVectorOfSortedStructs(&" +
+                                       elems_var + ")"
+                                 : "CreateVectorOfStructs(" + elems_var + ")";
+    } else if (TypeHasKey(vtype)) {
+      create = "CreateVectorOfSortedTables(&" + elems_var + ")";
+    }
+    code_ += indent + "  " + var + " = _fbb." + create + ";";
+    code_ += indent + "}";
+  }
+
+  // Generate the statements that parse the value of a union (or vector of
+  // unions) field, once the type field has been seen.
+  void GenJsonUnionParser(const FieldDef &field, const std::string &indent) {
+    const auto &type = field.value.type;
+    const auto &enum_def = *type.enum_def;
+    code_.SetValue("FIELD_NAME", Name(field));
+    code_.SetValue("SUFFIX", UnionTypeFieldSuffix());
+    code_.SetValue("UNION_PARSER",
+                   WrapInNameSpace(enum_def.defined_namespace,
+                                   "FromJson" + Name(enum_def)));
+    if (type.base_type == BASE_TYPE_UNION) {
+      code_ += indent +
+               "if (!{{UNION_PARSER}}(_reader, _fbb, "
+               "{{FIELD_NAME}}{{SUFFIX}}, &{{FIELD_NAME}})) return false;";
+      return;
+    }
+    code_.SetValue("UNION_TYPE", WrapInNameSpace(enum_def));
+    code_ += indent + "{";
+    code_ += indent + "  std::vector<flatbuffers::Offset<void>> _elems;";
+    code_ += indent + "  bool _first_elem = true;";
+    code_ += indent + "  if (!_reader.BeginArray()) return false;";
+    code_ += indent + "  while (_reader.NextElement(&_first_elem)) {";
+    code_ +=
+        indent + "    if (_elems.size() >= {{FIELD_NAME}}{{SUFFIX}}_.size())";
+    code_ += indent +
+             "      return _reader.Fail(\"missing type for union value\");";
+    code_ += indent + "    flatbuffers::Offset<void> _elem;";
+    code_ += indent + "    if (!{{UNION_PARSER}}(_reader, _fbb,";
+    code_ += indent +
+             "        static_cast<{{UNION_TYPE}}>({{FIELD_NAME}}{{SUFFIX}}_["
+             "_elems.size()]), &_elem))";
+    code_ += indent + "      return false;";
+    code_ += indent + "    _elems.push_back(_elem);";
+    code_ += indent + "  }";
+    code_ += indent + "  if (!_reader.ok()) return false;";
+    code_ += indent + "  {{FIELD_NAME}} = _fbb.CreateVector(_elems);";
+    code_ += indent + "}";
+  }
+
+  // Generate the statements that parse the value of a table field.
+  void GenTableJsonFieldParser(const FieldDef &field,
+                               const std::string &indent) {
+    const auto &type = field.value.type;
+    const auto name = Name(field);
+    code_.SetValue("FIELD_NAME", name);
+    if (field.deprecated) {
+      code_ += indent + "if (!_reader.Skip()) return false;";
+      return;
+    }
+    // Like Parser::ParseTable, null leaves optional scalars and offsets out
+    // (so required ones are reported missing), and is an error for others.
+    if (IsScalar(type.base_type) && !field.IsOptional()) {
+      code_ += indent + "if (_reader.AcceptNull())";
+      code_ += indent + "  return _reader.Fail(\"null for a non-optional " +
+               "scalar\");";
+    } else {
+      code_ += indent + "if (_reader.AcceptNull()) continue;";
+    }
+    if (field.IsScalarOptional()) {
+      const auto user_type = GenTypeBasic(type, true);
+      code_ += indent + "{";
+      code_ += indent + "  " + user_type + " _v = " + user_type + "();";
+      GenJsonScalarParser(field, type, "_v", indent + "  ");
+      code_ += indent + "  " + name + " = _v;";
+      code_ += indent + "}";
+    } else if (IsScalar(type.base_type)) {
+      GenJsonScalarParser(field, type, name, indent);
+    } else if (IsString(type)) {
+      code_ += indent + "const char *_str;";
+      code_ += indent + "size_t _len;";
+      code_ += indent + "if (!_reader.ParseString(&_str, &_len)) return false;";
+      code_ += indent + "{{FIELD_NAME}} = _fbb.CreateString(_str, _len);";
+    } else if (IsStruct(type)) {
+      code_ +=
+          indent + "if (!FromJson(_reader, &{{FIELD_NAME}}_)) return false;";
+      code_ += indent + "{{FIELD_NAME}} = &{{FIELD_NAME}}_;";
+    } else if (type.base_type == BASE_TYPE_STRUCT) {
+      code_ += indent +
+               "if (!FromJson(_reader, _fbb, &{{FIELD_NAME}})) return false;";
+    } else if (type.base_type == BASE_TYPE_UNION ||
+               (IsVector(type) && type.element == BASE_TYPE_UNION)) {
+      // The value can only be parsed once its type is known, otherwise it is
+      // skipped and parsed after all other fields.
+      const auto &enum_def = *type.enum_def;
+      code_.SetValue("SUFFIX", UnionTypeFieldSuffix());
+      if (type.base_type == BASE_TYPE_UNION) {
+        const auto &none = *enum_def.Vals().front();
+        code_.SetValue("NONE", WrapInNameSpace(enum_def.defined_namespace,
+                                               GetEnumValUse(enum_def, none)));
+        code_ += indent + "if ({{FIELD_NAME}}{{SUFFIX}} == {{NONE}}) {";
+      } else {
+        code_ += indent + "if ({{FIELD_NAME}}{{SUFFIX}}_.empty()) {";
+      }
+      code_ += indent + "  {{FIELD_NAME}}_json_ = _reader.position();";
+      code_ += indent + "  if (!_reader.Skip()) return false;";
+      code_ += indent + "  continue;";
+      code_ += indent + "}";
+      GenJsonUnionParser(field, indent);
+    } else if (field.flexbuffer) {
+      code_ += indent +
+               "flexbuffers::Builder _flex(1024, "
+               "flexbuffers::BUILDER_FLAG_SHARE_ALL);";
+      code_ +=
+          indent + "if (!_reader.ParseFlexBufferValue(&_flex)) return false;";
+      code_ += indent + "_flex.Finish();";
+      code_ += indent +
+               "_fbb.ForceVectorAlignment(_flex.GetSize(), sizeof(uint8_t), "
+               "sizeof(flatbuffers::largest_scalar_t));";
+      code_ +=
+          indent + "{{FIELD_NAME}} = _fbb.CreateVector(_flex.GetBuffer());";
+    } else if (field.nested_flatbuffer) {
+      // Nested buffers may be given as JSON, or as an array of bytes.
+      code_.SetValue("NESTED_TYPE", WrapInNameSpace(*field.nested_flatbuffer));
+      code_ += indent + "if (_reader.Peek() == '{') {";
+      code_ += indent + "  flatbuffers::FlatBufferBuilder _nested;";
+      code_ += indent + "  flatbuffers::Offset<{{NESTED_TYPE}}> _root;";
+      code_ +=
+          indent + "  if (!FromJson(_reader, _nested, &_root)) return false;";
+      code_ += indent + "  _nested.Finish(_root);";
+      code_ += indent +
+               "  _fbb.ForceVectorAlignment(_nested.GetSize(), "
+               "sizeof(uint8_t), _nested.GetBufferMinAlignment());";
+      code_ += indent +
+               "  {{FIELD_NAME}} = _fbb.CreateVector("
+               "_nested.GetBufferPointer(), _nested.GetSize());";
+      code_ += indent + "  continue;";
+      code_ += indent + "}";
+      GenJsonVectorParser(field, name, "", indent);
+    } else if (IsVector(type)) {
+      GenJsonVectorParser(field, name,
+                          type.element == BASE_TYPE_UTYPE ? name + "_" : "",
+                          indent);
+    } else {
+      FLATBUFFERS_ASSERT(false);
+    }
+  }
+
+  // Generate the statements that parse the value of a struct field, which
+  // is written straight into the struct at `_base`.
+  void GenStructJsonFieldParser(const FieldDef &field,
+                                const std::string &indent) {
+    const auto &type = field.value.type;
+    const auto offset = NumToString(field.value.offset);
+    if (IsArray(type)) {
+      const auto vtype = type.VectorType();
+      const auto length = NumToString(type.fixed_length);
+      code_ += indent + "bool _first_elem = true;";
+      code_ += indent + "size_t _i = 0;";
+      code_ += indent + "if (!_reader.BeginArray()) return false;";
+      code_ += indent + "while (_reader.NextElement(&_first_elem)) {";
+      code_ += indent + "  if (_i == " + length +
+               ") return _reader.Fail(\"too many elements in array\");";
+      if (IsStruct(vtype)) {
+        code_ += indent + "  if (!FromJson(_reader, reinterpret_cast<" +
+                 WrapInNameSpace(*vtype.struct_def) + " *>(_base + " + offset +
+                 ") + _i)) return false;";
+      } else {
+        const auto user_type = GenTypeBasic(vtype, true);
+        code_ += indent + "  " + user_type + " _v = " + user_type + "();";
+        GenJsonScalarParser(field, vtype, "_v", indent + "  ");
+        code_ += indent + "  flatbuffers::WriteScalar(_base + " + offset +
+                 " + _i * sizeof(" + GenTypeBasic(vtype, false) +
+                 "), static_cast<" + GenTypeBasic(vtype, false) + ">(_v));";
+      }
+      code_ += indent + "  _i++;";
+      code_ += indent + "}";
+      code_ += indent + "if (!_reader.ok()) return false;";
+      code_ += indent + "if (_i != " + length +
+               ") return _reader.Fail(\"wrong number of elements in array\");";
+    } else if (IsStruct(type)) {
+      code_ += indent + "if (!FromJson(_reader, reinterpret_cast<" +
+               WrapInNameSpace(*type.struct_def) + " *>(_base + " + offset +
+               "))) return false;";
+    } else {
+      const auto user_type = GenTypeBasic(type, true);
+      code_ += indent + user_type + " _v = " + user_type + "();";
+      GenJsonScalarParser(field, type, "_v", indent);
+      code_ += indent + "flatbuffers::WriteScalar(_base + " + offset +
+               ", static_cast<" + GenTypeBasic(type, false) + ">(_v));";
+    }
+  }
+
+  // Generate a dispatch on the field name in `_key`: a switch on its length,
+  // then a memcmp against each name of that length.
+  void GenJsonKeySwitch(const StructDef &struct_def) {
+    std::map<size_t, std::vector<const FieldDef *>> by_length;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      by_length[(*it)->name.length()].push_back(*it);
+    }
+    code_ += "    switch (_key_len) {";
+    for (auto it = by_length.begin(); it != by_length.end(); ++it) {
+      const auto length = NumToString(it->first);
+      code_ += "      case " + length + ":";
+      for (auto fit = it->second.begin(); fit != it->second.end(); ++fit) {
+        const auto &field = **fit;
+        code_ += "        if (!memcmp(_key, \"" + field.name + "\", " + length +
+                 ")) {";
+        const auto index =
+            NumToString(std::find(struct_def.fields.vec.begin(),
+                                  struct_def.fields.vec.end(), &field) -
+                        struct_def.fields.vec.begin());
+        code_ += "          if (_seen[" + index +
+                 "]) return _reader.Fail(\"field set more than once\");";
+        code_ += "          _seen[" + index + "] = true;";
+        if (struct_def.fixed) {
+          GenStructJsonFieldParser(field, "          ");
+        } else {
+          GenTableJsonFieldParser(field, "          ");
+        }
+        code_ += "          continue;";
+        code_ += "        }";
+      }
+      code_ += "        break;";
+    }
+    code_ += "      default: break;";
+    code_ += "    }";
+    code_ += "    return _reader.Fail(\"unknown field\");";
+  }
+
+  void GenStructJsonParser(const StructDef &struct_def) {
+    const auto num_fields = NumToString(struct_def.fields.vec.size());
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    code_ += JsonParserSignature(struct_def) + " {";
+    code_ += "  uint8_t *const _base = reinterpret_cast<uint8_t *>(_val);";
+    code_ += "  bool _seen[" + num_fields + "] = {};";
+    code_ += "  bool _first = true;";
+    code_ += "  const char *_key;";
+    code_ += "  size_t _key_len;";
+    code_ += "  *_val = {{STRUCT_NAME}}();";
+    code_ += "  if (!_reader.BeginObject()) return false;";
+    code_ += "  while (_reader.NextMember(&_first, &_key, &_key_len)) {";
+    GenJsonKeySwitch(struct_def);
+    code_ += "  }";
+    code_ += "  if (!_reader.ok()) return false;";
+    code_ += "  for (size_t _i = 0; _i < " + num_fields + "; _i++) {";
+    code_ +=
+        "    if (!_seen[_i]) return _reader.Fail(\"wrong number of fields in "
+        "struct\");";
+    code_ += "  }";
+    code_ += "  return true;";
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Generate a parser for a table. Field values are collected into locals,
+  // strings, vectors and sub-tables being built as they are parsed, and the
+  // table is built at the end with its Create function.
+  void GenTableJsonParser(const StructDef &struct_def) {
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    code_ += JsonParserSignature(struct_def) + " {";
+    std::string create_args;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) continue;
+      const auto &type = field.value.type;
+      GenParam(field, false, "  ");
+      code_ += ";";
+      create_args += ", " + Name(field);
+      code_.SetValue("FIELD_NAME", Name(field));
+      if (IsStruct(type)) {
+        code_ += "  " + WrapInNameSpace(*type.struct_def) + " {{FIELD_NAME}}_;";
+      } else if (type.base_type == BASE_TYPE_UNION ||
+                 (IsVector(type) && type.element == BASE_TYPE_UNION)) {
+        code_ += "  const char *{{FIELD_NAME}}_json_ = nullptr;";
+      } else if (IsVector(type) && type.element == BASE_TYPE_UTYPE) {
+        code_ += "  std::vector<uint8_t> {{FIELD_NAME}}_;";
+      }
+    }
+    if (!struct_def.fields.vec.empty()) {
+      code_ += "  bool _seen[" + NumToString(struct_def.fields.vec.size()) +
+               "] = {};";
+    }
+    code_ += "  bool _first = true;";
+    code_ += "  const char *_key;";
+    code_ += "  size_t _key_len;";
+    code_ += "  if (!_reader.BeginObject()) return false;";
+    code_ += "  while (_reader.NextMember(&_first, &_key, &_key_len)) {";
+    GenJsonKeySwitch(struct_def);
+    code_ += "  }";
+    code_ += "  if (!_reader.ok()) return false;";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      const auto &type = field.value.type;
+      if (field.deprecated) continue;
+      if (type.base_type != BASE_TYPE_UNION &&
+          !(IsVector(type) && type.element == BASE_TYPE_UNION))
+        continue;
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_ += "  if ({{FIELD_NAME}}_json_) {";
+      code_ += "    const char *const _resume = _reader.position();";
+      code_ += "    _reader.Seek({{FIELD_NAME}}_json_);";
+      GenJsonUnionParser(field, "    ");
+      code_ += "    _reader.Seek(_resume);";
+      code_ += "  }";
+    }
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated || !field.IsRequired()) continue;
+      const auto check = IsStruct(field.value.type) ? "!" + Name(field)
+                                                    : Name(field) + ".IsNull()";
+      code_ += "  if (" + check + ")";
+      code_ += "    return _reader.Fail(\"required field is missing: " +
+               field.name + " in " + struct_def.name + "\");";
+    }
+    code_ += "  *_val = Create{{STRUCT_NAME}}(_fbb" + create_args + ");";
+    code_ += "  return true;";
+    code_ += "}";
+    code_ += "";
+    code_ += "inline bool FromJson(const char *_json, "
+             "flatbuffers::FlatBufferBuilder &_fbb, "
+             "flatbuffers::Offset<{{STRUCT_NAME}}> *_val, "
+             "std::string *_error = nullptr) {";
+    code_ += "  flatbuffers::JsonReader _reader(_json);";
+    code_ +=
+        "  if (FromJson(_reader, _fbb, _val) && _reader.End()) return true;";
+    code_ += "  if (_error) *_error = _reader.error();";
+    code_ += "  return false;";
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Generate a parser for an enum value, given by name (a space separated
+  // list of names for bit flags) or as a number.
+  void GenEnumJsonParser(const EnumDef &enum_def) {
+    code_.SetValue("ENUM_NAME", Name(enum_def));
+    code_.SetValue("UNDERLYING", GenTypeBasic(enum_def.underlying_type, false));
+    code_ += EnumJsonParserSignature(enum_def) + " {";
+    code_ += "  {{UNDERLYING}} _bits = 0;";
+    code_ += "  if (!_reader.IsNextName()) {";
+    code_ += "    if (!_reader.ParseScalar(&_bits)) return false;";
+    code_ += "    *_val = static_cast<{{ENUM_NAME}}>(_bits);";
+    code_ += "    return true;";
+    code_ += "  }";
+    code_ += "  const char *_str;";
+    code_ += "  const char *_word;";
+    code_ += "  size_t _len;";
+    code_ += "  if (!_reader.ParseName(&_str, &_len)) return false;";
+    code_ += "  const char *const _end = _str + _len;";
+    code_ +=
+        "  while (flatbuffers::JsonReader::NextWord(&_str, _end, &_word, "
+        "&_len)) {";
+    std::map<size_t, std::vector<const EnumVal *>> by_length;
+    for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end(); ++it) {
+      by_length[(*it)->name.length()].push_back(*it);
+    }
+    code_ += "    switch (_len) {";
+    for (auto it = by_length.begin(); it != by_length.end(); ++it) {
+      const auto length = NumToString(it->first);
+      code_ += "      case " + length + ":";
+      for (auto vit = it->second.begin(); vit != it->second.end(); ++vit) {
+        const auto &ev = **vit;
+        code_ += "        if (!memcmp(_word, \"" + ev.name + "\", " + length +
+                 ")) {";
+        code_ += "          _bits |= static_cast<{{UNDERLYING}}>(" +
+                 GetEnumValUse(enum_def, ev) + ");";
+        code_ += "          continue;";
+        code_ += "        }";
+      }
+      code_ += "        break;";
+    }
+    code_ += "      default: break;";
+    code_ += "    }";
+    code_ += "    return _reader.Fail(\"unknown enum value\");";
+    code_ += "  }";
+    code_ += "  *_val = static_cast<{{ENUM_NAME}}>(_bits);";
+    code_ += "  return true;";
+    code_ += "}";
+    code_ += "";
+  }
+
+  void GenUnionJsonParser(const EnumDef &enum_def) {
+    code_ += UnionJsonParserSignature(enum_def) + " {";
+    code_ += "  switch (_type) {";
+    for (auto it = enum_def.Vals().begin(); it != enum_def.Vals().end(); ++it) {
+      const auto &ev = **it;
+      if (ev.IsZero()) continue;
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+      code_.SetValue("TYPE", GetUnionElement(ev, false, opts_));
+      code_ += "    case {{LABEL}}: {";
+      if (IsString(ev.union_type)) {
+        code_ += "      const char *_str;";
+        code_ += "      size_t _len;";
+        code_ += "      if (!_reader.ParseString(&_str, &_len)) return false;";
+        code_ += "      *_val = _fbb.CreateString(_str, _len).Union();";
+      } else if (ev.union_type.struct_def->fixed) {
+        code_ += "      {{TYPE}} _obj;";
+        code_ += "      if (!FromJson(_reader, &_obj)) return false;";
+        code_ += "      *_val = _fbb.CreateStruct(_obj).Union();";
+      } else {
+        code_ += "      flatbuffers::Offset<{{TYPE}}> _obj;";
+        code_ += "      if (!FromJson(_reader, _fbb, &_obj)) return false;";
+        code_ += "      *_val = _obj.Union();";
+      }
+      code_ += "      return true;";
+      code_ += "    }";
+    }
+    code_ +=
+        "    default: return _reader.Fail(\"missing or unknown union type\");";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+  }
+
+  void GenJsonParsers() {
+    // Declare all the parsers first, since types may refer to each other.
+    for (auto it = parser_.enums_.vec.begin(); it != parser_.enums_.vec.end();
+         ++it) {
+      const auto &enum_def = **it;
+      if (!enum_def.generated) {
+        SetNameSpace(enum_def.defined_namespace);
+        code_ += EnumJsonParserSignature(enum_def) + ";";
+        if (enum_def.is_union) {
+          code_ += UnionJsonParserSignature(enum_def) + ";";
+        }
+      }
+    }
+    for (auto it = parser_.structs_.vec.begin();
+         it != parser_.structs_.vec.end(); ++it) {
+      const auto &struct_def = **it;
+      if (!struct_def.generated) {
+        SetNameSpace(struct_def.defined_namespace);
+        code_ += JsonParserSignature(struct_def) + ";";
+      }
+    }
+    code_ += "";
+    for (auto it = parser_.enums_.vec.begin(); it != parser_.enums_.vec.end();
+         ++it) {
+      const auto &enum_def = **it;
+      if (!enum_def.generated) {
+        SetNameSpace(enum_def.defined_namespace);
+        GenEnumJsonParser(enum_def);
+        if (enum_def.is_union) GenUnionJsonParser(enum_def);
+      }
+    }
+    for (auto it = parser_.structs_.vec.begin();
+         it != parser_.structs_.vec.end(); ++it) {
+      const auto &struct_def = **it;
+      if (!struct_def.generated) {
+        SetNameSpace(struct_def.defined_namespace);
+        if (struct_def.fixed) {
+          GenStructJsonParser(struct_def);
+        } else {
+          GenTableJsonParser(struct_def);
+        }
+      }
+    }
+  }
+
+  void GenOperatorNewDelete(const StructDef &struct_def) {
+    if (auto native_custom_alloc =
+            struct_def.attributes.Lookup("native_custom_alloc")) {
+      code_ += "  inline void *operator new (std::size_t count) {";
+      code_ += "    return " + native_custom_alloc->constant +
+               "<{{NATIVE_NAME}}>().allocate(count / sizeof({{NATIVE_NAME}}));";
+      code_ += "  }";
+      code_ += "  inline void operator delete (void *ptr) {";
+      code_ += "    return " + native_custom_alloc->constant +
+               "<{{NATIVE_NAME}}>().deallocate(static_cast<{{NATIVE_NAME}}*>("
+               "ptr),1);";
+      code_ += "  }";
+    } else if (opts_.cpp_object_api_arena && opts_.generate_object_based_api) {
+      code_ += "  inline void *operator new (std::size_t count) {";
+      code_ += "    return flatbuffers::Arena::AllocateObject(count);";
+      code_ += "  }";
+      code_ += "  inline void operator delete (void *ptr) {";
+      code_ += "    flatbuffers::Arena::DeallocateObject(ptr);";
+      code_ += "  }";
+    }
+  }
+
+  void GenNativeTable(const StructDef &struct_def) {
+    const auto native_name = NativeName(Name(struct_def), &struct_def, opts_);
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    code_.SetValue("NATIVE_NAME", native_name);
+
+    // Generate a C++ object that can hold an unpacked version of this table.
+    code_ += "struct {{NATIVE_NAME}} : public flatbuffers::NativeTable {";
+    code_ += "  typedef {{STRUCT_NAME}} TableType;";
+    GenFullyQualifiedNameGetter(struct_def, native_name);
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      GenMember(**it);
+    }
+    GenOperatorNewDelete(struct_def);
+    GenDefaultConstructor(struct_def);
+    code_ += "};";
+    if (opts_.gen_compare) GenCompareOperator(struct_def);
+    code_ += "";
+  }
+
+  // Generate the code to call the appropriate Verify function(s) for a field.
+  void GenVerifyCall(const FieldDef &field, const char *prefix) {
+    code_.SetValue("PRE", prefix);
+    code_.SetValue("NAME", Name(field));
+    code_.SetValue("REQUIRED", field.IsRequired() ? "Required" : "");
+    code_.SetValue("SIZE", GenTypeSize(field.value.type));
+    code_.SetValue("OFFSET", GenFieldOffsetName(field));
+    if (IsScalar(field.value.type.base_type) || IsStruct(field.value.type)) {
+      code_ +=
+          "{{PRE}}VerifyField{{REQUIRED}}<{{SIZE}}>(verifier, {{OFFSET}})\\";
+    } else {
+      code_ += "{{PRE}}VerifyOffset{{REQUIRED}}(verifier, {{OFFSET}})\\";
+    }
+
+    switch (field.value.type.base_type) {
+      case BASE_TYPE_UNION: {
+        code_.SetValue("ENUM_NAME", field.value.type.enum_def->name);
+        code_.SetValue("SUFFIX", UnionTypeFieldSuffix());
+        code_ +=
+            "{{PRE}}Verify{{ENUM_NAME}}(verifier, {{NAME}}(), "
+            "{{NAME}}{{SUFFIX}}())\\";
+        break;
+      }
+      case BASE_TYPE_STRUCT: {
+        if (!field.value.type.struct_def->fixed) {
+          code_ += "{{PRE}}verifier.VerifyTable({{NAME}}())\\";
+        }
+        break;
+      }
+      case BASE_TYPE_STRING: {
+        code_ += "{{PRE}}verifier.VerifyString({{NAME}}())\\";
+        break;
+      }
+      case BASE_TYPE_VECTOR: {
+        code_ += "{{PRE}}verifier.VerifyVector({{NAME}}())\\";
+
+        switch (field.value.type.element) {
+          case BASE_TYPE_STRING: {
+            code_ += "{{PRE}}verifier.VerifyVectorOfStrings({{NAME}}())\\";
+            break;
+          }
+          case BASE_TYPE_STRUCT: {
+            if (!field.value.type.struct_def->fixed) {
+              code_ += "{{PRE}}verifier.VerifyVectorOfTables({{NAME}}())\\";
+            }
+            break;
+          }
+          case BASE_TYPE_UNION: {
+            code_.SetValue("ENUM_NAME", field.value.type.enum_def->name);
+            code_ +=
+                "{{PRE}}Verify{{ENUM_NAME}}Vector(verifier, {{NAME}}(), "
+                "{{NAME}}_type())\\";
+            break;
+          }
+          default: break;
+        }
+        break;
+      }
+      default: {
+        break;
+      }
+    }
+  }
+
+  // Generate CompareWithValue method for a key field.
+  void GenKeyFieldMethods(const FieldDef &field) {
+    FLATBUFFERS_ASSERT(field.key);
+    const bool is_string = (IsString(field.value.type));
+
+    code_ += "  bool KeyCompareLessThan(const {{STRUCT_NAME}} *o) const {";
+    if (is_string) {
+      // use operator< of flatbuffers::String
+      code_ += "    return *{{FIELD_NAME}}() < *o->{{FIELD_NAME}}();";
+    } else {
+      code_ += "    return {{FIELD_NAME}}() < o->{{FIELD_NAME}}();";
+    }
+    code_ += "  }";
+
+    if (is_string) {
+      code_ += "  int KeyCompareWithValue(const char *val) const {";
+      code_ += "    return strcmp({{FIELD_NAME}}()->c_str(), val);";
+      code_ += "  }";
+    } else {
+      FLATBUFFERS_ASSERT(IsScalar(field.value.type.base_type));
+      auto type = GenTypeBasic(field.value.type, false);
+      if (opts_.scoped_enums && field.value.type.enum_def &&
+          IsScalar(field.value.type.base_type)) {
+        type = GenTypeGet(field.value.type, " ", "const ", " *", true);
+      }
+      // Returns {field<val: -1, field==val: 0, field>val: +1}.
+      code_.SetValue("KEY_TYPE", type);
+      code_ += "  int KeyCompareWithValue({{KEY_TYPE}} val) const {";
+      code_ +=
+          "    return static_cast<int>({{FIELD_NAME}}() > val) - "
+          "static_cast<int>({{FIELD_NAME}}() < val);";
+      code_ += "  }";
+    }
+    code_ += "  uint64_t KeyHash() const {";
+    code_ += "    return flatbuffers::HashKey({{FIELD_NAME}}());";
+    code_ += "  }";
+
+    // The key as the builder sorts by it: enums as their underlying type.
+    if (is_string) {
+      code_ += "  const flatbuffers::String *KeySortValue() const {";
+      code_ += "    return {{FIELD_NAME}}();";
+    } else {
+      code_.SetValue("KEY_TYPE", GenTypeBasic(field.value.type, false));
+      code_ += "  {{KEY_TYPE}} KeySortValue() const {";
+      if (field.value.type.enum_def) {
+        code_ += "    return static_cast<{{KEY_TYPE}}>({{FIELD_NAME}}());";
+      } else {
+        code_ += "    return {{FIELD_NAME}}();";
+      }
+    }
+    code_ += "  }";
+  }
+
+  void GenTableUnionAsGetters(const FieldDef &field) {
+    const auto &type = field.value.type;
+    auto u = type.enum_def;
+
+    if (!type.enum_def->uses_multiple_type_instances)
+      code_ +=
+          "  template<typename T> "
+          "const T *{{NULLABLE_EXT}}{{FIELD_NAME}}_as() const;";
+
+    for (auto u_it = u->Vals().begin(); u_it != u->Vals().end(); ++u_it) {
+      auto &ev = **u_it;
+      if (ev.union_type.base_type == BASE_TYPE_NONE) { continue; }
+      auto full_struct_name = GetUnionElement(ev, false, opts_);
+
+      // @TODO: Mby make this decisions more universal? How?
+      code_.SetValue("U_GET_TYPE",
+                     EscapeKeyword(field.name + UnionTypeFieldSuffix()));
+      code_.SetValue("U_ELEMENT_TYPE", WrapInNameSpace(u->defined_namespace,
+                                                       GetEnumValUse(*u, ev)));
+      code_.SetValue("U_FIELD_TYPE", "const " + full_struct_name + " *");
+      code_.SetValue("U_FIELD_NAME", Name(field) + "_as_" + Name(ev));
+      code_.SetValue("U_NULLABLE", NullableExtension());
+
+      // `const Type *union_name_asType() const` accessor.
+      code_ += "  {{U_FIELD_TYPE}}{{U_NULLABLE}}{{U_FIELD_NAME}}() const {";
+      code_ +=
+          "    return {{U_GET_TYPE}}() == {{U_ELEMENT_TYPE}} ? "
+          "static_cast<{{U_FIELD_TYPE}}>({{FIELD_NAME}}()) "
+          ": nullptr;";
+      code_ += "  }";
+    }
+  }
+
+  void GenTableFieldGetter(const FieldDef &field) {
     const auto &type = field.value.type;
     const auto offset_str = GenFieldOffsetName(field);
 
@@ -2330,6 +3527,16 @@ class CppGenerator : public BaseGenerator {
       // Generate the UnPack() pre declaration.
       code_ += "  " + TableUnPackSignature(struct_def, true, opts_) + ";";
       code_ += "  " + TableUnPackToSignature(struct_def, true, opts_) + ";";
+      if (opts_.cpp_object_api_arena) {
+        code_ +=
+            "  " + TableArenaUnPackSignature(struct_def, true, opts_) + ";";
+        code_ +=
+            "  " + TableArenaUnPackToSignature(struct_def, true, opts_) + ";";
+      }
+      if (opts_.gen_partial_unpack) {
+        code_ += "  " + TablePartialUnPackToSignature(struct_def, true, opts_) +
+                 ";";
+      }
       code_ += "  " + TablePackSignature(struct_def, true, opts_) + ";";
     }
 
@@ -2517,6 +3724,8 @@ class CppGenerator : public BaseGenerator {
     code_ += "}";
     code_ += "";
 
+    if (opts_.gen_static_layout) { GenStaticLayoutCreate(struct_def); }
+
     // Definition for type traits for this table type. This allows querying var-
     // ious compile-time traits of the table.
     if (opts_.cpp_static_reflection) { GenTraitsStruct(struct_def); }
@@ -2597,13 +3806,151 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
-  std::string GenUnionUnpackVal(const FieldDef &afield,
-                                const char *vec_elem_access,
-                                const char *vec_type_access) {
-    auto type_name = WrapInNameSpace(*afield.value.type.enum_def);
-    return type_name + "Union::UnPack(" + "_e" + vec_elem_access + ", " +
+  // Generate a CreateXStaticLayout function, that writes all fields of a
+  // table at offsets computed here, like those of a struct, and points it to
+  // a vtable of that layout. Unions are left out, since their value is absent
+  // when their type is NONE.
+  void GenStaticLayoutCreate(const StructDef &struct_def) {
+    std::vector<const FieldDef *> fields;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (IsUnion(field.value.type) ||
+          (IsVector(field.value.type) &&
+           IsUnion(field.value.type.VectorType()))) {
+        return;
+      }
+      if (!field.deprecated) { fields.push_back(&field); }
+    }
+
+    // Place the widest fields first after the vtable offset, to keep
+    // padding low.
+    struct AlignmentGreater {
+      bool operator()(const FieldDef *a, const FieldDef *b) const {
+        return InlineAlignment(a->value.type) > InlineAlignment(b->value.type);
+      }
+    };
+    std::stable_sort(fields.begin(), fields.end(), AlignmentGreater());
+    std::vector<size_t> offsets;
+    size_t size = sizeof(soffset_t);
+    size_t alignment = sizeof(soffset_t);
+    voffset_t vtable_size = FieldIndexToOffset(0);
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      const auto &type = (*it)->value.type;
+      const auto field_alignment = InlineAlignment(type);
+      size += PaddingBytes(size, field_alignment);
+      offsets.push_back(size);
+      size += InlineSize(type);
+      alignment = (std::max)(alignment, field_alignment);
+      vtable_size = (std::max)(
+          vtable_size,
+          static_cast<voffset_t>((*it)->value.offset + sizeof(voffset_t)));
+    }
+    size += PaddingBytes(size, alignment);
+    if (size >= 0x10000) return;
+
+    std::vector<size_t> vtable(vtable_size / sizeof(voffset_t), 0);
+    vtable[0] = vtable_size;
+    vtable[1] = size;
+    for (size_t i = 0; i < fields.size(); i++) {
+      vtable[fields[i]->value.offset / sizeof(voffset_t)] = offsets[i];
+    }
+    std::string vtable_init;
+    for (auto it = vtable.begin(); it != vtable.end(); ++it) {
+      vtable_init += (vtable_init.empty() ? "" : ", ") + NumToString(*it);
+    }
+
+    code_ +=
+        "inline flatbuffers::Offset<{{STRUCT_NAME}}> "
+        "Create{{STRUCT_NAME}}StaticLayout(";
+    code_ += "    flatbuffers::FlatBufferBuilder &_fbb\\";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) { continue; }
+      code_.SetValue("PARAM_TYPE",
+                     field.IsScalarOptional()
+                         ? GenOptionalDecl(field.value.type) + " "
+                         : GenTypeWire(field.value.type, " ", true));
+      code_.SetValue("PARAM_NAME", Name(field));
+      code_ += ",\n    {{PARAM_TYPE}}{{PARAM_NAME}}\\";
+    }
+    code_ += ") {";
+    // An absent offset, struct or optional scalar can't be stored in a fixed
+    // layout, so leave those tables to the regular builder.
+    std::string absent, args;
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      const auto name = Name(**it);
+      const auto &type = (*it)->value.type;
+      std::string check;
+      if ((*it)->IsScalarOptional()) {
+        check = "!" + name + ".has_value()";
+      } else if (!IsScalar(type.base_type)) {
+        check = "!" + name + (IsStruct(type) ? "" : ".o");
+      } else {
+        continue;
+      }
+      absent += (absent.empty() ? "" : " || ") + check;
+    }
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      if (!(*it)->deprecated) { args += ", " + Name(**it); }
+    }
+    if (!absent.empty()) {
+      code_.SetValue("ABSENT", absent);
+      code_.SetValue("ARGS", args);
+      code_ += "  if ({{ABSENT}}) {";
+      code_ += "    return Create{{STRUCT_NAME}}(_fbb{{ARGS}});";
+      code_ += "  }";
+    }
+    code_.SetValue("VTABLE", vtable_init);
+    code_.SetValue("SIZE", NumToString(size));
+    code_.SetValue("ALIGN", NumToString(alignment));
+    code_ +=
+        "  static const flatbuffers::voffset_t _vtable[] = { {{VTABLE}} };";
+    code_ += "  const auto _t = _fbb.StartStaticTable({{SIZE}}, {{ALIGN}});";
+    for (size_t i = 0; i < fields.size(); i++) {
+      const auto &field = *fields[i];
+      const auto &type = field.value.type;
+      code_.SetValue("FIELD_OFFSET", NumToString(offsets[i]));
+      if (IsScalar(type.base_type)) {
+        code_.SetValue("FIELD_TYPE", GenTypeWire(type, "", false));
+        code_.SetValue("FIELD_VALUE",
+                       GenUnderlyingCast(field, false,
+                                         (field.IsScalarOptional() ? "*" : "") +
+                                             Name(field)));
+        code_ +=
+            "  _fbb.SetStaticField<{{FIELD_TYPE}}>(_t, {{FIELD_OFFSET}}, "
+            "{{FIELD_VALUE}});";
+      } else {
+        code_.SetValue("FIELD_VALUE", Name(field));
+        code_.SetValue("SET_FN",
+                       IsStruct(type) ? "SetStaticStruct" : "SetStaticOffset");
+        code_ +=
+            "  _fbb.{{SET_FN}}(_t, {{FIELD_OFFSET}}, {{FIELD_VALUE}});";
+      }
+    }
+    code_ +=
+        "  return flatbuffers::Offset<{{STRUCT_NAME}}>("
+        "_fbb.EndStaticTable(_t, _vtable));";
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Generate code that unpacks a union into |dst|, of the form:
+  //   dst.UnPackTo(_e, field_type(), _resolver);
+  std::string GenUnionUnpackTo(const FieldDef &afield, const std::string &dst,
+                               const char *vec_elem_access,
+                               const std::string &vec_type_access) {
+    return dst + ".UnPackTo(_e" + vec_elem_access + ", " +
            EscapeKeyword(afield.name + UnionTypeFieldSuffix()) + "()" +
-           vec_type_access + ", _resolver)";
+           vec_type_access + ", _resolver);";
+  }
+
+  // Whether the native string type of |field| is a std::basic_string.
+  bool IsBasicString(const FieldDef *field) {
+    const auto type = NativeString(field);
+    return type == "std::string" || type == "flatbuffers::arena_string";
   }
 
   std::string GenUnpackVal(const Type &type, const std::string &val,
@@ -2636,12 +3983,6 @@ class CppGenerator : public BaseGenerator {
           return ptype + "(" + val + "->UnPack(_resolver))";
         }
       }
-      case BASE_TYPE_UNION: {
-        return GenUnionUnpackVal(
-            afield, invector ? "->Get(_i)" : "",
-            invector ? ("->GetEnum<" + type.enum_def->name + ">(_i)").c_str()
-                     : "");
-      }
       default: {
         return val;
         break;
@@ -2649,15 +3990,82 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
-  std::string GenUnpackFieldStatement(const FieldDef &field,
-                                      const FieldDef *union_field) {
+  // Generate code that unpacks |val| into |dst|, reusing what |dst| already
+  // holds: string capacity, tables, structs and union values.
+  std::string GenUnpackAssign(const Type &type, const std::string &dst,
+                              const std::string &val, bool invector,
+                              const FieldDef &afield) {
+    switch (type.base_type) {
+      case BASE_TYPE_STRING: {
+        if (IsBasicString(&afield)) {
+          return dst + ".assign(" + val + "->c_str(), " + val + "->size());";
+        }
+        break;
+      }
+      case BASE_TYPE_STRUCT: {
+        const auto unpack = GenUnpackVal(type, val, invector, afield);
+        if (!IsStruct(type)) {
+          return "if (" + dst + ") " + val + "->UnPackTo(" + dst +
+                 GenPtrGet(afield) + ", _resolver); else " + dst + " = " +
+                 unpack + ";";
+        }
+        if (!invector && !afield.native_inline &&
+            !type.struct_def->attributes.Lookup("native_type")) {
+          return "if (" + dst + ") *" + dst + " = *" + val + "; else " +
+                 dst + " = " + unpack + ";";
+        }
+        break;
+      }
+      case BASE_TYPE_UNION: {
+        return GenUnionUnpackTo(
+            afield, dst, invector ? "->Get(_i)" : "",
+            invector ? "->GetEnum<" + type.enum_def->name + ">(_i)" : "");
+      }
+      default: break;
+    }
+    return dst + " = " + GenUnpackVal(type, val, invector, afield) + ";";
+  }
+
+  // Generate code that resets |field| when it is not present in the buffer,
+  // since UnPackTo may be reusing an object in which it was set.
+  std::string GenUnpackFieldReset(const FieldDef &field) {
+    const auto &type = field.value.type;
+    const auto dst = "_o->" + Name(field);
+    switch (type.base_type) {
+      case BASE_TYPE_STRING: {
+        return IsBasicString(&field)
+                   ? dst + ".clear();"
+                   : dst + " = " + NativeString(&field) + "();";
+      }
+      case BASE_TYPE_VECTOR: return dst + ".clear();";
+      case BASE_TYPE_UNION: return dst + ".Reset();";
+      case BASE_TYPE_STRUCT: {
+        if (IsStruct(type) && field.native_inline) {
+          return dst + " = " + GenTypeNative(type, false, field) + "();";
+        }
+        return dst + " = nullptr;";
+      }
+      default: return "";
+    }
+  }
+
+  // Whether the native vector of `field` holds its elements just like the
+  // buffer does, so UnPack can copy them in bulk.
+  bool IsBulkCopyVector(const FieldDef &field) {
+    const auto &type = field.value.type;
+    if (field.attributes.Lookup("cpp_type")) return false;
+    if (IsStruct(type.VectorType())) {
+      return !type.struct_def->attributes.Lookup("native_type");
+    }
+    return IsScalar(type.element) && !IsBool(type.element) &&
+           type.element != BASE_TYPE_UTYPE;
+  }
+
+  std::string GenUnpackFieldStatement(const FieldDef &field) {
     std::string code;
     switch (field.value.type.base_type) {
       case BASE_TYPE_VECTOR: {
-        auto name = Name(field);
-        if (field.value.type.element == BASE_TYPE_UTYPE) {
-          name = StripUnionType(Name(field));
-        }
+        const auto name = Name(field);
         code += "{ _o->" + name + ".resize(_e->size()); ";
         if (!field.value.type.enum_def && !IsBool(field.value.type.element) &&
             IsOneByte(field.value.type.element)) {
@@ -2668,6 +4076,11 @@ class CppGenerator : public BaseGenerator {
           //  - multiple-byte types due to endianness.
           code +=
               "std::copy(_e->begin(), _e->end(), _o->" + name + ".begin()); }";
+        } else if (IsBulkCopyVector(field)) {
+          // Vectors of scalars, enums and structs are copied all at once,
+          // with a memcpy where the in-memory layout matches the buffer.
+          code += "flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->" +
+                  name + ")); }";
         } else {
           std::string indexing;
           if (field.value.type.enum_def) {
@@ -2679,16 +4092,11 @@ class CppGenerator : public BaseGenerator {
           if (field.value.type.element == BASE_TYPE_BOOL) {
             indexing += " != 0";
           }
-          // Generate code that pushes data from _e to _o in the form:
+          // Generate code that unpacks data from _e to _o in the form:
           //   for (uoffset_t i = 0; i < _e->size(); ++i) {
-          //     _o->field.push_back(_e->Get(_i));
+          //     _o->field[_i] = _e->Get(_i);
           //   }
-          auto access =
-              field.value.type.element == BASE_TYPE_UTYPE
-                  ? ".type"
-                  : (field.value.type.element == BASE_TYPE_UNION ? ".value"
-                                                                 : "");
-
+          // reusing the elements _o->field already had.
           code += "for (flatbuffers::uoffset_t _i = 0;";
           code += " _i < _e->size(); _i++) { ";
           auto cpp_type = field.attributes.Lookup("cpp_type");
@@ -2701,42 +4109,31 @@ class CppGenerator : public BaseGenerator {
             code += "//vector resolver, " + PtrType(&field) + "\n";
             code += "if (_resolver) ";
             code += "(*_resolver)";
-            code += "(reinterpret_cast<void **>(&_o->" + name + "[_i]" +
-                    access + "), ";
+            code += "(reinterpret_cast<void **>(&_o->" + name + "[_i]), ";
             code +=
                 "static_cast<flatbuffers::hash_value_t>(" + indexing + "));";
             if (PtrType(&field) == "naked") {
               code += " else ";
-              code += "_o->" + name + "[_i]" + access + " = nullptr";
+              code += "_o->" + name + "[_i] = nullptr;";
             } else {
               // code += " else ";
-              // code += "_o->" + name + "[_i]" + access + " = " +
+              // code += "_o->" + name + "[_i] = " +
               // GenTypeNativePtr(cpp_type->constant, &field, true) + "();";
-              code += "/* else do nothing */";
+              code += "/* else do nothing */;";
             }
           } else {
-            code += "_o->" + name + "[_i]" + access + " = ";
-            code += GenUnpackVal(field.value.type.VectorType(), indexing, true,
-                                 field);
+            code += GenUnpackAssign(field.value.type.VectorType(),
+                                    "_o->" + name + "[_i]", indexing, true,
+                                    field);
           }
-          code += "; } }";
+          code += " } }";
         }
         break;
       }
-      case BASE_TYPE_UTYPE: {
-        FLATBUFFERS_ASSERT(union_field->value.type.base_type ==
-                           BASE_TYPE_UNION);
-        // Generate code that sets the union type, of the form:
-        //   _o->field.type = _e;
-        code += "_o->" + union_field->name + ".type = _e;";
-        break;
-      }
       case BASE_TYPE_UNION: {
-        // Generate code that sets the union value, of the form:
-        //   _o->field.value = Union::Unpack(_e, field_type(), resolver);
-        code += "_o->" + Name(field) + ".value = ";
-        code += GenUnionUnpackVal(field, "", "");
-        code += ";";
+        // Generate code that sets the union type and value, of the form:
+        //   _o->field.UnPackTo(_e, field_type(), resolver);
+        code += GenUnionUnpackTo(field, "_o->" + Name(field), "", "");
         break;
       }
       default: {
@@ -2764,8 +4161,14 @@ class CppGenerator : public BaseGenerator {
         } else {
           // Generate code for assigning the value, of the form:
           //  _o->field = value;
-          code += "_o->" + Name(field) + " = ";
-          code += GenUnpackVal(field.value.type, "_e", false, field) + ";";
+          auto assign = GenUnpackAssign(field.value.type, "_o->" + Name(field),
+                                        "_e", false, field);
+          // Tables and structs may be unpacked with an if/else of their own,
+          // kept apart from the else that resets absent fields.
+          if (field.value.type.base_type == BASE_TYPE_STRUCT) {
+            assign = "{ " + assign + " }";
+          }
+          code += assign;
         }
         break;
       }
@@ -2869,7 +4272,15 @@ class CppGenerator : public BaseGenerator {
             break;
           }
           case BASE_TYPE_BOOL: {
-            code += "_fbb.CreateVector(" + value + ")";
+            if (opts_.cpp_object_api_arena) {
+              // Only std::vector<bool> has a CreateVector overload.
+              code += "_fbb.CreateVector<uint8_t>(" + value +
+                      ".size(), [](size_t i, _VectorArgs *__va) { "
+                      "return static_cast<uint8_t>(__va->_" +
+                      value + "[i]); }, &_va)";
+            } else {
+              code += "_fbb.CreateVector(" + value + ")";
+            }
             break;
           }
           case BASE_TYPE_UNION: {
@@ -2956,6 +4367,42 @@ class CppGenerator : public BaseGenerator {
     return code;
   }
 
+  // Generate the statements of UnPackTo that unpack each field, only for the
+  // fields in |_fields| if |partial|.
+  void GenUnpackFields(const StructDef &struct_def, bool partial) {
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) { continue; }
+
+      // Union types are unpacked along with their union values.
+      if (field.value.type.base_type == BASE_TYPE_UTYPE ||
+          (IsVector(field.value.type) &&
+           field.value.type.element == BASE_TYPE_UTYPE)) {
+        continue;
+      }
+
+      // Assign a value from |this| to |_o|.   Values from |this| are stored
+      // in a variable |_e| by calling this->field_type().  The value is then
+      // assigned to |_o| using the GenUnpackFieldStatement, or reset if it
+      // is not present, as |_o| may be reused.
+      const auto statement = GenUnpackFieldStatement(field);
+
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("OFFSET_NAME", GenFieldOffsetName(field));
+      std::string prefix = partial ? "  if (_fields.Contains({{OFFSET_NAME}})) "
+                                   : "  ";
+      prefix += "{ auto _e = {{FIELD_NAME}}(); ";
+      auto postfix = " }";
+      if (IsScalar(field.value.type.base_type)) {
+        code_ += prefix + statement + postfix;
+      } else {
+        code_ += prefix + "if (_e) " + statement + " else " +
+                 GenUnpackFieldReset(field) + postfix;
+      }
+    }
+  }
+
   // Generate code for tables that needs to come after the regular definition.
   void GenTablePost(const StructDef &struct_def) {
     code_.SetValue("STRUCT_NAME", Name(struct_def));
@@ -2988,27 +4435,40 @@ class CppGenerator : public BaseGenerator {
           "inline " + TableUnPackToSignature(struct_def, false, opts_) + " {";
       code_ += "  (void)_o;";
       code_ += "  (void)_resolver;";
+      GenUnpackFields(struct_def, false);
+      code_ += "}";
+      code_ += "";
 
-      for (auto it = struct_def.fields.vec.begin();
-           it != struct_def.fields.vec.end(); ++it) {
-        const auto &field = **it;
-        if (field.deprecated) { continue; }
-
-        // Assign a value from |this| to |_o|.   Values from |this| are stored
-        // in a variable |_e| by calling this->field_type().  The value is then
-        // assigned to |_o| using the GenUnpackFieldStatement.
-        const bool is_union = field.value.type.base_type == BASE_TYPE_UTYPE;
-        const auto statement =
-            GenUnpackFieldStatement(field, is_union ? *(it + 1) : nullptr);
+      if (opts_.gen_partial_unpack) {
+        // Generate the overload that only unpacks the fields in a set, and
+        // leaves the others of |_o| as they are.
+        code_ += "inline " +
+                 TablePartialUnPackToSignature(struct_def, false, opts_) +
+                 " {";
+        code_ += "  (void)_o;";
+        code_ += "  (void)_fields;";
+        code_ += "  (void)_resolver;";
+        GenUnpackFields(struct_def, true);
+        code_ += "}";
+        code_ += "";
+      }
 
-        code_.SetValue("FIELD_NAME", Name(field));
-        auto prefix = "  { auto _e = {{FIELD_NAME}}(); ";
-        auto check = IsScalar(field.value.type.base_type) ? "" : "if (_e) ";
-        auto postfix = " }";
-        code_ += std::string(prefix) + check + statement + postfix;
+      if (opts_.cpp_object_api_arena) {
+        // Generate the overloads that unpack into an arena, by making it the
+        // current one for the duration of the regular UnPack / UnPackTo.
+        code_ += "inline " +
+                 TableArenaUnPackSignature(struct_def, false, opts_) + " {";
+        code_ += "  flatbuffers::ArenaScope _scope(_arena);";
+        code_ += "  return UnPack(_resolver);";
+        code_ += "}";
+        code_ += "";
+        code_ += "inline " +
+                 TableArenaUnPackToSignature(struct_def, false, opts_) + " {";
+        code_ += "  flatbuffers::ArenaScope _scope(_arena);";
+        code_ += "  UnPackTo(_o, _resolver);";
+        code_ += "}";
+        code_ += "";
       }
-      code_ += "}";
-      code_ += "";
 
       // Generate the X::Pack member function that simply calls the global
       // CreateX function.
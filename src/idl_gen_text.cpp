@@ -16,6 +16,9 @@
 
 // independent from idl_parser, since this code is not needed for most clients
 
+#include <cstdio>
+#include <fstream>
+
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/flexbuffers.h"
 #include "flatbuffers/idl.h"
@@ -110,6 +113,7 @@ struct JsonPrinter {
       }
       AddIndent(elem_indent);
       if (!PrintScalar(c[i], type, elem_indent)) { return false; }
+      if (!Flush(kFlushSize)) { return false; }
     }
     AddNewLine();
     AddIndent(indent);
@@ -139,6 +143,7 @@ struct JsonPrinter {
                        static_cast<soffset_t>(i))) {
         return false;
       }
+      if (!Flush(kFlushSize)) { return false; }
     }
     AddNewLine();
     AddIndent(indent);
@@ -237,6 +242,8 @@ struct JsonPrinter {
   }
 
   template<typename T> static T GetFieldDefault(const FieldDef &fd) {
+    // Optional scalars have no default, they are only printed when present.
+    if (fd.IsOptional()) return T();
     T val;
     auto check = StringToNumber(fd.value.constant.c_str(), &val);
     (void)check;
@@ -332,6 +339,7 @@ struct JsonPrinter {
         } else {
           prev_val = table->GetAddressOf(fd.value.offset);
         }
+        if (!Flush(kFlushSize)) { return false; }
       }
     }
     AddNewLine();
@@ -340,21 +348,48 @@ struct JsonPrinter {
     return true;
   }
 
-  JsonPrinter(const Parser &parser, std::string &dest)
-      : opts(parser.opts), text(dest) {
-    text.reserve(1024);  // Reduce amount of inevitable reallocs.
+  // When writing to a sink, text is passed on once this much has been
+  // collected.
+  static const size_t kFlushSize = 1 << 16;
+
+  // Hands the collected text to the sink, if there is one and at least
+  // `threshold` bytes of it.
+  bool Flush(size_t threshold) {
+    if (!sink || text.size() < threshold || text.empty()) return true;
+    if (!sink->Write(text.data(), text.size())) return false;
+    text.clear();
+    return true;
+  }
+
+  JsonPrinter(const Parser &parser, std::string &dest, TextSink *_sink)
+      : opts(parser.opts), text(dest), sink(_sink) {
+    // Reduce amount of inevitable reallocs.
+    text.reserve(sink ? kFlushSize + 1024 : 1024);
   }
 
   const IDLOptions &opts;
   std::string &text;
+  TextSink *sink;
 };
 
 static bool GenerateTextImpl(const Parser &parser, const Table *table,
-                             const StructDef &struct_def, std::string *_text) {
-  JsonPrinter printer(parser, *_text);
+                             const StructDef &struct_def, std::string *_text,
+                             TextSink *sink) {
+  JsonPrinter printer(parser, *_text, sink);
   if (!printer.GenStruct(struct_def, table, 0)) { return false; }
   printer.AddNewLine();
-  return true;
+  return printer.Flush(0);
+}
+
+static bool GenerateTextImpl(const Parser &parser, const Table *table,
+                             const StructDef &struct_def, std::string *_text) {
+  return GenerateTextImpl(parser, table, struct_def, _text, nullptr);
+}
+
+static bool GenerateTextImpl(const Parser &parser, const Table *table,
+                             const StructDef &struct_def, TextSink *sink) {
+  std::string buffer;
+  return GenerateTextImpl(parser, table, struct_def, &buffer, sink);
 }
 
 // Generate a text representation of a flatbuffer in JSON format.
@@ -366,15 +401,48 @@ bool GenerateTextFromTable(const Parser &parser, const void *table,
   return GenerateTextImpl(parser, root, *struct_def, _text);
 }
 
+bool GenerateTextFromTable(const Parser &parser, const void *table,
+                           const std::string &table_name, TextSink *sink) {
+  auto struct_def = parser.LookupStruct(table_name);
+  if (struct_def == nullptr) { return false; }
+  auto root = static_cast<const Table *>(table);
+  return GenerateTextImpl(parser, root, *struct_def, sink);
+}
+
+static const Table *GetTextRoot(const Parser &parser, const void *flatbuffer) {
+  FLATBUFFERS_ASSERT(parser.root_struct_def_);  // call SetRootType()
+  return parser.opts.size_prefixed ? GetSizePrefixedRoot<Table>(flatbuffer)
+                                   : GetRoot<Table>(flatbuffer);
+}
+
 // Generate a text representation of a flatbuffer in JSON format.
 bool GenerateText(const Parser &parser, const void *flatbuffer,
                   std::string *_text) {
-  FLATBUFFERS_ASSERT(parser.root_struct_def_);  // call SetRootType()
-  auto root = parser.opts.size_prefixed ? GetSizePrefixedRoot<Table>(flatbuffer)
-                                        : GetRoot<Table>(flatbuffer);
-  return GenerateTextImpl(parser, root, *parser.root_struct_def_, _text);
+  return GenerateTextImpl(parser, GetTextRoot(parser, flatbuffer),
+                          *parser.root_struct_def_, _text);
 }
 
+bool GenerateText(const Parser &parser, const void *flatbuffer,
+                  TextSink *sink) {
+  return GenerateTextImpl(parser, GetTextRoot(parser, flatbuffer),
+                          *parser.root_struct_def_, sink);
+}
+
+namespace {
+class FileTextSink : public TextSink {
+ public:
+  explicit FileTextSink(const std::string &name) : ofs_(name.c_str()) {}
+  bool is_open() const { return ofs_.is_open(); }
+  bool Write(const char *text, size_t size) FLATBUFFERS_OVERRIDE {
+    ofs_.write(text, static_cast<std::streamsize>(size));
+    return !ofs_.bad();
+  }
+
+ private:
+  std::ofstream ofs_;
+};
+}  // namespace
+
 static std::string TextFileName(const std::string &path,
                                 const std::string &file_name) {
   return path + file_name + ".json";
@@ -389,12 +457,17 @@ bool GenerateTextFile(const Parser &parser, const std::string &path,
                                  json.c_str(), json.size(), true);
   }
   if (!parser.builder_.GetSize() || !parser.root_struct_def_) return true;
-  std::string text;
-  if (!GenerateText(parser, parser.builder_.GetBufferPointer(), &text)) {
-    return false;
+  // Stream the text to the file, large buffers would otherwise need all of
+  // their text in memory at once.
+  const auto filename = TextFileName(path, file_name);
+  bool ok;
+  {
+    FileTextSink sink(filename);
+    if (!sink.is_open()) return false;
+    ok = GenerateText(parser, parser.builder_.GetBufferPointer(), &sink);
   }
-  return flatbuffers::SaveFile(TextFileName(path, file_name).c_str(), text,
-                               false);
+  if (!ok) std::remove(filename.c_str());
+  return ok;
 }
 
 std::string TextMakeRule(const Parser &parser, const std::string &path,
@@ -335,6 +335,7 @@ CheckedError Parser::Next() {
   bool seen_newline = cursor_ == source_;
   attribute_.clear();
   attr_is_trivial_ascii_string_ = true;
+  attr_source_ = nullptr;
   for (;;) {
     char c = *cursor_++;
     token_ = c;
@@ -363,12 +364,14 @@ CheckedError Parser::Next() {
       case '\"':
       case '\'': {
         int unicode_high_surrogate = -1;
+        attr_source_ = cursor_;
 
         while (*cursor_ != c) {
           if (*cursor_ < ' ' && static_cast<signed char>(*cursor_) >= 0)
             return Error("illegal character in string constant");
           if (*cursor_ == '\\') {
             attr_is_trivial_ascii_string_ = false;  // has escape sequence
+            attr_source_ = nullptr;
             cursor_++;
             if (unicode_high_surrogate != -1 && *cursor_ != 'u') {
               return Error(
@@ -456,11 +459,17 @@ CheckedError Parser::Next() {
               return Error(
                   "illegal Unicode sequence (unpaired high surrogate)");
             }
-            // reset if non-printable
-            attr_is_trivial_ascii_string_ &=
-                check_ascii_range(*cursor_, ' ', '~');
-
-            attribute_ += *cursor_++;
+            // Append the whole run of plain characters at once.
+            const char *run = cursor_;
+            do {
+              // reset if non-printable
+              attr_is_trivial_ascii_string_ &=
+                  check_ascii_range(*cursor_, ' ', '~');
+              cursor_++;
+            } while (*cursor_ != c && *cursor_ != '\\' &&
+                     (*cursor_ >= ' ' ||
+                      static_cast<signed char>(*cursor_) < 0));
+            attribute_.append(run, cursor_);
           }
         }
         if (unicode_high_surrogate != -1) {
@@ -506,6 +515,7 @@ CheckedError Parser::Next() {
           const char *start = cursor_ - 1;
           while (IsIdentifierStart(*cursor_) || is_digit(*cursor_)) cursor_++;
           attribute_.append(start, cursor_);
+          attr_source_ = start;
           token_ = has_sign ? kTokenStringConstant : kTokenIdentifier;
           return NoError();
         }
@@ -598,7 +608,8 @@ CheckedError Parser::ParseNamespacing(std::string *id, std::string *last) {
 
 EnumDef *Parser::LookupEnum(const std::string &id) {
   // Search thru parent namespaces.
-  return LookupTableByName(enums_, id, *current_namespace_, 0);
+  return LookupTableByName(schema_ ? schema_->enums_ : enums_, id,
+                           *current_namespace_, 0);
 }
 
 StructDef *Parser::LookupStruct(const std::string &id) const {
@@ -1015,12 +1026,21 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
 }
 
 CheckedError Parser::ParseString(Value &val, bool use_string_pooling) {
-  auto s = attribute_;
+  // Strings without escapes are serialized straight from the source text,
+  // others are copied out of attribute_ before Next() reuses it, which keeps
+  // the capacity of attribute_ for the following tokens.
+  auto s = attr_source_;
+  const auto len = attribute_.size();
+  std::string unescaped;
+  if (!s && Is(kTokenStringConstant)) {
+    unescaped.assign(attribute_);
+    s = unescaped.c_str();
+  }
   EXPECT(kTokenStringConstant);
   if (use_string_pooling) {
-    val.constant = NumToString(builder_.CreateSharedString(s).o);
+    val.constant = NumToString(builder_.CreateSharedString(s, len).o);
   } else {
-    val.constant = NumToString(builder_.CreateString(s).o);
+    val.constant = NumToString(builder_.CreateString(s, len).o);
   }
   return NoError();
 }
@@ -1211,11 +1231,89 @@ CheckedError Parser::ParseTableDelimiters(size_t &fieldn,
   return NoError();
 }
 
+static bool HasOnlyScalarFields(const StructDef &struct_def) {
+  for (auto it = struct_def.fields.vec.begin();
+       it != struct_def.fields.vec.end(); ++it) {
+    if (!IsScalar((*it)->value.type.base_type) || (*it)->flexbuffer)
+      return false;
+  }
+  return true;
+}
+
+// Tables without any sub-objects don't need their values to be buffered:
+// nothing else gets serialized while they're parsed, so each value can be
+// added to the table under construction as soon as it is parsed.
+CheckedError Parser::ParseScalarTable(const StructDef &struct_def,
+                                      std::string *value, uoffset_t *ovalue) {
+  fields_seen_.assign(struct_def.fields.vec.size(), false);
+  auto start = builder_.StartTable();
+  size_t fieldn_outer = 0;
+  auto err = ParseTableDelimiters(
+      fieldn_outer, &struct_def,
+      [&](const std::string &name, size_t &fieldn,
+          const StructDef *struct_def_inner) -> CheckedError {
+        if (name == "$schema") {
+          ECHECK(Expect(kTokenStringConstant));
+          return NoError();
+        }
+        auto field = struct_def_inner->fields.Lookup(name);
+        if (!field) {
+          if (!opts.skip_unexpected_fields_in_json) {
+            return Error("unknown field: " + name);
+          } else {
+            ECHECK(SkipAnyJsonValue());
+          }
+          return NoError();
+        }
+        const auto index =
+            static_cast<size_t>(field->value.offset / sizeof(voffset_t) - 2);
+        FLATBUFFERS_ASSERT(index < fields_seen_.size());
+        if (fields_seen_[index])
+          return Error("field set more than once: " + field->name);
+        fields_seen_[index] = true;
+        Value val = field->value;
+        ECHECK(ParseAnyValue(val, field, fieldn, struct_def_inner, 0));
+        switch (val.type.base_type) {
+          // clang-format off
+          #define FLATBUFFERS_TD(ENUM, IDLTYPE, CTYPE, ...) \
+            case BASE_TYPE_ ## ENUM: { \
+              if (field->IsOptional() && val.constant == "null") break; \
+              CTYPE v; \
+              ECHECK(atot(val.constant.c_str(), *this, &v)); \
+              if (field->IsOptional()) { \
+                builder_.AddElement(val.offset, v); \
+              } else { \
+                CTYPE def; \
+                ECHECK(atot(field->value.constant.c_str(), *this, &def)); \
+                builder_.AddElement(val.offset, v, def); \
+              } \
+              break; \
+            }
+            FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD)
+          #undef FLATBUFFERS_TD
+          // clang-format on
+          default: FLATBUFFERS_ASSERT(false);
+        }
+        fieldn++;
+        return NoError();
+      });
+  ECHECK(err);
+  auto val = builder_.EndTable(start);
+  if (ovalue) *ovalue = val;
+  if (value) *value = NumToString(val);
+  return NoError();
+}
+
 CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
                                 uoffset_t *ovalue) {
   ParseDepthGuard depth_guard(this);
   ECHECK(depth_guard.Check());
 
+  if (opts.json_direct_scalar_tables && !struct_def.fixed &&
+      HasOnlyScalarFields(struct_def)) {
+    return ParseScalarTable(struct_def, value, ovalue);
+  }
+
   size_t fieldn_outer = 0;
   auto err = ParseTableDelimiters(
       fieldn_outer, &struct_def,
@@ -1317,6 +1415,11 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
                 CTYPE val; \
                 ECHECK(atot(field_value.constant.c_str(), *this, &val)); \
                 builder_.PushElement(val); \
+              } else if (field->IsOptional()) { \
+                if (field_value.constant == "null") break; \
+                CTYPE val; \
+                ECHECK(atot(field_value.constant.c_str(), *this, &val)); \
+                builder_.AddElement(field_value.offset, val); \
               } else { \
                 CTYPE val, valdef; \
                 ECHECK(atot(field_value.constant.c_str(), *this, &val)); \
@@ -1651,22 +1754,15 @@ CheckedError Parser::ParseNestedFlatbuffer(Value &val, FieldDef *field,
     ECHECK(SkipAnyJsonValue());
     std::string substring(cursor_at_value_begin - 1, cursor_ - 1);
 
-    // Create and initialize new parser
-    Parser nested_parser;
+    // Create a new parser sharing our schema.
+    Parser nested_parser(*this, opts);
     FLATBUFFERS_ASSERT(field->nested_flatbuffer);
     nested_parser.root_struct_def_ = field->nested_flatbuffer;
-    nested_parser.enums_ = enums_;
-    nested_parser.opts = opts;
-    nested_parser.uses_flexbuffers_ = uses_flexbuffers_;
+    nested_parser.file_identifier_.clear();
     nested_parser.parse_depth_counter_ = parse_depth_counter_;
     // Parse JSON substring into new flatbuffer builder using nested_parser
     bool ok = nested_parser.Parse(substring.c_str(), nullptr, nullptr);
 
-    // Clean nested_parser to avoid deleting the elements in
-    // the SymbolTables on destruction
-    nested_parser.enums_.dict.clear();
-    nested_parser.enums_.vec.clear();
-
     if (!ok) { ECHECK(Error(nested_parser.error_)); }
     // Force alignment for nested flatbuffer
     builder_.ForceVectorAlignment(
@@ -2615,6 +2711,7 @@ CheckedError Parser::ParseService() {
 }
 
 bool Parser::SetRootType(const char *name) {
+  if (schema_) return false;  // The borrowed definitions are read-only.
   root_struct_def_ = LookupStruct(name);
   if (!root_struct_def_)
     root_struct_def_ =
@@ -3065,6 +3162,10 @@ CheckedError Parser::ParseFlexBufferValue(flexbuffers::Builder *builder) {
 
 bool Parser::ParseFlexBuffer(const char *source, const char *source_filename,
                              flexbuffers::Builder *builder) {
+  if (schema_) {
+    error_ = "a parser sharing its schema can only parse json";
+    return false;
+  }
   const auto initial_depth = parse_depth_counter_;
   (void)initial_depth;
   auto ok = !StartParseFile(source, source_filename).Check() &&
@@ -3074,6 +3175,34 @@ bool Parser::ParseFlexBuffer(const char *source, const char *source_filename,
   return ok;
 }
 
+Parser::Parser(const Parser &schema, const IDLOptions &options)
+    : current_namespace_(schema.current_namespace_),
+      empty_namespace_(schema.empty_namespace_),
+      flex_builder_(256, flexbuffers::BUILDER_FLAG_SHARE_ALL),
+      root_struct_def_(schema.root_struct_def_),
+      file_identifier_(schema.file_identifier_),
+      file_extension_(schema.file_extension_),
+      opts(options),
+      uses_flexbuffers_(schema.uses_flexbuffers_),
+      source_(nullptr),
+      schema_(schema.schema_ ? schema.schema_ : &schema),
+      anonymous_counter_(0),
+      parse_depth_counter_(0) {
+  if (opts.force_defaults) { builder_.ForceDefaults(true); }
+}
+
+// Generate a unique hash for a file based on its name and contents (if any).
+static uint64_t HashFile(const char *source_filename, const char *source) {
+  uint64_t hash = 0;
+
+  if (source_filename)
+    hash = HashFnv1a<uint64_t>(StripPath(source_filename).c_str());
+
+  if (source && *source) hash ^= HashFnv1a<uint64_t>(source);
+
+  return hash;
+}
+
 bool Parser::Parse(const char *source, const char **include_paths,
                    const char *source_filename) {
   const auto initial_depth = parse_depth_counter_;
@@ -3083,6 +3212,20 @@ bool Parser::Parse(const char *source, const char **include_paths,
   if (opts.use_flexbuffers) {
     r = ParseFlexBuffer(source, source_filename, &flex_builder_);
   } else {
+    // Files may have changed on disk since the previous call.
+    include_file_hashes_.clear();
+    ForgottenFiles forgotten;
+    if (source_filename && !schema_) {
+      auto parsed = parsed_file_hashes_.find(source_filename);
+      if (parsed != parsed_file_hashes_.end() &&
+          parsed->second != HashFile(source_filename,
+                                     FileExists(source_filename) ? source
+                                                                 : nullptr)) {
+        ForgetFile(source_filename, &forgotten);
+      }
+      ForgetChangedIncludes(source_filename, &forgotten);
+    }
+    ReparseFiles(forgotten, include_paths, source_filename);
     r = !ParseRoot(source, include_paths, source_filename).Check();
   }
   FLATBUFFERS_ASSERT(initial_depth == parse_depth_counter_);
@@ -3195,16 +3338,227 @@ CheckedError Parser::ParseRoot(const char *source, const char **include_paths,
   return NoError();
 }
 
-// Generate a unique hash for a file based on its name and contents (if any).
-static uint64_t HashFile(const char *source_filename, const char *source) {
-  uint64_t hash = 0;
+// Whether |type| refers to one of the definitions in |defs|.
+static bool RefersTo(const Type &type, const std::set<const void *> &defs) {
+  return defs.count(type.struct_def) || defs.count(type.enum_def);
+}
 
-  if (source_filename)
-    hash = HashFnv1a<uint64_t>(StripPath(source_filename).c_str());
+// Removes the definitions declared in one of |files| from |table|, and
+// returns them.
+template<typename T>
+static std::vector<T *> UnlinkDefinitions(SymbolTable<T> *table,
+                                          const std::set<std::string> &files) {
+  std::vector<T *> unlinked;
+  for (auto it = table->dict.begin(); it != table->dict.end();) {
+    if (files.count(it->second->file)) {
+      table->dict.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  size_t kept = 0;
+  for (auto it = table->vec.begin(); it != table->vec.end(); ++it) {
+    if (files.count((*it)->file)) {
+      unlinked.push_back(*it);
+    } else {
+      table->vec[kept++] = *it;
+    }
+  }
+  table->vec.resize(kept);
+  return unlinked;
+}
+
+// Forgets the included files of |filename|, parsed by an earlier Parse(),
+// that have changed on disk since, so that they are parsed again. The
+// hashes of the others are kept for this Parse(). A file whose size and
+// modification time are the same as when it was hashed isn't read again.
+void Parser::ForgetChangedIncludes(const std::string &filename,
+                                   ForgottenFiles *forgotten) {
+  std::set<std::string> visited;
+  std::vector<std::string> stack(1, filename);
+  while (!stack.empty()) {
+    auto file = stack.back();
+    stack.pop_back();
+    auto includes = files_included_per_file_.find(file);
+    if (includes == files_included_per_file_.end()) continue;
+    for (auto it = includes->second.begin(); it != includes->second.end();
+         ++it) {
+      if (!visited.insert(*it).second) continue;
+      auto parsed = parsed_file_hashes_.find(*it);
+      auto known = file_times_.find(*it);
+      std::pair<uint64_t, int64_t> times;
+      auto has_times = FileSizeAndTime(it->c_str(), &times.first,
+                                       &times.second);
+      uint64_t hash;
+      if (has_times && parsed != parsed_file_hashes_.end() &&
+          known != file_times_.end() && known->second == times) {
+        hash = parsed->second;
+      } else {
+        std::string contents;
+        if (!LoadFile(it->c_str(), true, &contents)) continue;
+        hash = HashFile(it->c_str(), contents.c_str());
+        if (has_times) file_times_[*it] = times;
+      }
+      include_file_hashes_[*it] = hash;
+      if (parsed != parsed_file_hashes_.end() && parsed->second != hash) {
+        ForgetFile(*it, forgotten);
+      } else {
+        stack.push_back(*it);
+      }
+    }
+  }
+}
 
-  if (source && *source) hash ^= HashFnv1a<uint64_t>(source);
+// Removes the definitions of |filename| and of every file that depends on
+// it, either by including it or by referring to its definitions, so that
+// all of them are parsed again the next time they are included.
+// The removed files are added to |forgotten|, if given.
+void Parser::ForgetFile(const std::string &filename,
+                        ForgottenFiles *forgotten) {
+  if (parsed_file_hashes_.find(filename) == parsed_file_hashes_.end()) return;
+  std::set<std::string> files;
+  std::vector<std::string> queue(1, filename);
+  for (;;) {
+    while (!queue.empty()) {
+      auto file = queue.back();
+      queue.pop_back();
+      if (!files.insert(file).second) continue;
+      for (auto it = files_included_per_file_.begin();
+           it != files_included_per_file_.end(); ++it) {
+        if (it->second.count(file)) queue.push_back(it->first);
+      }
+    }
+    // Files that use a definition without including the file declaring it.
+    std::set<const void *> defs;
+    for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+      if (files.count((*it)->file)) defs.insert(*it);
+    }
+    for (auto it = enums_.vec.begin(); it != enums_.vec.end(); ++it) {
+      if (files.count((*it)->file)) defs.insert(*it);
+    }
+    for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+      if (files.count((*it)->file)) continue;
+      auto &fields = (*it)->fields.vec;
+      for (auto f = fields.begin(); f != fields.end(); ++f) {
+        if (RefersTo((*f)->value.type, defs) ||
+            defs.count((*f)->nested_flatbuffer)) {
+          queue.push_back((*it)->file);
+        }
+      }
+    }
+    for (auto it = enums_.vec.begin(); it != enums_.vec.end(); ++it) {
+      if (files.count((*it)->file)) continue;
+      auto &vals = (*it)->Vals();
+      for (auto v = vals.begin(); v != vals.end(); ++v) {
+        if (RefersTo((*v)->union_type, defs)) queue.push_back((*it)->file);
+      }
+    }
+    for (auto it = services_.vec.begin(); it != services_.vec.end(); ++it) {
+      if (files.count((*it)->file)) continue;
+      auto &calls = (*it)->calls.vec;
+      for (auto c = calls.begin(); c != calls.end(); ++c) {
+        if (defs.count((*c)->request) || defs.count((*c)->response)) {
+          queue.push_back((*it)->file);
+        }
+      }
+    }
+    if (queue.empty()) break;
+  }
 
-  return hash;
+  if (forgotten) {
+    for (auto it = files.begin(); it != files.end(); ++it) {
+      auto parsed = parsed_file_hashes_.find(*it);
+      auto included = parsed != parsed_file_hashes_.end()
+                          ? included_files_.find(parsed->second)
+                          : included_files_.end();
+      (*forgotten)[*it].root =
+          included != included_files_.end() && included->second.empty();
+    }
+    for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+      auto file = forgotten->find((*it)->file);
+      if (file != forgotten->end() && (*it)->generated)
+        file->second.generated = true;
+    }
+    for (auto it = enums_.vec.begin(); it != enums_.vec.end(); ++it) {
+      auto file = forgotten->find((*it)->file);
+      if (file != forgotten->end() && (*it)->generated)
+        file->second.generated = true;
+    }
+    for (auto it = services_.vec.begin(); it != services_.vec.end(); ++it) {
+      auto file = forgotten->find((*it)->file);
+      if (file != forgotten->end() && (*it)->generated)
+        file->second.generated = true;
+    }
+  }
+
+  auto structs = UnlinkDefinitions(&structs_, files);
+  auto enums = UnlinkDefinitions(&enums_, files);
+  auto services = UnlinkDefinitions(&services_, files);
+  std::set<const void *> defs(structs.begin(), structs.end());
+  defs.insert(enums.begin(), enums.end());
+  for (auto it = types_.dict.begin(); it != types_.dict.end();) {
+    if (RefersTo(*it->second, defs)) {
+      types_.dict.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  size_t kept = 0;
+  for (auto it = types_.vec.begin(); it != types_.vec.end(); ++it) {
+    if (RefersTo(**it, defs)) {
+      delete *it;
+    } else {
+      types_.vec[kept++] = *it;
+    }
+  }
+  types_.vec.resize(kept);
+  if (defs.count(root_struct_def_)) root_struct_def_ = nullptr;
+  for (auto it = structs.begin(); it != structs.end(); ++it) delete *it;
+  for (auto it = enums.begin(); it != enums.end(); ++it) delete *it;
+  for (auto it = services.begin(); it != services.end(); ++it) delete *it;
+
+  for (auto it = files.begin(); it != files.end(); ++it) {
+    auto parsed = parsed_file_hashes_.find(*it);
+    if (parsed != parsed_file_hashes_.end()) {
+      included_files_.erase(parsed->second);
+      parsed_file_hashes_.erase(parsed);
+    }
+    files_included_per_file_.erase(*it);
+  }
+}
+
+// Parses the root files among |files| again, which were forgotten because
+// a file they depend on changed, so that parsing |source_filename| leaves
+// the definitions of the files it doesn't include in place. A file that can
+// no longer be parsed is left out. The definitions of all of |files| are
+// then marked as generated as they were before.
+void Parser::ReparseFiles(const ForgottenFiles &files,
+                          const char **include_paths,
+                          const char *source_filename) {
+  if (files.empty()) return;
+  for (auto it = files.begin(); it != files.end(); ++it) {
+    if (!it->second.root) continue;
+    if (source_filename && it->first == source_filename) continue;
+    std::string contents;
+    if (!LoadFile(it->first.c_str(), true, &contents)) continue;
+    if (ParseRoot(contents.c_str(), include_paths, it->first.c_str())
+            .Check()) {
+      ForgetFile(it->first, nullptr);
+    }
+  }
+  for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+    auto file = files.find((*it)->file);
+    if (file != files.end() && !(*it)->predecl)
+      (*it)->generated = file->second.generated;
+  }
+  for (auto it = enums_.vec.begin(); it != enums_.vec.end(); ++it) {
+    auto file = files.find((*it)->file);
+    if (file != files.end()) (*it)->generated = file->second.generated;
+  }
+  for (auto it = services_.vec.begin(); it != services_.vec.end(); ++it) {
+    auto file = files.find((*it)->file);
+    if (file != files.end()) (*it)->generated = file->second.generated;
+  }
 }
 
 CheckedError Parser::DoParse(const char *source, const char **include_paths,
@@ -3214,13 +3568,24 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
   if (source_filename) {
     // If the file is in-memory, don't include its contents in the hash as we
     // won't be able to load them later.
-    if (FileExists(source_filename))
+    auto cached = include_filename ? include_file_hashes_.find(source_filename)
+                                   : include_file_hashes_.end();
+    if (cached != include_file_hashes_.end())
+      source_hash = cached->second;
+    else if (FileExists(source_filename))
       source_hash = HashFile(source_filename, source);
     else
       source_hash = HashFile(source_filename, nullptr);
 
     if (included_files_.find(source_hash) == included_files_.end()) {
+      // A different version of this file was parsed before: drop it first.
+      auto parsed = parsed_file_hashes_.find(source_filename);
+      if (!schema_ && parsed != parsed_file_hashes_.end() &&
+          parsed->second != source_hash) {
+        ForgetFile(source_filename, nullptr);
+      }
       included_files_[source_hash] = include_filename ? include_filename : "";
+      parsed_file_hashes_[source_filename] = source_hash;
       files_included_per_file_[source_filename] = std::set<std::string>();
     } else {
       return NoError();
@@ -3237,6 +3602,10 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
 
   ECHECK(StartParseFile(source, source_filename));
 
+  // The definitions of a shared schema can't be extended.
+  if (schema_ && token_ != '{')
+    return Error("a parser sharing its schema can only parse json");
+
   // Includes must come before type declarations:
   for (;;) {
     // Parse pre-include proto statements if any:
@@ -3273,11 +3642,27 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
         files_included_per_file_[source_filename].insert(filepath);
 
       std::string contents;
-      bool file_loaded = LoadFile(filepath.c_str(), true, &contents);
-      if (included_files_.find(HashFile(filepath.c_str(), contents.c_str())) ==
-          included_files_.end()) {
+      bool file_loaded = false;
+      uint64_t include_hash;
+      auto cached = include_file_hashes_.find(filepath);
+      if (cached != include_file_hashes_.end()) {
+        include_hash = cached->second;
+      } else {
+        std::pair<uint64_t, int64_t> times;
+        auto has_times =
+            FileSizeAndTime(filepath.c_str(), &times.first, &times.second);
+        file_loaded = LoadFile(filepath.c_str(), true, &contents);
+        include_hash = HashFile(filepath.c_str(), contents.c_str());
+        if (file_loaded) {
+          include_file_hashes_[filepath] = include_hash;
+          if (has_times) file_times_[filepath] = times;
+        }
+      }
+      if (included_files_.find(include_hash) == included_files_.end()) {
         // We found an include file that we have not parsed yet.
         // Parse it.
+        if (!file_loaded)
+          file_loaded = LoadFile(filepath.c_str(), true, &contents);
         if (!file_loaded) return Error("unable to load include file: " + name);
         ECHECK(DoParse(contents.c_str(), include_paths, filepath.c_str(),
                        name.c_str()));
@@ -3429,6 +3814,7 @@ template<typename T> void AssignIndices(const std::vector<T *> &defvec) {
 }
 
 void Parser::Serialize() {
+  FLATBUFFERS_ASSERT(!schema_);  // Its own tables are empty.
   builder_.Clear();
   AssignIndices(structs_.vec);
   AssignIndices(enums_.vec);
@@ -3807,6 +4193,7 @@ bool Parser::Deserialize(const uint8_t *buf, const size_t size) {
 }
 
 bool Parser::Deserialize(const reflection::Schema *schema) {
+  if (schema_) return false;  // The borrowed definitions are read-only.
   file_identifier_ = schema->file_ident() ? schema->file_ident()->str() : "";
   file_extension_ = schema->file_ext() ? schema->file_ext()->str() : "";
   std::map<std::string, Namespace *> namespaces_index;
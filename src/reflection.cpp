@@ -16,6 +16,10 @@
 
 #include "flatbuffers/reflection.h"
 
+#include <chrono>
+#include <map>
+
+#include "flatbuffers/patch.h"
 #include "flatbuffers/util.h"
 
 // Helper functionality for reflection.
@@ -166,6 +170,39 @@ void SetAnyValueS(reflection::BaseType type, uint8_t *data, const char *val) {
   }
 }
 
+bool FieldPath::Resolve(const reflection::Schema &schema,
+                        const reflection::Object &objectdef,
+                        const char *path) {
+  steps_.clear();
+  field_ = nullptr;
+  auto obj = &objectdef;
+  const reflection::Field *field = nullptr;
+  for (;;) {
+    auto end = strchr(path, '.');
+    auto name = end ? std::string(path, end) : std::string(path);
+    field = obj->fields()->LookupByKey(name.c_str());
+    if (!field) return false;
+    Step step;
+    step.offset = field->offset();
+    step.in_table = !obj->is_struct();
+    step.indirect = false;
+    if (end) {
+      // Only tables and structs have fields to go into.
+      if (field->type()->base_type() != reflection::Obj) return false;
+      obj = schema.objects()->Get(field->type()->index());
+      step.indirect = step.in_table && !obj->is_struct();
+      path = end + 1;
+    }
+    steps_.push_back(step);
+    if (!end) break;
+  }
+  field_ = field;
+  base_type_ = field->type()->base_type();
+  default_integer_ = field->default_integer();
+  default_real_ = field->default_real();
+  return true;
+}
+
 // Resize a FlatBuffer in-place by iterating through all offsets in the buffer
 // and adjusting them by "delta" if they straddle the start offset.
 // Once that is done, bytes can now be inserted/deleted safely.
@@ -351,6 +388,209 @@ uint8_t *ResizeAnyVector(const reflection::Schema &schema, uoffset_t newsize,
   return vector_data(*flatbuf) + start;
 }
 
+void ResizeBatch::AddEdit(uoffset_t obj, uoffset_t old_bytes,
+                          uoffset_t newsize, uoffset_t new_bytes,
+                          bool is_string, const std::string &payload) {
+  Edit edit;
+  edit.obj = obj;
+  // Like ResizeContext, we resize at the end of the data, in multiples of
+  // the largest alignment.
+  edit.start = obj + static_cast<uoffset_t>(sizeof(uoffset_t)) + old_bytes;
+  auto mask = static_cast<int>(sizeof(largest_scalar_t) - 1);
+  edit.delta =
+      (static_cast<int>(new_bytes) - static_cast<int>(old_bytes) + mask) &
+      ~mask;
+  edit.old_bytes = old_bytes;
+  edit.newsize = newsize;
+  edit.new_bytes = new_bytes;
+  edit.is_string = is_string;
+  edit.payload = payload;
+  edits_.push_back(edit);
+}
+
+void ResizeBatch::SetString(const String *str, const std::string &val) {
+  auto obj = static_cast<uoffset_t>(reinterpret_cast<const uint8_t *>(str) -
+                                    vector_data(buf_));
+  auto size = static_cast<uoffset_t>(val.size());
+  AddEdit(obj, str->size(), size, size, true, val);
+}
+
+void ResizeBatch::ResizeAnyVector(const VectorOfAny *vec, uoffset_t newsize,
+                                  uoffset_t num_elems, uoffset_t elem_size,
+                                  const uint8_t *fill) {
+  auto obj = static_cast<uoffset_t>(reinterpret_cast<const uint8_t *>(vec) -
+                                    vector_data(buf_));
+  AddEdit(obj, num_elems * elem_size, newsize, newsize * elem_size, false,
+          fill ? std::string(reinterpret_cast<const char *>(fill), elem_size)
+               : std::string());
+}
+
+// Where a byte of the old buffer ends up in the new one.
+uoffset_t ResizeBatch::Map(uoffset_t pos) const {
+  auto idx = std::upper_bound(starts_.begin(), starts_.end(), pos) -
+             starts_.begin();
+  return idx ? static_cast<uoffset_t>(static_cast<int>(pos) + shifts_[idx - 1])
+             : pos;
+}
+
+// Whether a byte of the old buffer is removed by a shrinking edit, which
+// deletes the bytes just before its start.
+bool ResizeBatch::Erased(uoffset_t pos) const {
+  auto idx = std::upper_bound(starts_.begin(), starts_.end(), pos) -
+             starts_.begin();
+  if (idx == static_cast<ptrdiff_t>(starts_.size())) return false;
+  auto delta = shifts_[idx] - (idx ? shifts_[idx - 1] : 0);
+  return delta < 0 && static_cast<int>(pos) >= static_cast<int>(starts_[idx]) +
+                                                   delta;
+}
+
+// The old buffer is never modified, so offsets can always be read from it,
+// and each one is rewritten in the new buffer based on where both its
+// location and its target end up.
+void ResizeBatch::FixOffset(uoffset_t loc, std::vector<uint8_t> &newbuf) const {
+  if (Erased(loc)) return;
+  auto ref = loc + ReadScalar<uoffset_t>(vector_data(buf_) + loc);
+  WriteScalar<uoffset_t>(vector_data(newbuf) + Map(loc), Map(ref) - Map(loc));
+}
+
+void ResizeBatch::FixTable(const reflection::Object &objectdef,
+                           uoffset_t table, std::vector<uint8_t> &newbuf) {
+  if (visited_[table / sizeof(uoffset_t)]) return;  // Table already visited.
+  visited_[table / sizeof(uoffset_t)] = true;
+  auto tableloc = vector_data(buf_) + table;
+  auto vtable = static_cast<uoffset_t>(
+      static_cast<soffset_t>(table) - ReadScalar<soffset_t>(tableloc));
+  WriteScalar<soffset_t>(
+      vector_data(newbuf) + Map(table),
+      static_cast<soffset_t>(Map(table)) - static_cast<soffset_t>(Map(vtable)));
+  // Early out: since all fields inside the table must point forwards in
+  // memory, if all insertion points are before the table we can stop here.
+  if (starts_.back() <= table) return;
+  auto tableptr = reinterpret_cast<const Table *>(tableloc);
+  auto fielddefs = objectdef.fields();
+  for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+    auto &fielddef = **it;
+    auto base_type = fielddef.type()->base_type();
+    // Ignore scalars.
+    if (base_type <= reflection::Double) continue;
+    // Ignore fields that are not stored.
+    auto offset = tableptr->GetOptionalFieldOffset(fielddef.offset());
+    if (!offset) continue;
+    // Ignore structs.
+    auto subobjectdef = base_type == reflection::Obj
+                            ? schema_.objects()->Get(fielddef.type()->index())
+                            : nullptr;
+    if (subobjectdef && subobjectdef->is_struct()) continue;
+    auto offsetloc = table + offset;
+    FixOffset(offsetloc, newbuf);
+    auto ref = offsetloc + ReadScalar<uoffset_t>(tableloc + offset);
+    // Recurse.
+    switch (base_type) {
+      case reflection::Obj: {
+        FixTable(*subobjectdef, ref, newbuf);
+        break;
+      }
+      case reflection::Vector: {
+        auto elem_type = fielddef.type()->element();
+        if (elem_type != reflection::Obj && elem_type != reflection::String)
+          break;
+        auto elemobjectdef =
+            elem_type == reflection::Obj
+                ? schema_.objects()->Get(fielddef.type()->index())
+                : nullptr;
+        if (elemobjectdef && elemobjectdef->is_struct()) break;
+        auto vec = reinterpret_cast<const Vector<uoffset_t> *>(
+            vector_data(buf_) + ref);
+        for (uoffset_t i = 0; i < vec->size(); i++) {
+          auto loc = ref + static_cast<uoffset_t>(sizeof(uoffset_t)) +
+                     i * static_cast<uoffset_t>(sizeof(uoffset_t));
+          FixOffset(loc, newbuf);
+          if (elemobjectdef)
+            FixTable(*elemobjectdef, loc + vec->Get(i), newbuf);
+        }
+        break;
+      }
+      case reflection::Union: {
+        FixTable(GetUnionType(schema_, objectdef, fielddef, *tableptr), ref,
+                 newbuf);
+        break;
+      }
+      case reflection::String: break;
+      default: FLATBUFFERS_ASSERT(false);
+    }
+  }
+}
+
+void ResizeBatch::Apply() {
+  if (edits_.empty()) return;
+  // Sort by position, keeping only the last edit of each string or vector.
+  std::stable_sort(edits_.begin(), edits_.end());
+  size_t num_edits = 0;
+  for (size_t i = 0; i < edits_.size(); i++) {
+    if (num_edits && edits_[num_edits - 1].start == edits_[i].start)
+      num_edits--;
+    if (num_edits != i) edits_[num_edits] = edits_[i];
+    num_edits++;
+  }
+  edits_.resize(num_edits);
+  starts_.clear();
+  shifts_.clear();
+  int shift = 0;
+  for (auto it = edits_.begin(); it != edits_.end(); ++it) {
+    if (!it->delta) continue;  // Rewritten in place.
+    shift += it->delta;
+    starts_.push_back(it->start);
+    shifts_.push_back(shift);
+  }
+  if (!starts_.empty()) {
+    // Copy everything in between the insertion points into a new buffer,
+    // inserting or deleting bytes in one go.
+    std::vector<uint8_t> newbuf;
+    newbuf.reserve(buf_.size() + shift);
+    auto data = vector_data(buf_);
+    uoffset_t prev = 0;
+    for (auto it = edits_.begin(); it != edits_.end(); ++it) {
+      if (!it->delta) continue;
+      auto end = it->delta < 0 ? it->start + it->delta : it->start;
+      newbuf.insert(newbuf.end(), data + prev, data + end);
+      if (it->delta > 0) newbuf.insert(newbuf.end(), it->delta, 0);
+      prev = it->start;
+    }
+    newbuf.insert(newbuf.end(), data + prev, data + buf_.size());
+    // Then change all the offsets in the copy, in a single walk.
+    visited_.assign(buf_.size() / sizeof(uoffset_t), false);
+    FixOffset(0, newbuf);
+    FixTable(root_table_ ? *root_table_ : *schema_.root_table(),
+             ReadScalar<uoffset_t>(data), newbuf);
+    visited_.clear();
+    buf_.swap(newbuf);
+  }
+  // Finally write the new lengths and contents.
+  for (auto it = edits_.begin(); it != edits_.end(); ++it) {
+    auto obj = vector_data(buf_) + Map(it->obj);
+    WriteScalar(obj, it->newsize);
+    auto elems = obj + sizeof(uoffset_t);
+    // Bytes between the length field and the resize point.
+    auto size = static_cast<uoffset_t>(static_cast<int>(it->old_bytes) +
+                                       it->delta);
+    if (it->is_string) {
+      // Clear the old string, since we don't want parts of it remaining.
+      memset(elems, 0, size);
+      memcpy(elems, it->payload.c_str(), it->payload.size() + 1);
+    } else if (it->new_bytes < it->old_bytes) {
+      // Clear elements we're throwing away that remain in the buffer.
+      memset(elems + it->new_bytes, 0, size - it->new_bytes);
+    } else if (!it->payload.empty()) {
+      // Set new elements, which are 0 otherwise.
+      for (auto i = it->old_bytes; i < it->new_bytes;
+           i += static_cast<uoffset_t>(it->payload.size())) {
+        memcpy(elems + i, it->payload.data(), it->payload.size());
+      }
+    }
+  }
+  edits_.clear();
+}
+
 const uint8_t *AddFlatBuffer(std::vector<uint8_t> &flatbuf,
                              const uint8_t *newbuf, size_t newlen) {
   // Align to sizeof(uoffset_t) past sizeof(largest_scalar_t) since we're
@@ -366,6 +606,285 @@ const uint8_t *AddFlatBuffer(std::vector<uint8_t> &flatbuf,
   return vector_data(flatbuf) + insertion_point + root_offset;
 }
 
+// Finds everything reachable from the root of a FlatBuffer, and then moves it
+// down over the unreachable bytes in between, see Compact().
+class CompactContext {
+ public:
+  CompactContext(const reflection::Schema &schema,
+                 std::vector<uint8_t> *flatbuf)
+      : schema_(schema),
+        buf_(*flatbuf),
+        visited_(flatbuf->size() / sizeof(uoffset_t) + 1, false),
+        vtables_merged_(0),
+        max_align_(sizeof(largest_scalar_t)) {
+    auto objects = schema.objects();
+    for (auto it = objects->begin(); it != objects->end(); ++it) {
+      max_align_ =
+          (std::max)(max_align_, static_cast<uoffset_t>(it->minalign()));
+    }
+  }
+
+  bool Mark(const reflection::Object &root_table) {
+    // The root offset, and the file identifier if any.
+    auto header = static_cast<uoffset_t>(sizeof(uoffset_t));
+    if (schema_.file_ident() && schema_.file_ident()->size())
+      header += FlatBufferBuilder::kFileIdentifierLength;
+    AddRegion(0, header);
+    offsets_.push_back(0);
+    return MarkTable(root_table, ReadScalar<uoffset_t>(vector_data(buf_)));
+  }
+
+  // Moves all marked regions down as far as their alignment allows, and
+  // returns the new size of the buffer.
+  uoffset_t Sweep() {
+    // Merge regions that overlap or touch.
+    std::sort(regions_.begin(), regions_.end());
+    size_t num_regions = 0;
+    for (auto it = regions_.begin(); it != regions_.end(); ++it) {
+      if (num_regions && it->first <= regions_[num_regions - 1].second) {
+        auto &prev = regions_[num_regions - 1];
+        prev.second = (std::max)(prev.second, it->second);
+      } else {
+        regions_[num_regions++] = *it;
+      }
+    }
+    regions_.resize(num_regions);
+    // Each region moves down to just after the previous one, by a multiple
+    // of the largest alignment.
+    uoffset_t end = 0;
+    for (auto it = regions_.begin(); it != regions_.end(); ++it) {
+      auto shift = (it->first - end) / max_align_ * max_align_;
+      starts_.push_back(it->first);
+      shifts_.push_back(shift);
+      end = it->second - shift;
+    }
+    // Compute all new offsets before writing any, since offsets in shared
+    // data may be read more than once.
+    auto data = vector_data(buf_);
+    std::vector<uoffset_t> new_offsets(offsets_.size());
+    for (size_t i = 0; i < offsets_.size(); i++) {
+      auto loc = offsets_[i];
+      auto ref = loc + ReadScalar<uoffset_t>(data + loc);
+      new_offsets[i] = Map(ref) - Map(loc);
+    }
+    for (size_t i = 0; i < offsets_.size(); i++) {
+      WriteScalar(data + offsets_[i], new_offsets[i]);
+    }
+    for (auto it = tables_.begin(); it != tables_.end(); ++it) {
+      WriteScalar(data + it->first,
+                  static_cast<soffset_t>(Map(it->first)) -
+                      static_cast<soffset_t>(Map(it->second)));
+    }
+    // Regions are in order, so moving them down one by one never overwrites
+    // a region that has not been moved yet.
+    for (size_t i = 0; i < regions_.size(); i++) {
+      if (!shifts_[i]) continue;
+      memmove(data + regions_[i].first - shifts_[i], data + regions_[i].first,
+              regions_[i].second - regions_[i].first);
+    }
+    return end;
+  }
+
+  size_t vtables_merged() const { return vtables_merged_; }
+
+ private:
+  void AddRegion(uoffset_t start, uoffset_t end) {
+    regions_.push_back(std::make_pair(start, end));
+  }
+
+  // Returns true if an object at "pos" was visited already, and marks it as
+  // visited otherwise.
+  bool Visited(uoffset_t pos) {
+    auto idx = pos / sizeof(uoffset_t);
+    if (visited_[idx]) return true;
+    visited_[idx] = true;
+    return false;
+  }
+
+  // Where a byte of a marked region ends up.
+  uoffset_t Map(uoffset_t pos) const {
+    auto idx = std::upper_bound(starts_.begin(), starts_.end(), pos) -
+               starts_.begin() - 1;
+    return pos - shifts_[idx];
+  }
+
+  // Returns the first vtable seen with the same contents as the one at
+  // "vtable", which is the one tables will share.
+  uoffset_t MarkVTable(uoffset_t vtable) {
+    auto it = vtable_by_pos_.find(vtable);
+    if (it != vtable_by_pos_.end()) return it->second;
+    auto vtableloc = vector_data(buf_) + vtable;
+    auto size = ReadScalar<voffset_t>(vtableloc);
+    auto key = std::string(reinterpret_cast<const char *>(vtableloc), size);
+    auto shared = vtable_by_contents_.insert(std::make_pair(key, vtable));
+    if (shared.second) {
+      AddRegion(vtable, vtable + size);
+    } else {
+      vtables_merged_++;
+    }
+    vtable_by_pos_[vtable] = shared.first->second;
+    return shared.first->second;
+  }
+
+  void MarkString(uoffset_t str) {
+    if (Visited(str)) return;
+    auto size = ReadScalar<uoffset_t>(vector_data(buf_) + str);
+    AddRegion(str, str + static_cast<uoffset_t>(sizeof(uoffset_t)) + size + 1);
+  }
+
+  bool MarkUnionValue(const reflection::Enum &enumdef, uint8_t type,
+                      uoffset_t ref) {
+    if (!type) return true;  // NONE.
+    auto enumval = enumdef.values()->LookupByKey(type);
+    if (!enumval) return false;
+    auto union_type = enumval->union_type();
+    if (union_type && union_type->base_type() == reflection::String) {
+      MarkString(ref);
+      return true;
+    }
+    auto objectdef = union_type && union_type->base_type() == reflection::Obj
+                         ? schema_.objects()->Get(union_type->index())
+                         : enumval->object();
+    if (!objectdef) return false;
+    if (objectdef->is_struct()) {
+      AddRegion(ref, ref + objectdef->bytesize());
+      return true;
+    }
+    return MarkTable(*objectdef, ref);
+  }
+
+  bool MarkVector(const reflection::Object &objectdef,
+                  const reflection::Field &fielddef, const Table &table,
+                  uoffset_t vec) {
+    if (Visited(vec)) return true;
+    auto data = vector_data(buf_);
+    auto size = ReadScalar<uoffset_t>(data + vec);
+    auto elem_type = fielddef.type()->element();
+    auto elem_size = static_cast<uoffset_t>(
+        elem_type == reflection::Union
+            ? sizeof(uoffset_t)
+            : GetTypeSizeInline(elem_type, fielddef.type()->index(), schema_));
+    auto elems = vec + static_cast<uoffset_t>(sizeof(uoffset_t));
+    AddRegion(vec, elems + size * elem_size);
+    auto elemobjectdef = elem_type == reflection::Obj
+                             ? schema_.objects()->Get(fielddef.type()->index())
+                             : nullptr;
+    if (elemobjectdef && elemobjectdef->is_struct()) return true;
+    const Vector<uint8_t> *types = nullptr;
+    if (elem_type == reflection::Union) {
+      auto type_field = objectdef.fields()->LookupByKey(
+          (fielddef.name()->str() + UnionTypeFieldSuffix()).c_str());
+      if (!type_field) return false;
+      types = GetFieldV<uint8_t>(table, *type_field);
+      if (!types || types->size() != size) return false;
+    } else if (elem_type != reflection::Obj &&
+               elem_type != reflection::String) {
+      return true;
+    }
+    for (uoffset_t i = 0; i < size; i++) {
+      auto loc = elems + i * elem_size;
+      offsets_.push_back(loc);
+      auto ref = loc + ReadScalar<uoffset_t>(data + loc);
+      if (types) {
+        auto &enumdef = *schema_.enums()->Get(fielddef.type()->index());
+        if (!MarkUnionValue(enumdef, types->Get(i), ref)) return false;
+      } else if (elemobjectdef) {
+        if (!MarkTable(*elemobjectdef, ref)) return false;
+      } else {
+        MarkString(ref);
+      }
+    }
+    return true;
+  }
+
+  bool MarkTable(const reflection::Object &objectdef, uoffset_t table) {
+    if (Visited(table)) return true;
+    auto tableloc = vector_data(buf_) + table;
+    auto tableptr = reinterpret_cast<const Table *>(tableloc);
+    auto vtable = static_cast<uoffset_t>(
+        static_cast<soffset_t>(table) - ReadScalar<soffset_t>(tableloc));
+    AddRegion(table, table + ReadScalar<voffset_t>(vector_data(buf_) + vtable +
+                                                   sizeof(voffset_t)));
+    tables_.push_back(std::make_pair(table, MarkVTable(vtable)));
+    auto fielddefs = objectdef.fields();
+    for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+      auto &fielddef = **it;
+      auto base_type = fielddef.type()->base_type();
+      // Ignore scalars.
+      if (base_type <= reflection::Double) continue;
+      // Ignore fields that are not stored.
+      auto offset = tableptr->GetOptionalFieldOffset(fielddef.offset());
+      if (!offset) continue;
+      // Ignore structs.
+      auto subobjectdef = base_type == reflection::Obj
+                              ? schema_.objects()->Get(fielddef.type()->index())
+                              : nullptr;
+      if (subobjectdef && subobjectdef->is_struct()) continue;
+      auto offsetloc = table + offset;
+      offsets_.push_back(offsetloc);
+      auto ref = offsetloc + ReadScalar<uoffset_t>(tableloc + offset);
+      switch (base_type) {
+        case reflection::Obj: {
+          if (!MarkTable(*subobjectdef, ref)) return false;
+          break;
+        }
+        case reflection::Vector: {
+          if (!MarkVector(objectdef, fielddef, *tableptr, ref)) return false;
+          break;
+        }
+        case reflection::Union: {
+          auto type_field = objectdef.fields()->LookupByKey(
+              (fielddef.name()->str() + UnionTypeFieldSuffix()).c_str());
+          if (!type_field) return false;
+          auto &enumdef = *schema_.enums()->Get(fielddef.type()->index());
+          auto type = GetFieldI<uint8_t>(*tableptr, *type_field);
+          if (!MarkUnionValue(enumdef, type, ref)) return false;
+          break;
+        }
+        case reflection::String: MarkString(ref); break;
+        default: FLATBUFFERS_ASSERT(false);
+      }
+    }
+    return true;
+  }
+
+  const reflection::Schema &schema_;
+  std::vector<uint8_t> &buf_;
+  std::vector<bool> visited_;
+  // Live byte ranges [first, second).
+  std::vector<std::pair<uoffset_t, uoffset_t>> regions_;
+  // Locations of all uoffset_t offsets, and of all tables with the vtable
+  // they will use.
+  std::vector<uoffset_t> offsets_;
+  std::vector<std::pair<uoffset_t, uoffset_t>> tables_;
+  std::map<uoffset_t, uoffset_t> vtable_by_pos_;
+  std::map<std::string, uoffset_t> vtable_by_contents_;
+  size_t vtables_merged_;
+  uoffset_t max_align_;
+  // Filled in by Sweep(): start of each merged region, and how far it moves.
+  std::vector<uoffset_t> starts_;
+  std::vector<uoffset_t> shifts_;
+};
+
+bool Compact(const reflection::Schema &schema, std::vector<uint8_t> *flatbuf,
+             const reflection::Object *root_table, CompactReport *report) {
+  auto start = std::chrono::steady_clock::now();
+  auto old_size = flatbuf->size();
+  CompactContext context(schema, flatbuf);
+  if (!context.Mark(root_table ? *root_table : *schema.root_table()))
+    return false;
+  flatbuf->resize(context.Sweep());
+  if (report) {
+    report->old_size = old_size;
+    report->new_size = flatbuf->size();
+    report->vtables_merged = context.vtables_merged();
+    report->seconds = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+  }
+  return true;
+}
+
 void CopyInline(FlatBufferBuilder &fbb, const reflection::Field &fielddef,
                 const Table &table, size_t align, size_t size) {
   fbb.Align(align);
@@ -377,98 +896,143 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
                                 const reflection::Schema &schema,
                                 const reflection::Object &objectdef,
                                 const Table &table, bool use_string_pooling) {
-  // Before we can construct the table, we have to first generate any
-  // subobjects, and collect their offsets.
-  std::vector<uoffset_t> offsets;
+  return TableCopier(schema, use_string_pooling)
+      .CopyTable(fbb, objectdef, table);
+}
+
+TableCopier::TableCopier(const reflection::Schema &schema,
+                         bool use_string_pooling)
+    : schema_(schema),
+      use_string_pooling_(use_string_pooling),
+      num_chunks_(1),
+      min_parallel_elements_(0),
+      max_align_(sizeof(largest_scalar_t)),
+      max_fields_(0) {
+  auto objects = schema.objects();
+  for (auto it = objects->begin(); it != objects->end(); ++it) {
+    max_align_ = (std::max)(max_align_, static_cast<size_t>(it->minalign()));
+    max_fields_ = (std::max)(max_fields_, static_cast<size_t>(
+                                              it->fields()->size()));
+  }
+}
+
+size_t TableCopier::Measure(const reflection::Object &objectdef,
+                            const Table &table) const {
+  // The builder keeps the fields of the table being built in its scratch
+  // memory, as a uoffset_t and a voffset_t each. Finish() aligns the buffer
+  // and adds the root offset, a file identifier and a size prefix at most.
+  return MeasureTable(objectdef, table) + max_fields_ * 2 * sizeof(uoffset_t) +
+         max_align_ - 1 + 2 * sizeof(uoffset_t) +
+         FlatBufferBuilder::kFileIdentifierLength;
+}
+
+size_t TableCopier::MeasureTable(const reflection::Object &objectdef,
+                                 const Table &table) const {
+  // The table itself, its alignment, and a vtable that may not be shared,
+  // which the builder also records in its scratch memory.
   auto fielddefs = objectdef.fields();
+  size_t size = sizeof(soffset_t) + max_align_ - 1 +
+                (fielddefs->size() + 2) * sizeof(voffset_t) + sizeof(uoffset_t);
+  // Every field may need padding up to its own size.
+  const size_t offset_size = 2 * sizeof(uoffset_t) - 1;
   for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
     auto &fielddef = **it;
-    // Skip if field is not present in the source.
     if (!table.CheckField(fielddef.offset())) continue;
-    uoffset_t offset = 0;
-    switch (fielddef.type()->base_type()) {
+    auto base_type = fielddef.type()->base_type();
+    switch (base_type) {
       case reflection::String: {
-        offset = use_string_pooling
-                     ? fbb.CreateSharedString(GetFieldS(table, fielddef)).o
-                     : fbb.CreateString(GetFieldS(table, fielddef)).o;
+        // Length, terminator and padding.
+        size += offset_size + GetFieldS(table, fielddef)->size() +
+                2 * sizeof(uoffset_t);
         break;
       }
       case reflection::Obj: {
-        auto &subobjectdef = *schema.objects()->Get(fielddef.type()->index());
-        if (!subobjectdef.is_struct()) {
-          offset = CopyTable(fbb, schema, subobjectdef,
-                             *GetFieldT(table, fielddef), use_string_pooling)
-                       .o;
+        auto &subobjectdef = *schema_.objects()->Get(fielddef.type()->index());
+        if (subobjectdef.is_struct()) {
+          size += subobjectdef.bytesize() + subobjectdef.minalign() - 1;
+        } else {
+          size += offset_size +
+                  MeasureTable(subobjectdef, *GetFieldT(table, fielddef));
         }
         break;
       }
       case reflection::Union: {
-        auto &subobjectdef = GetUnionType(schema, objectdef, fielddef, table);
-        offset = CopyTable(fbb, schema, subobjectdef,
-                           *GetFieldT(table, fielddef), use_string_pooling)
-                     .o;
+        size += offset_size +
+                MeasureTable(GetUnionType(schema_, objectdef, fielddef, table),
+                             *GetFieldT(table, fielddef));
         break;
       }
       case reflection::Vector: {
-        auto vec =
-            table.GetPointer<const Vector<Offset<Table>> *>(fielddef.offset());
-        auto element_base_type = fielddef.type()->element();
-        auto elemobjectdef =
-            element_base_type == reflection::Obj
-                ? schema.objects()->Get(fielddef.type()->index())
-                : nullptr;
-        switch (element_base_type) {
-          case reflection::String: {
-            std::vector<Offset<const String *>> elements(vec->size());
-            auto vec_s = reinterpret_cast<const Vector<Offset<String>> *>(vec);
-            for (uoffset_t i = 0; i < vec_s->size(); i++) {
-              elements[i] = use_string_pooling
-                                ? fbb.CreateSharedString(vec_s->Get(i)).o
-                                : fbb.CreateString(vec_s->Get(i)).o;
-            }
-            offset = fbb.CreateVector(elements).o;
-            break;
-          }
-          case reflection::Obj: {
-            if (!elemobjectdef->is_struct()) {
-              std::vector<Offset<const Table *>> elements(vec->size());
-              for (uoffset_t i = 0; i < vec->size(); i++) {
-                elements[i] = CopyTable(fbb, schema, *elemobjectdef,
-                                        *vec->Get(i), use_string_pooling);
-              }
-              offset = fbb.CreateVector(elements).o;
-              break;
-            }
-          }
-            FLATBUFFERS_FALLTHROUGH();  // fall thru
-          default: {                    // Scalars and structs.
-            auto element_size = GetTypeSize(element_base_type);
-            if (elemobjectdef && elemobjectdef->is_struct())
-              element_size = elemobjectdef->bytesize();
-            fbb.StartVector(vec->size(), element_size);
-            fbb.PushBytes(vec->Data(), element_size * vec->size());
-            offset = fbb.EndVector(vec->size());
-            break;
-          }
-        }
+        size += offset_size + MeasureVector(fielddef, table);
         break;
       }
-      default:  // Scalars.
+      default: {  // Scalars.
+        size += 2 * GetTypeSize(base_type) - 1;
         break;
+      }
+    }
+  }
+  return size;
+}
+
+size_t TableCopier::MeasureVector(const reflection::Field &fielddef,
+                                  const Table &table) const {
+  auto vec = table.GetPointer<const Vector<Offset<Table>> *>(fielddef.offset());
+  auto element_base_type = fielddef.type()->element();
+  auto elemobjectdef = element_base_type == reflection::Obj
+                           ? schema_.objects()->Get(fielddef.type()->index())
+                           : nullptr;
+  auto element_size = GetTypeSize(element_base_type);
+  auto element_align = element_size;
+  if (elemobjectdef && elemobjectdef->is_struct()) {
+    element_size = elemobjectdef->bytesize();
+    element_align = elemobjectdef->minalign();
+  }
+  // Length, and padding before the elements.
+  size_t size = sizeof(uoffset_t) + vec->size() * element_size +
+                (std::max)(element_align, sizeof(uoffset_t)) - 1;
+  if (element_base_type == reflection::String) {
+    auto vec_s = reinterpret_cast<const Vector<Offset<String>> *>(vec);
+    for (uoffset_t i = 0; i < vec_s->size(); i++) {
+      size += vec_s->Get(i)->size() + 2 * sizeof(uoffset_t);
     }
-    if (offset) { offsets.push_back(offset); }
+  } else if (elemobjectdef && !elemobjectdef->is_struct()) {
+    for (uoffset_t i = 0; i < vec->size(); i++) {
+      size += MeasureTable(*elemobjectdef, *vec->Get(i));
+    }
+    // Alignment of the builders of CopyTablesParallel.
+    if (parallel_for_ && num_chunks_ > 1 &&
+        vec->size() >= min_parallel_elements_)
+      size += num_chunks_ * (max_align_ - 1);
+  }
+  return size;
+}
+
+Offset<const Table *> TableCopier::CopyTable(
+    FlatBufferBuilder &fbb, const reflection::Object &objectdef,
+    const Table &table) {
+  // Before we can construct the table, we have to first generate any
+  // subobjects, and collect their offsets.
+  auto offsets_start = offsets_.size();
+  auto fielddefs = objectdef.fields();
+  for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+    auto &fielddef = **it;
+    // Skip if field is not present in the source.
+    if (!table.CheckField(fielddef.offset())) continue;
+    auto offset = CopyValue(fbb, objectdef, fielddef, table);
+    if (offset) { offsets_.push_back(offset); }
   }
   // Now we can build the actual table from either offsets or scalar data.
   auto start = objectdef.is_struct() ? fbb.StartStruct(objectdef.minalign())
                                      : fbb.StartTable();
-  size_t offset_idx = 0;
+  auto offset_idx = offsets_start;
   for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
     auto &fielddef = **it;
     if (!table.CheckField(fielddef.offset())) continue;
     auto base_type = fielddef.type()->base_type();
     switch (base_type) {
       case reflection::Obj: {
-        auto &subobjectdef = *schema.objects()->Get(fielddef.type()->index());
+        auto &subobjectdef = *schema_.objects()->Get(fielddef.type()->index());
         if (subobjectdef.is_struct()) {
           CopyInline(fbb, fielddef, table, subobjectdef.minalign(),
                      subobjectdef.bytesize());
@@ -479,7 +1043,7 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
       case reflection::Union:
       case reflection::String:
       case reflection::Vector:
-        fbb.AddOffset(fielddef.offset(), Offset<void>(offsets[offset_idx++]));
+        fbb.AddOffset(fielddef.offset(), Offset<void>(offsets_[offset_idx++]));
         break;
       default: {  // Scalars.
         auto size = GetTypeSize(base_type);
@@ -488,7 +1052,8 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
       }
     }
   }
-  FLATBUFFERS_ASSERT(offset_idx == offsets.size());
+  FLATBUFFERS_ASSERT(offset_idx == offsets_.size());
+  offsets_.resize(offsets_start);
   if (objectdef.is_struct()) {
     fbb.ClearOffsets();
     return fbb.EndStruct();
@@ -497,6 +1062,381 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
   }
 }
 
+uoffset_t TableCopier::CopyValue(FlatBufferBuilder &fbb,
+                                 const reflection::Object &objectdef,
+                                 const reflection::Field &fielddef,
+                                 const Table &table) {
+  uoffset_t offset = 0;
+  switch (fielddef.type()->base_type()) {
+    case reflection::String: {
+      offset = use_string_pooling_
+                   ? fbb.CreateSharedString(GetFieldS(table, fielddef)).o
+                   : fbb.CreateString(GetFieldS(table, fielddef)).o;
+      break;
+    }
+    case reflection::Obj: {
+      auto &subobjectdef = *schema_.objects()->Get(fielddef.type()->index());
+      if (!subobjectdef.is_struct()) {
+        offset = CopyTable(fbb, subobjectdef, *GetFieldT(table, fielddef)).o;
+      }
+      break;
+    }
+    case reflection::Union: {
+      auto &subobjectdef = GetUnionType(schema_, objectdef, fielddef, table);
+      offset = CopyTable(fbb, subobjectdef, *GetFieldT(table, fielddef)).o;
+      break;
+    }
+    case reflection::Vector: {
+      offset = CopyVector(fbb, fielddef, table);
+      break;
+    }
+    default:  // Scalars.
+      break;
+  }
+  return offset;
+}
+
+uoffset_t TableCopier::CopyVector(FlatBufferBuilder &fbb,
+                                  const reflection::Field &fielddef,
+                                  const Table &table) {
+  auto vec = table.GetPointer<const Vector<Offset<Table>> *>(fielddef.offset());
+  auto element_base_type = fielddef.type()->element();
+  auto elemobjectdef = element_base_type == reflection::Obj
+                           ? schema_.objects()->Get(fielddef.type()->index())
+                           : nullptr;
+  auto offsets_start = offsets_.size();
+  switch (element_base_type) {
+    case reflection::String: {
+      auto vec_s = reinterpret_cast<const Vector<Offset<String>> *>(vec);
+      for (uoffset_t i = 0; i < vec_s->size(); i++) {
+        offsets_.push_back(use_string_pooling_
+                               ? fbb.CreateSharedString(vec_s->Get(i)).o
+                               : fbb.CreateString(vec_s->Get(i)).o);
+      }
+      break;
+    }
+    case reflection::Obj: {
+      if (!elemobjectdef->is_struct()) {
+        if (parallel_for_ && num_chunks_ > 1 && vec->size() > 1 &&
+            vec->size() >= min_parallel_elements_) {
+          CopyTablesParallel(fbb, *elemobjectdef, *vec);
+        } else {
+          for (uoffset_t i = 0; i < vec->size(); i++) {
+            offsets_.push_back(CopyTable(fbb, *elemobjectdef, *vec->Get(i)).o);
+          }
+        }
+        break;
+      }
+    }
+      FLATBUFFERS_FALLTHROUGH();  // fall thru
+    default: {                    // Scalars and structs.
+      auto element_size = GetTypeSize(element_base_type);
+      if (elemobjectdef && elemobjectdef->is_struct())
+        element_size = elemobjectdef->bytesize();
+      fbb.StartVector(vec->size(), element_size);
+      fbb.PushBytes(vec->Data(), element_size * vec->size());
+      return fbb.EndVector(vec->size());
+    }
+  }
+  // A vector of offsets to the subobjects just created.
+  fbb.StartVector(vec->size(), sizeof(uoffset_t));
+  for (auto i = offsets_.size(); i > offsets_start;) {
+    fbb.PushElement(Offset<void>(offsets_[--i]));
+  }
+  offsets_.resize(offsets_start);
+  return fbb.EndVector(vec->size());
+}
+
+void TableCopier::CopyTablesParallel(FlatBufferBuilder &fbb,
+                                     const reflection::Object &objectdef,
+                                     const Vector<Offset<Table>> &vec) {
+  auto num_chunks = (std::min)(num_chunks_, static_cast<size_t>(vec.size()));
+  std::vector<flatbuffers::unique_ptr<FlatBufferBuilder>> builders(num_chunks);
+  std::vector<std::vector<uoffset_t>> chunk_offsets(num_chunks);
+  auto worker = [&](size_t chunk) {
+    auto begin = static_cast<uoffset_t>(vec.size() * chunk / num_chunks);
+    auto end = static_cast<uoffset_t>(vec.size() * (chunk + 1) / num_chunks);
+    TableCopier copier(schema_, use_string_pooling_);
+    size_t size = copier.max_fields_ * 2 * sizeof(uoffset_t);
+    for (auto i = begin; i < end; i++) {
+      size += copier.MeasureTable(objectdef, *vec.Get(i));
+    }
+    builders[chunk].reset(new FlatBufferBuilder(size));
+    for (auto i = begin; i < end; i++) {
+      chunk_offsets[chunk].push_back(
+          copier.CopyTable(*builders[chunk], objectdef, *vec.Get(i)).o);
+    }
+  };
+  parallel_for_(num_chunks, worker);
+  // Append the contents of each builder. Since offsets are relative, they
+  // remain valid as long as the alignment is kept, and offsets into it
+  // (which count from the end of the buffer) just move by what precedes it.
+  for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+    fbb.Align(max_align_);
+    auto chunk_end = fbb.GetSize();
+    fbb.PushBytes(builders[chunk]->GetCurrentBufferPointer(),
+                  builders[chunk]->GetSize());
+    for (auto it = chunk_offsets[chunk].begin();
+         it != chunk_offsets[chunk].end(); ++it) {
+      offsets_.push_back(chunk_end + *it);
+    }
+  }
+}
+
+// Size and alignment of a field if stored inline in a table, or 0.
+static size_t InlineSize(const reflection::Schema &schema,
+                         const reflection::Field &fielddef, size_t *align) {
+  auto base_type = fielddef.type()->base_type();
+  if (base_type <= reflection::Double) {
+    *align = GetTypeSize(base_type);
+    return *align;
+  }
+  if (base_type == reflection::Obj) {
+    auto &objectdef = *schema.objects()->Get(fielddef.type()->index());
+    if (objectdef.is_struct()) {
+      *align = static_cast<size_t>(objectdef.minalign());
+      return objectdef.bytesize();
+    }
+  }
+  return 0;
+}
+
+static bool StringsEqual(const String *a, const String *b) {
+  return a->size() == b->size() && !memcmp(a->Data(), b->Data(), a->size());
+}
+
+static bool TablesEqual(const reflection::Schema &schema,
+                        const reflection::Object &objectdef, const Table &a,
+                        const Table &b);
+
+// Compares a field present in both tables.
+static bool FieldsEqual(const reflection::Schema &schema,
+                        const reflection::Object &objectdef,
+                        const reflection::Field &fielddef, const Table &a,
+                        const Table &b) {
+  size_t align;
+  auto size = InlineSize(schema, fielddef, &align);
+  if (size) {
+    return !memcmp(a.GetAddressOf(fielddef.offset()),
+                   b.GetAddressOf(fielddef.offset()), size);
+  }
+  switch (fielddef.type()->base_type()) {
+    case reflection::String:
+      return StringsEqual(GetFieldS(a, fielddef), GetFieldS(b, fielddef));
+    case reflection::Obj:
+      return TablesEqual(schema,
+                         *schema.objects()->Get(fielddef.type()->index()),
+                         *GetFieldT(a, fielddef), *GetFieldT(b, fielddef));
+    case reflection::Union: {
+      auto &a_type = GetUnionType(schema, objectdef, fielddef, a);
+      return &a_type == &GetUnionType(schema, objectdef, fielddef, b) &&
+             TablesEqual(schema, a_type, *GetFieldT(a, fielddef),
+                         *GetFieldT(b, fielddef));
+    }
+    case reflection::Vector: {
+      auto va = GetFieldAnyV(a, fielddef);
+      auto vb = GetFieldAnyV(b, fielddef);
+      if (va->size() != vb->size()) return false;
+      auto elem_type = fielddef.type()->element();
+      auto elemobjectdef = elem_type == reflection::Obj
+                               ? schema.objects()->Get(fielddef.type()->index())
+                               : nullptr;
+      if (elem_type == reflection::String) {
+        for (uoffset_t i = 0; i < va->size(); i++) {
+          if (!StringsEqual(GetAnyVectorElemPointer<const String>(va, i),
+                            GetAnyVectorElemPointer<const String>(vb, i)))
+            return false;
+        }
+        return true;
+      }
+      if (elemobjectdef && !elemobjectdef->is_struct()) {
+        for (uoffset_t i = 0; i < va->size(); i++) {
+          if (!TablesEqual(schema, *elemobjectdef,
+                           *GetAnyVectorElemPointer<const Table>(va, i),
+                           *GetAnyVectorElemPointer<const Table>(vb, i)))
+            return false;
+        }
+        return true;
+      }
+      // Scalars and structs.
+      return !memcmp(va->Data(), vb->Data(),
+                     va->size() * GetTypeSizeInline(elem_type,
+                                                    fielddef.type()->index(),
+                                                    schema));
+    }
+    default: FLATBUFFERS_ASSERT(false); return false;
+  }
+}
+
+static bool TablesEqual(const reflection::Schema &schema,
+                        const reflection::Object &objectdef, const Table &a,
+                        const Table &b) {
+  auto fielddefs = objectdef.fields();
+  for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+    auto &fielddef = **it;
+    auto present = a.CheckField(fielddef.offset());
+    if (present != b.CheckField(fielddef.offset())) return false;
+    if (present && !FieldsEqual(schema, objectdef, fielddef, a, b))
+      return false;
+  }
+  return true;
+}
+
+Offset<reflection::patch::TablePatch> Diff(FlatBufferBuilder &fbb,
+                                           const reflection::Schema &schema,
+                                           const reflection::Object &objectdef,
+                                           const Table &old_table,
+                                           const Table &new_table) {
+  std::vector<Offset<reflection::patch::FieldPatch>> patches;
+  auto fielddefs = objectdef.fields();
+  for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+    auto &fielddef = **it;
+    auto offset = fielddef.offset();
+    auto in_old = old_table.CheckField(offset);
+    if (!new_table.CheckField(offset)) {
+      if (in_old) {
+        patches.push_back(reflection::patch::CreateFieldPatch(
+            fbb, offset, reflection::patch::Remove));
+      }
+      continue;
+    }
+    if (in_old) {
+      if (FieldsEqual(schema, objectdef, fielddef, old_table, new_table))
+        continue;
+      // Tables present in both are patched themselves.
+      auto base_type = fielddef.type()->base_type();
+      const reflection::Object *subobjectdef = nullptr;
+      if (base_type == reflection::Obj) {
+        subobjectdef = schema.objects()->Get(fielddef.type()->index());
+        if (subobjectdef->is_struct()) subobjectdef = nullptr;
+      } else if (base_type == reflection::Union) {
+        subobjectdef = &GetUnionType(schema, objectdef, fielddef, old_table);
+        if (subobjectdef !=
+            &GetUnionType(schema, objectdef, fielddef, new_table))
+          subobjectdef = nullptr;
+      }
+      if (subobjectdef) {
+        auto patch = Diff(fbb, schema, *subobjectdef,
+                          *GetFieldT(old_table, fielddef),
+                          *GetFieldT(new_table, fielddef));
+        patches.push_back(reflection::patch::CreateFieldPatch(
+            fbb, offset, reflection::patch::Modify, 0, patch));
+        continue;
+      }
+    }
+    // Anything else is stored in full.
+    Offset<Vector<uint8_t>> data;
+    size_t align;
+    auto size = InlineSize(schema, fielddef, &align);
+    if (size) {
+      data = fbb.CreateVector(new_table.GetAddressOf(offset), size);
+    } else {
+      FlatBufferBuilder valuefbb;
+      auto value = TableCopier(schema).CopyValue(valuefbb, objectdef, fielddef,
+                                                 new_table);
+      auto start = valuefbb.StartTable();
+      if (fielddef.type()->base_type() == reflection::Union) {
+        auto type_field = objectdef.fields()->LookupByKey(
+            (fielddef.name()->str() + UnionTypeFieldSuffix()).c_str());
+        FLATBUFFERS_ASSERT(type_field);
+        valuefbb.AddElement<uint8_t>(
+            type_field->offset(), GetFieldI<uint8_t>(new_table, *type_field),
+            0);
+      }
+      valuefbb.AddOffset(offset, Offset<void>(value));
+      valuefbb.Finish(Offset<Table>(valuefbb.EndTable(start)));
+      fbb.ForceVectorAlignment(valuefbb.GetSize(), sizeof(uint8_t),
+                               valuefbb.GetBufferMinAlignment());
+      data = fbb.CreateVector(valuefbb.GetBufferPointer(),
+                              valuefbb.GetSize());
+    }
+    patches.push_back(reflection::patch::CreateFieldPatch(
+        fbb, offset, reflection::patch::Set, data));
+  }
+  return reflection::patch::CreateTablePatch(
+      fbb, fbb.CreateVectorOfSortedTables(&patches));
+}
+
+static Offset<const Table *> ApplyPatch(
+    FlatBufferBuilder &fbb, TableCopier &copier,
+    const reflection::Schema &schema, const reflection::Object &objectdef,
+    const Table &old_table, const reflection::patch::TablePatch &patch) {
+  // Before we can construct the table, we have to first generate any
+  // subobjects, and collect their offsets.
+  std::vector<std::pair<voffset_t, uoffset_t>> offsets;
+  auto fielddefs = objectdef.fields();
+  auto patches = patch.fields();
+  for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+    auto &fielddef = **it;
+    auto fieldpatch = patches ? patches->LookupByKey(fielddef.offset())
+                              : nullptr;
+    uoffset_t offset = 0;
+    if (!fieldpatch) {
+      if (old_table.CheckField(fielddef.offset()))
+        offset = copier.CopyValue(fbb, objectdef, fielddef, old_table);
+    } else if (fieldpatch->op() == reflection::patch::Set) {
+      offset = copier.CopyValue(fbb, objectdef, fielddef,
+                                *GetAnyRoot(fieldpatch->data()->Data()));
+    } else if (fieldpatch->op() == reflection::patch::Modify) {
+      auto &subobjectdef =
+          fielddef.type()->base_type() == reflection::Union
+              ? GetUnionType(schema, objectdef, fielddef, old_table)
+              : *schema.objects()->Get(fielddef.type()->index());
+      offset = ApplyPatch(fbb, copier, schema, subobjectdef,
+                          *GetFieldT(old_table, fielddef), *fieldpatch->patch())
+                   .o;
+    }
+    if (offset) offsets.push_back(std::make_pair(fielddef.offset(), offset));
+  }
+  // Now we can build the actual table from either offsets or inline data.
+  auto start = fbb.StartTable();
+  for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+    auto &fielddef = **it;
+    size_t align;
+    auto size = InlineSize(schema, fielddef, &align);
+    if (!size) continue;
+    auto fieldpatch = patches ? patches->LookupByKey(fielddef.offset())
+                              : nullptr;
+    auto data = !fieldpatch ? old_table.GetAddressOf(fielddef.offset())
+                : fieldpatch->op() == reflection::patch::Set
+                    ? fieldpatch->data()->Data()
+                    : nullptr;
+    if (!data) continue;
+    fbb.Align(align);
+    fbb.PushBytes(data, size);
+    fbb.TrackField(fielddef.offset(), fbb.GetSize());
+  }
+  for (auto it = offsets.begin(); it != offsets.end(); ++it) {
+    fbb.AddOffset(it->first, Offset<void>(it->second));
+  }
+  return fbb.EndTable(start);
+}
+
+Offset<const Table *> ApplyPatch(FlatBufferBuilder &fbb,
+                                 const reflection::Schema &schema,
+                                 const reflection::Object &objectdef,
+                                 const Table &old_table,
+                                 const reflection::patch::TablePatch &patch) {
+  TableCopier copier(schema);
+  return ApplyPatch(fbb, copier, schema, objectdef, old_table, patch);
+}
+
+void Diff(const reflection::Schema &schema, const uint8_t *old_buf,
+          const uint8_t *new_buf, FlatBufferBuilder *patch) {
+  patch->Finish(Diff(*patch, schema, *schema.root_table(),
+                     *GetAnyRoot(old_buf), *GetAnyRoot(new_buf)));
+}
+
+void ApplyPatch(const reflection::Schema &schema, const uint8_t *old_buf,
+                const uint8_t *patch, FlatBufferBuilder *fbb) {
+  auto root = ApplyPatch(*fbb, schema, *schema.root_table(),
+                         *GetAnyRoot(old_buf),
+                         *GetRoot<reflection::patch::TablePatch>(patch));
+  auto file_ident = schema.file_ident();
+  fbb->Finish(root,
+              file_ident && file_ident->size() ? file_ident->c_str() : nullptr);
+}
+
 bool VerifyStruct(flatbuffers::Verifier &v,
                   const flatbuffers::Table &parent_table,
                   voffset_t field_offset, const reflection::Object &obj,
@@ -104,6 +104,15 @@ bool DirExists(const char *name) {
   return (file_info.st_mode & FLATBUFFERS_S_IFDIR) != 0;
 }
 
+bool FileSizeAndTime(const char *name, uint64_t *size, int64_t *mtime) {
+  if (g_load_file_function != LoadFileRaw) return false;
+  struct flatbuffers_stat file_info;
+  if (flatbuffers_stat(name, &file_info) != 0) return false;
+  *size = static_cast<uint64_t>(file_info.st_size);
+  *mtime = static_cast<int64_t>(file_info.st_mtime);
+  return true;
+}
+
 LoadFileFunction SetLoadFileFunction(LoadFileFunction load_file_function) {
   LoadFileFunction previous_function = g_load_file_function;
   g_load_file_function = load_file_function ? load_file_function : LoadFileRaw;
@@ -0,0 +1,680 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_ARENATEST_SCENE_H_
+#define FLATBUFFERS_GENERATED_ARENATEST_SCENE_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/arena.h"
+
+namespace Scene {
+
+struct Point;
+
+struct Node;
+struct NodeBuilder;
+struct NodeT;
+
+bool operator==(const Point &lhs, const Point &rhs);
+bool operator!=(const Point &lhs, const Point &rhs);
+bool operator==(const NodeT &lhs, const NodeT &rhs);
+bool operator!=(const NodeT &lhs, const NodeT &rhs);
+
+inline const flatbuffers::TypeTable *PointTypeTable();
+
+inline const flatbuffers::TypeTable *NodeTypeTable();
+
+enum Payload : uint8_t {
+  Payload_NONE = 0,
+  Payload_Node = 1,
+  Payload_MIN = Payload_NONE,
+  Payload_MAX = Payload_Node
+};
+
+inline const Payload (&EnumValuesPayload())[2] {
+  static const Payload values[] = {
+    Payload_NONE,
+    Payload_Node
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesPayload() {
+  static const char * const names[3] = {
+    "NONE",
+    "Node",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNamePayload(Payload e) {
+  if (flatbuffers::IsOutRange(e, Payload_NONE, Payload_Node)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesPayload()[index];
+}
+
+template<typename T> struct PayloadTraits {
+  static const Payload enum_value = Payload_NONE;
+};
+
+template<> struct PayloadTraits<Scene::Node> {
+  static const Payload enum_value = Payload_Node;
+};
+
+struct PayloadUnion {
+  Payload type;
+  void *value;
+
+  PayloadUnion() : type(Payload_NONE), value(nullptr) {}
+  PayloadUnion(PayloadUnion&& u) FLATBUFFERS_NOEXCEPT :
+    type(Payload_NONE), value(nullptr)
+    { std::swap(type, u.type); std::swap(value, u.value); }
+  PayloadUnion(const PayloadUnion &);
+  PayloadUnion &operator=(const PayloadUnion &u)
+    { PayloadUnion t(u); std::swap(type, t.type); std::swap(value, t.value); return *this; }
+  PayloadUnion &operator=(PayloadUnion &&u) FLATBUFFERS_NOEXCEPT
+    { std::swap(type, u.type); std::swap(value, u.value); return *this; }
+  ~PayloadUnion() { Reset(); }
+
+  void Reset();
+
+#ifndef FLATBUFFERS_CPP98_STL
+  template <typename T>
+  void Set(T&& val) {
+    using RT = typename std::remove_reference<T>::type;
+    Reset();
+    type = PayloadTraits<typename RT::TableType>::enum_value;
+    if (type != Payload_NONE) {
+      value = new RT(std::forward<T>(val));
+    }
+  }
+#endif  // FLATBUFFERS_CPP98_STL
+
+  static void *UnPack(const void *obj, Payload type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, Payload _type, const flatbuffers::resolver_function_t *resolver);
+  flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+
+  Scene::NodeT *AsNode() {
+    return type == Payload_Node ?
+      reinterpret_cast<Scene::NodeT *>(value) : nullptr;
+  }
+  const Scene::NodeT *AsNode() const {
+    return type == Payload_Node ?
+      reinterpret_cast<const Scene::NodeT *>(value) : nullptr;
+  }
+};
+
+
+inline bool operator==(const PayloadUnion &lhs, const PayloadUnion &rhs) {
+  if (lhs.type != rhs.type) return false;
+  switch (lhs.type) {
+    case Payload_NONE: {
+      return true;
+    }
+    case Payload_Node: {
+      return *(reinterpret_cast<const Scene::NodeT *>(lhs.value)) ==
+             *(reinterpret_cast<const Scene::NodeT *>(rhs.value));
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+inline bool operator!=(const PayloadUnion &lhs, const PayloadUnion &rhs) {
+    return !(lhs == rhs);
+}
+
+bool VerifyPayload(flatbuffers::Verifier &verifier, const void *obj, Payload type);
+bool VerifyPayloadVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Point FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+
+ public:
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return PointTypeTable();
+  }
+  Point()
+      : x_(0),
+        y_(0) {
+  }
+  Point(float _x, float _y)
+      : x_(flatbuffers::EndianScalar(_x)),
+        y_(flatbuffers::EndianScalar(_y)) {
+  }
+  float x() const {
+    return flatbuffers::EndianScalar(x_);
+  }
+  void mutate_x(float _x) {
+    flatbuffers::WriteScalar(&x_, _x);
+  }
+  float y() const {
+    return flatbuffers::EndianScalar(y_);
+  }
+  void mutate_y(float _y) {
+    flatbuffers::WriteScalar(&y_, _y);
+  }
+  inline void *operator new (std::size_t count) {
+    return flatbuffers::Arena::AllocateObject(count);
+  }
+  inline void operator delete (void *ptr) {
+    flatbuffers::Arena::DeallocateObject(ptr);
+  }
+};
+FLATBUFFERS_STRUCT_END(Point, 8);
+
+inline bool operator==(const Point &lhs, const Point &rhs) {
+  return
+      (lhs.x() == rhs.x()) &&
+      (lhs.y() == rhs.y());
+}
+
+inline bool operator!=(const Point &lhs, const Point &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct NodeT : public flatbuffers::NativeTable {
+  typedef Node TableType;
+  flatbuffers::arena_string name{};
+  flatbuffers::unique_ptr<Scene::Point> pos{};
+  std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>> tags{};
+  std::vector<Scene::Point, flatbuffers::arena_allocator<Scene::Point>> path{};
+  std::vector<int64_t, flatbuffers::arena_allocator<int64_t>> values{};
+  std::vector<bool, flatbuffers::arena_allocator<bool>> flags{};
+  std::vector<flatbuffers::unique_ptr<Scene::NodeT>, flatbuffers::arena_allocator<flatbuffers::unique_ptr<Scene::NodeT>>> children{};
+  Scene::PayloadUnion payload{};
+  inline void *operator new (std::size_t count) {
+    return flatbuffers::Arena::AllocateObject(count);
+  }
+  inline void operator delete (void *ptr) {
+    flatbuffers::Arena::DeallocateObject(ptr);
+  }
+};
+
+inline bool operator==(const NodeT &lhs, const NodeT &rhs) {
+  return
+      (lhs.name == rhs.name) &&
+      (lhs.pos == rhs.pos) &&
+      (lhs.tags == rhs.tags) &&
+      (lhs.path == rhs.path) &&
+      (lhs.values == rhs.values) &&
+      (lhs.flags == rhs.flags) &&
+      (lhs.children == rhs.children) &&
+      (lhs.payload == rhs.payload);
+}
+
+inline bool operator!=(const NodeT &lhs, const NodeT &rhs) {
+    return !(lhs == rhs);
+}
+
+
+struct Node FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef NodeT NativeTableType;
+  typedef NodeBuilder Builder;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return NodeTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_POS = 6,
+    VT_TAGS = 8,
+    VT_PATH = 10,
+    VT_VALUES = 12,
+    VT_FLAGS = 14,
+    VT_CHILDREN = 16,
+    VT_PAYLOAD_TYPE = 18,
+    VT_PAYLOAD = 20
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  const Scene::Point *pos() const {
+    return GetStruct<const Scene::Point *>(VT_POS);
+  }
+  Scene::Point *mutable_pos() {
+    return GetStruct<Scene::Point *>(VT_POS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *tags() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_tags() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  const flatbuffers::Vector<const Scene::Point *> *path() const {
+    return GetPointer<const flatbuffers::Vector<const Scene::Point *> *>(VT_PATH);
+  }
+  flatbuffers::Vector<const Scene::Point *> *mutable_path() {
+    return GetPointer<flatbuffers::Vector<const Scene::Point *> *>(VT_PATH);
+  }
+  const flatbuffers::Vector<int64_t> *values() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_VALUES);
+  }
+  flatbuffers::Vector<int64_t> *mutable_values() {
+    return GetPointer<flatbuffers::Vector<int64_t> *>(VT_VALUES);
+  }
+  const flatbuffers::Vector<uint8_t> *flags() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_FLAGS);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_flags() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_FLAGS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Scene::Node>> *children() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Scene::Node>> *>(VT_CHILDREN);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Scene::Node>> *mutable_children() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Scene::Node>> *>(VT_CHILDREN);
+  }
+  Scene::Payload payload_type() const {
+    return static_cast<Scene::Payload>(GetField<uint8_t>(VT_PAYLOAD_TYPE, 0));
+  }
+  const void *payload() const {
+    return GetPointer<const void *>(VT_PAYLOAD);
+  }
+  template<typename T> const T *payload_as() const;
+  const Scene::Node *payload_as_Node() const {
+    return payload_type() == Scene::Payload_Node ? static_cast<const Scene::Node *>(payload()) : nullptr;
+  }
+  void *mutable_payload() {
+    return GetPointer<void *>(VT_PAYLOAD);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<Scene::Point>(verifier, VT_POS) &&
+           VerifyOffset(verifier, VT_TAGS) &&
+           verifier.VerifyVector(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           VerifyOffset(verifier, VT_PATH) &&
+           verifier.VerifyVector(path()) &&
+           VerifyOffset(verifier, VT_VALUES) &&
+           verifier.VerifyVector(values()) &&
+           VerifyOffset(verifier, VT_FLAGS) &&
+           verifier.VerifyVector(flags()) &&
+           VerifyOffset(verifier, VT_CHILDREN) &&
+           verifier.VerifyVector(children()) &&
+           verifier.VerifyVectorOfTables(children()) &&
+           VerifyField<uint8_t>(verifier, VT_PAYLOAD_TYPE) &&
+           VerifyOffset(verifier, VT_PAYLOAD) &&
+           VerifyPayload(verifier, payload(), payload_type()) &&
+           verifier.EndTable();
+  }
+  NodeT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(NodeT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  NodeT *UnPack(flatbuffers::Arena &_arena, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(NodeT *_o, flatbuffers::Arena &_arena, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Node> Pack(flatbuffers::FlatBufferBuilder &_fbb, const NodeT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+template<> inline const Scene::Node *Node::payload_as<Scene::Node>() const {
+  return payload_as_Node();
+}
+
+struct NodeBuilder {
+  typedef Node Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Node::VT_NAME, name);
+  }
+  void add_pos(const Scene::Point *pos) {
+    fbb_.AddStruct(Node::VT_POS, pos);
+  }
+  void add_tags(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags) {
+    fbb_.AddOffset(Node::VT_TAGS, tags);
+  }
+  void add_path(flatbuffers::Offset<flatbuffers::Vector<const Scene::Point *>> path) {
+    fbb_.AddOffset(Node::VT_PATH, path);
+  }
+  void add_values(flatbuffers::Offset<flatbuffers::Vector<int64_t>> values) {
+    fbb_.AddOffset(Node::VT_VALUES, values);
+  }
+  void add_flags(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flags) {
+    fbb_.AddOffset(Node::VT_FLAGS, flags);
+  }
+  void add_children(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Scene::Node>>> children) {
+    fbb_.AddOffset(Node::VT_CHILDREN, children);
+  }
+  void add_payload_type(Scene::Payload payload_type) {
+    fbb_.AddElement<uint8_t>(Node::VT_PAYLOAD_TYPE, static_cast<uint8_t>(payload_type), 0);
+  }
+  void add_payload(flatbuffers::Offset<void> payload) {
+    fbb_.AddOffset(Node::VT_PAYLOAD, payload);
+  }
+  explicit NodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<Node> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Node>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Node> CreateNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    const Scene::Point *pos = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Scene::Point *>> path = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> values = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flags = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Scene::Node>>> children = 0,
+    Scene::Payload payload_type = Scene::Payload_NONE,
+    flatbuffers::Offset<void> payload = 0) {
+  NodeBuilder builder_(_fbb);
+  builder_.add_payload(payload);
+  builder_.add_children(children);
+  builder_.add_flags(flags);
+  builder_.add_values(values);
+  builder_.add_path(path);
+  builder_.add_tags(tags);
+  builder_.add_pos(pos);
+  builder_.add_name(name);
+  builder_.add_payload_type(payload_type);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Node> CreateNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const Scene::Point *pos = 0,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *tags = nullptr,
+    const std::vector<Scene::Point> *path = nullptr,
+    const std::vector<int64_t> *values = nullptr,
+    const std::vector<uint8_t> *flags = nullptr,
+    const std::vector<flatbuffers::Offset<Scene::Node>> *children = nullptr,
+    Scene::Payload payload_type = Scene::Payload_NONE,
+    flatbuffers::Offset<void> payload = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto tags__ = tags ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*tags) : 0;
+  auto path__ = path ? _fbb.CreateVectorOfStructs<Scene::Point>(*path) : 0;
+  auto values__ = values ? _fbb.CreateVector<int64_t>(*values) : 0;
+  auto flags__ = flags ? _fbb.CreateVector<uint8_t>(*flags) : 0;
+  auto children__ = children ? _fbb.CreateVector<flatbuffers::Offset<Scene::Node>>(*children) : 0;
+  return Scene::CreateNode(
+      _fbb,
+      name__,
+      pos,
+      tags__,
+      path__,
+      values__,
+      flags__,
+      children__,
+      payload_type,
+      payload);
+}
+
+flatbuffers::Offset<Node> CreateNode(flatbuffers::FlatBufferBuilder &_fbb, const NodeT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline NodeT *Node::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<NodeT>(new NodeT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void Node::UnPackTo(NodeT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) _o->name.assign(_e->c_str(), _e->size()); else _o->name.clear(); }
+  { auto _e = pos(); if (_e) { if (_o->pos) *_o->pos = *_e; else _o->pos = flatbuffers::unique_ptr<Scene::Point>(new Scene::Point(*_e)); } else _o->pos = nullptr; }
+  { auto _e = tags(); if (_e) { _o->tags.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->tags[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->tags.clear(); }
+  { auto _e = path(); if (_e) { _o->path.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->path)); } else _o->path.clear(); }
+  { auto _e = values(); if (_e) { _o->values.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->values)); } else _o->values.clear(); }
+  { auto _e = flags(); if (_e) { _o->flags.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->flags[_i] = _e->Get(_i) != 0; } } else _o->flags.clear(); }
+  { auto _e = children(); if (_e) { _o->children.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->children[_i]) _e->Get(_i)->UnPackTo(_o->children[_i].get(), _resolver); else _o->children[_i] = flatbuffers::unique_ptr<Scene::NodeT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->children.clear(); }
+  { auto _e = payload(); if (_e) _o->payload.UnPackTo(_e, payload_type(), _resolver); else _o->payload.Reset(); }
+}
+
+inline NodeT *Node::UnPack(flatbuffers::Arena &_arena, const flatbuffers::resolver_function_t *_resolver) const {
+  flatbuffers::ArenaScope _scope(_arena);
+  return UnPack(_resolver);
+}
+
+inline void Node::UnPackTo(NodeT *_o, flatbuffers::Arena &_arena, const flatbuffers::resolver_function_t *_resolver) const {
+  flatbuffers::ArenaScope _scope(_arena);
+  UnPackTo(_o, _resolver);
+}
+
+inline flatbuffers::Offset<Node> Node::Pack(flatbuffers::FlatBufferBuilder &_fbb, const NodeT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateNode(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Node> CreateNode(flatbuffers::FlatBufferBuilder &_fbb, const NodeT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const NodeT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
+  auto _pos = _o->pos ? _o->pos.get() : 0;
+  auto _tags = _o->tags.size() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>> (_o->tags.size(), [](size_t i, _VectorArgs *__va) { return __va->__fbb->CreateString(__va->__o->tags[i]); }, &_va ) : 0;
+  auto _path = _o->path.size() ? _fbb.CreateVectorOfStructs(_o->path) : 0;
+  auto _values = _o->values.size() ? _fbb.CreateVector(_o->values) : 0;
+  auto _flags = _o->flags.size() ? _fbb.CreateVector<uint8_t>(_o->flags.size(), [](size_t i, _VectorArgs *__va) { return static_cast<uint8_t>(__va->__o->flags[i]); }, &_va) : 0;
+  auto _children = _o->children.size() ? _fbb.CreateVector<flatbuffers::Offset<Scene::Node>> (_o->children.size(), [](size_t i, _VectorArgs *__va) { return CreateNode(*__va->__fbb, __va->__o->children[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _payload_type = _o->payload.type;
+  auto _payload = _o->payload.Pack(_fbb);
+  return Scene::CreateNode(
+      _fbb,
+      _name,
+      _pos,
+      _tags,
+      _path,
+      _values,
+      _flags,
+      _children,
+      _payload_type,
+      _payload);
+}
+
+inline bool VerifyPayload(flatbuffers::Verifier &verifier, const void *obj, Payload type) {
+  switch (type) {
+    case Payload_NONE: {
+      return true;
+    }
+    case Payload_Node: {
+      auto ptr = reinterpret_cast<const Scene::Node *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    default: return true;
+  }
+}
+
+inline bool VerifyPayloadVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types) {
+  if (!values || !types) return !values && !types;
+  if (values->size() != types->size()) return false;
+  for (flatbuffers::uoffset_t i = 0; i < values->size(); ++i) {
+    if (!VerifyPayload(
+        verifier,  values->Get(i), types->GetEnum<Payload>(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline void *PayloadUnion::UnPack(const void *obj, Payload type, const flatbuffers::resolver_function_t *resolver) {
+  switch (type) {
+    case Payload_Node: {
+      auto ptr = reinterpret_cast<const Scene::Node *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    default: return nullptr;
+  }
+}
+
+inline void PayloadUnion::UnPackTo(const void *obj, Payload _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case Payload_Node: {
+        auto ptr = reinterpret_cast<const Scene::Node *>(obj);
+        auto dst = reinterpret_cast<Scene::NodeT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
+inline flatbuffers::Offset<void> PayloadUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
+  switch (type) {
+    case Payload_Node: {
+      auto ptr = reinterpret_cast<const Scene::NodeT *>(value);
+      return CreateNode(_fbb, ptr, _rehasher).Union();
+    }
+    default: return 0;
+  }
+}
+
+inline PayloadUnion::PayloadUnion(const PayloadUnion &u) : type(u.type), value(nullptr) {
+  switch (type) {
+    case Payload_Node: {
+      FLATBUFFERS_ASSERT(false);  // Scene::NodeT not copyable.
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+inline void PayloadUnion::Reset() {
+  switch (type) {
+    case Payload_Node: {
+      auto ptr = reinterpret_cast<Scene::NodeT *>(value);
+      delete ptr;
+      break;
+    }
+    default: break;
+  }
+  value = nullptr;
+  type = Payload_NONE;
+}
+
+inline const flatbuffers::TypeTable *PayloadTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 0, -1 },
+    { flatbuffers::ET_SEQUENCE, 0, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    Scene::NodeTypeTable
+  };
+  static const char * const names[] = {
+    "NONE",
+    "Node"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_UNION, 2, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *PointTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_FLOAT, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 }
+  };
+  static const int64_t values[] = { 0, 4, 8 };
+  static const char * const names[] = {
+    "x",
+    "y"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_STRUCT, 2, type_codes, nullptr, nullptr, values, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *NodeTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_SEQUENCE, 0, 0 },
+    { flatbuffers::ET_STRING, 1, -1 },
+    { flatbuffers::ET_SEQUENCE, 1, 0 },
+    { flatbuffers::ET_LONG, 1, -1 },
+    { flatbuffers::ET_BOOL, 1, -1 },
+    { flatbuffers::ET_SEQUENCE, 1, 1 },
+    { flatbuffers::ET_UTYPE, 0, 2 },
+    { flatbuffers::ET_SEQUENCE, 0, 2 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    Scene::PointTypeTable,
+    Scene::NodeTypeTable,
+    Scene::PayloadTypeTable
+  };
+  static const char * const names[] = {
+    "name",
+    "pos",
+    "tags",
+    "path",
+    "values",
+    "flags",
+    "children",
+    "payload_type",
+    "payload"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 9, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const Scene::Node *GetNode(const void *buf) {
+  return flatbuffers::GetRoot<Scene::Node>(buf);
+}
+
+inline const Scene::Node *GetSizePrefixedNode(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<Scene::Node>(buf);
+}
+
+inline Node *GetMutableNode(void *buf) {
+  return flatbuffers::GetMutableRoot<Node>(buf);
+}
+
+inline bool VerifyNodeBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<Scene::Node>(nullptr);
+}
+
+inline bool VerifySizePrefixedNodeBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<Scene::Node>(nullptr);
+}
+
+inline void FinishNodeBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<Scene::Node> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedNodeBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<Scene::Node> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline flatbuffers::unique_ptr<Scene::NodeT> UnPackNode(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<Scene::NodeT>(GetNode(buf)->UnPack(res));
+}
+
+inline flatbuffers::unique_ptr<Scene::NodeT> UnPackSizePrefixedNode(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<Scene::NodeT>(GetSizePrefixedNode(buf)->UnPack(res));
+}
+
+}  // namespace Scene
+
+#endif  // FLATBUFFERS_GENERATED_ARENATEST_SCENE_H_
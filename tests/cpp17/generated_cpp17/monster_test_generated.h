@@ -238,6 +238,7 @@ struct AnyUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, Any type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, Any _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MyGame::Example::MonsterT *AsMonster() {
@@ -351,6 +352,7 @@ struct AnyUniqueAliasesUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, AnyUniqueAliases type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, AnyUniqueAliases _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MyGame::Example::MonsterT *AsM() {
@@ -436,6 +438,7 @@ struct AnyAmbiguousAliasesUnion {
   void Reset();
 
   static void *UnPack(const void *obj, AnyAmbiguousAliases type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, AnyAmbiguousAliases _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MyGame::Example::MonsterT *AsM1() {
@@ -665,6 +668,12 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Ability FLATBUFFERS_FINAL_CLASS {
   int KeyCompareWithValue(uint32_t val) const {
     return static_cast<int>(id() > val) - static_cast<int>(id() < val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(id());
+  }
+  uint32_t KeySortValue() const {
+    return id();
+  }
   uint32_t distance() const {
     return flatbuffers::EndianScalar(distance_);
   }
@@ -925,6 +934,12 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(uint16_t val) const {
     return static_cast<int>(count() > val) - static_cast<int>(count() < val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(count());
+  }
+  uint16_t KeySortValue() const {
+    return count();
+  }
   template<size_t Index>
   auto get_field() const {
          if constexpr (Index == 0) return id();
@@ -1038,6 +1053,12 @@ struct Referrable FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(uint64_t val) const {
     return static_cast<int>(id() > val) - static_cast<int>(id() < val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(id());
+  }
+  uint64_t KeySortValue() const {
+    return id();
+  }
   template<size_t Index>
   auto get_field() const {
          if constexpr (Index == 0) return id();
@@ -1235,6 +1256,12 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(name());
+  }
+  const flatbuffers::String *KeySortValue() const {
+    return name();
+  }
   const flatbuffers::Vector<uint8_t> *inventory() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
   }
@@ -2551,7 +2578,7 @@ inline StatT *Stat::UnPack(const flatbuffers::resolver_function_t *_resolver) co
 inline void Stat::UnPackTo(StatT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = id(); if (_e) _o->id = _e->str(); }
+  { auto _e = id(); if (_e) _o->id.assign(_e->c_str(), _e->size()); else _o->id.clear(); }
   { auto _e = val(); _o->val = _e; }
   { auto _e = count(); _o->count = _e; }
 }
@@ -2609,20 +2636,19 @@ inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolv
 inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = pos(); if (_e) _o->pos = std::unique_ptr<MyGame::Example::Vec3>(new MyGame::Example::Vec3(*_e)); }
+  { auto _e = pos(); if (_e) { if (_o->pos) *_o->pos = *_e; else _o->pos = std::unique_ptr<MyGame::Example::Vec3>(new MyGame::Example::Vec3(*_e)); } else _o->pos = nullptr; }
   { auto _e = mana(); _o->mana = _e; }
   { auto _e = hp(); _o->hp = _e; }
-  { auto _e = name(); if (_e) _o->name = _e->str(); }
-  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } }
+  { auto _e = name(); if (_e) _o->name.assign(_e->c_str(), _e->size()); else _o->name.clear(); }
+  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } else _o->inventory.clear(); }
   { auto _e = color(); _o->color = _e; }
-  { auto _e = test_type(); _o->test.type = _e; }
-  { auto _e = test(); if (_e) _o->test.value = MyGame::Example::AnyUnion::UnPack(_e, test_type(), _resolver); }
-  { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test4[_i] = *_e->Get(_i); } } }
-  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i] = _e->Get(_i)->str(); } } }
-  { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayoftables[_i] = std::unique_ptr<MyGame::Example::MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } }
-  { auto _e = enemy(); if (_e) _o->enemy = std::unique_ptr<MyGame::Example::MonsterT>(_e->UnPack(_resolver)); }
-  { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testnestedflatbuffer.begin()); } }
-  { auto _e = testempty(); if (_e) _o->testempty = std::unique_ptr<MyGame::Example::StatT>(_e->UnPack(_resolver)); }
+  { auto _e = test(); if (_e) _o->test.UnPackTo(_e, test_type(), _resolver); else _o->test.Reset(); }
+  { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->test4)); } else _o->test4.clear(); }
+  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->testarrayofstring.clear(); }
+  { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->testarrayoftables[_i]) _e->Get(_i)->UnPackTo(_o->testarrayoftables[_i].get(), _resolver); else _o->testarrayoftables[_i] = std::unique_ptr<MyGame::Example::MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->testarrayoftables.clear(); }
+  { auto _e = enemy(); if (_e) { if (_o->enemy) _e->UnPackTo(_o->enemy.get(), _resolver); else _o->enemy = std::unique_ptr<MyGame::Example::MonsterT>(_e->UnPack(_resolver)); } else _o->enemy = nullptr; }
+  { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testnestedflatbuffer.begin()); } else _o->testnestedflatbuffer.clear(); }
+  { auto _e = testempty(); if (_e) { if (_o->testempty) _e->UnPackTo(_o->testempty.get(), _resolver); else _o->testempty = std::unique_ptr<MyGame::Example::StatT>(_e->UnPack(_resolver)); } else _o->testempty = nullptr; }
   { auto _e = testbool(); _o->testbool = _e; }
   { auto _e = testhashs32_fnv1(); _o->testhashs32_fnv1 = _e; }
   { auto _e = testhashu32_fnv1(); _o->testhashu32_fnv1 = _e; }
@@ -2633,39 +2659,37 @@ inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->testhashu32_fnv1a), static_cast<flatbuffers::hash_value_t>(_e)); else _o->testhashu32_fnv1a = nullptr; }
   { auto _e = testhashs64_fnv1a(); _o->testhashs64_fnv1a = _e; }
   { auto _e = testhashu64_fnv1a(); _o->testhashu64_fnv1a = _e; }
-  { auto _e = testarrayofbools(); if (_e) { _o->testarrayofbools.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofbools[_i] = _e->Get(_i) != 0; } } }
+  { auto _e = testarrayofbools(); if (_e) { _o->testarrayofbools.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofbools[_i] = _e->Get(_i) != 0; } } else _o->testarrayofbools.clear(); }
   { auto _e = testf(); _o->testf = _e; }
   { auto _e = testf2(); _o->testf2 = _e; }
   { auto _e = testf3(); _o->testf3 = _e; }
-  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i] = _e->Get(_i)->str(); } } }
-  { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofsortedstruct[_i] = *_e->Get(_i); } } }
-  { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->flex.begin()); } }
-  { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test5[_i] = *_e->Get(_i); } } }
-  { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_longs[_i] = _e->Get(_i); } } }
-  { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_doubles[_i] = _e->Get(_i); } } }
-  { auto _e = parent_namespace_test(); if (_e) _o->parent_namespace_test = std::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); }
-  { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_referrables[_i] = std::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } }
+  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->testarrayofstring2.clear(); }
+  { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->testarrayofsortedstruct)); } else _o->testarrayofsortedstruct.clear(); }
+  { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->flex.begin()); } else _o->flex.clear(); }
+  { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->test5)); } else _o->test5.clear(); }
+  { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vector_of_longs)); } else _o->vector_of_longs.clear(); }
+  { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vector_of_doubles)); } else _o->vector_of_doubles.clear(); }
+  { auto _e = parent_namespace_test(); if (_e) { if (_o->parent_namespace_test) _e->UnPackTo(_o->parent_namespace_test.get(), _resolver); else _o->parent_namespace_test = std::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); } else _o->parent_namespace_test = nullptr; }
+  { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_referrables[_i]) _e->Get(_i)->UnPackTo(_o->vector_of_referrables[_i].get(), _resolver); else _o->vector_of_referrables[_i] = std::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->vector_of_referrables.clear(); }
   { auto _e = single_weak_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->single_weak_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->single_weak_reference = nullptr; }
   { auto _e = vector_of_weak_references(); if (_e) { _o->vector_of_weak_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_weak_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_weak_references[_i] = nullptr; } } }
-  { auto _e = vector_of_strong_referrables(); if (_e) { _o->vector_of_strong_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_strong_referrables[_i] = std::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } }
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_weak_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_weak_references[_i] = nullptr; } } else _o->vector_of_weak_references.clear(); }
+  { auto _e = vector_of_strong_referrables(); if (_e) { _o->vector_of_strong_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_strong_referrables[_i]) _e->Get(_i)->UnPackTo(_o->vector_of_strong_referrables[_i].get(), _resolver); else _o->vector_of_strong_referrables[_i] = std::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->vector_of_strong_referrables.clear(); }
   { auto _e = co_owning_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->co_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->co_owning_reference = nullptr; }
   { auto _e = vector_of_co_owning_references(); if (_e) { _o->vector_of_co_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, default_ptr_type
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */; } } }
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */; } } else _o->vector_of_co_owning_references.clear(); }
   { auto _e = non_owning_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->non_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->non_owning_reference = nullptr; }
   { auto _e = vector_of_non_owning_references(); if (_e) { _o->vector_of_non_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } }
-  { auto _e = any_unique_type(); _o->any_unique.type = _e; }
-  { auto _e = any_unique(); if (_e) _o->any_unique.value = MyGame::Example::AnyUniqueAliasesUnion::UnPack(_e, any_unique_type(), _resolver); }
-  { auto _e = any_ambiguous_type(); _o->any_ambiguous.type = _e; }
-  { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.value = MyGame::Example::AnyAmbiguousAliasesUnion::UnPack(_e, any_ambiguous_type(), _resolver); }
-  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_enums[_i] = static_cast<MyGame::Example::Color>(_e->Get(_i)); } } }
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } else _o->vector_of_non_owning_references.clear(); }
+  { auto _e = any_unique(); if (_e) _o->any_unique.UnPackTo(_e, any_unique_type(), _resolver); else _o->any_unique.Reset(); }
+  { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.UnPackTo(_e, any_ambiguous_type(), _resolver); else _o->any_ambiguous.Reset(); }
+  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vector_of_enums)); } else _o->vector_of_enums.clear(); }
   { auto _e = signed_enum(); _o->signed_enum = _e; }
-  { auto _e = testrequirednestedflatbuffer(); if (_e) { _o->testrequirednestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testrequirednestedflatbuffer.begin()); } }
-  { auto _e = scalar_key_sorted_tables(); if (_e) { _o->scalar_key_sorted_tables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->scalar_key_sorted_tables[_i] = std::unique_ptr<MyGame::Example::StatT>(_e->Get(_i)->UnPack(_resolver)); } } }
+  { auto _e = testrequirednestedflatbuffer(); if (_e) { _o->testrequirednestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testrequirednestedflatbuffer.begin()); } else _o->testrequirednestedflatbuffer.clear(); }
+  { auto _e = scalar_key_sorted_tables(); if (_e) { _o->scalar_key_sorted_tables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->scalar_key_sorted_tables[_i]) _e->Get(_i)->UnPackTo(_o->scalar_key_sorted_tables[_i].get(), _resolver); else _o->scalar_key_sorted_tables[_i] = std::unique_ptr<MyGame::Example::StatT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->scalar_key_sorted_tables.clear(); }
 }
 
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -2799,8 +2823,8 @@ inline void TypeAliases::UnPackTo(TypeAliasesT *_o, const flatbuffers::resolver_
   { auto _e = u64(); _o->u64 = _e; }
   { auto _e = f32(); _o->f32 = _e; }
   { auto _e = f64(); _o->f64 = _e; }
-  { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->v8.begin()); } }
-  { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vf64[_i] = _e->Get(_i); } } }
+  { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->v8.begin()); } else _o->v8.clear(); }
+  { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vf64)); } else _o->vf64.clear(); }
 }
 
 inline flatbuffers::Offset<TypeAliases> TypeAliases::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -2890,6 +2914,35 @@ inline void *AnyUnion::UnPack(const void *obj, Any type, const flatbuffers::reso
   }
 }
 
+inline void AnyUnion::UnPackTo(const void *obj, Any _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case Any::Monster: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case Any::TestSimpleTableWithEnum: {
+        auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::TestSimpleTableWithEnumT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case Any::MyGame_Example2_Monster: {
+        auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example2::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
 inline flatbuffers::Offset<void> AnyUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Any::Monster: {
@@ -3001,6 +3054,35 @@ inline void *AnyUniqueAliasesUnion::UnPack(const void *obj, AnyUniqueAliases typ
   }
 }
 
+inline void AnyUniqueAliasesUnion::UnPackTo(const void *obj, AnyUniqueAliases _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case AnyUniqueAliases::M: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case AnyUniqueAliases::TS: {
+        auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::TestSimpleTableWithEnumT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case AnyUniqueAliases::M2: {
+        auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example2::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
 inline flatbuffers::Offset<void> AnyUniqueAliasesUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case AnyUniqueAliases::M: {
@@ -3112,6 +3194,35 @@ inline void *AnyAmbiguousAliasesUnion::UnPack(const void *obj, AnyAmbiguousAlias
   }
 }
 
+inline void AnyAmbiguousAliasesUnion::UnPackTo(const void *obj, AnyAmbiguousAliases _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case AnyAmbiguousAliases::M1: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case AnyAmbiguousAliases::M2: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case AnyAmbiguousAliases::M3: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
 inline flatbuffers::Offset<void> AnyAmbiguousAliasesUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case AnyAmbiguousAliases::M1: {
@@ -24,6 +24,7 @@
 #include "flatbuffers/idl.h"
 #include "flatbuffers/minireflect.h"
 #include "flatbuffers/registry.h"
+#include "flatbuffers/static_reflection.h"
 #include "flatbuffers/util.h"
 #include "stringify_util.h"
 #include "test_assert.h"
@@ -200,6 +201,111 @@ void CreateTableByTypeTest() {
   TEST_EQ(stat->count(), 7);
 }
 
+/*******************************************************************************
+** Generic Algorithms over Static Reflection Traits.
+*******************************************************************************/
+void StaticReflectionAlgorithmsTest() {
+  using cpp17::MyGame::Example::Stat;
+  using cpp17::MyGame::Example::TypeAliases;
+
+  // Monster has unions, which only StaticToJson supports, so compare its
+  // Vec3 structs.
+  flatbuffers::FlatBufferBuilder fbb1, fbb2;
+  const auto *monster1 = BuildMonster(fbb1);
+  const auto *monster2 = BuildMonster(fbb2);
+  TEST_ASSERT(monster1 != monster2);
+  const auto &pos1 = *monster1->pos();
+  const auto &pos2 = *monster2->pos();
+  TEST_ASSERT(flatbuffers::StaticEqual(pos1, pos2));
+  TEST_EQ(flatbuffers::StaticHash(pos1), flatbuffers::StaticHash(pos2));
+  TEST_EQ(flatbuffers::StaticToJson(*monster1),
+          flatbuffers::StaticToJson(*monster2));
+
+  std::vector<std::string> diffs;
+  auto on_diff = [&diffs](const char *name) { diffs.push_back(name); };
+  flatbuffers::StaticDiff(pos1, pos2, on_diff);
+  TEST_EQ(diffs.size(), 0U);
+
+  // Change a scalar and a field of a nested struct.
+  auto mutable_monster2 =
+      cpp17::MyGame::Example::GetMutableMonster(fbb2.GetBufferPointer());
+  mutable_monster2->mutable_pos()->mutate_z(4.4f);
+  mutable_monster2->mutable_pos()->mutable_test3().mutate_b(91);
+  TEST_ASSERT(!flatbuffers::StaticEqual(pos1, pos2));
+  TEST_ASSERT(flatbuffers::StaticHash(pos1) != flatbuffers::StaticHash(pos2));
+  flatbuffers::StaticDiff(pos1, pos2, on_diff);
+  TEST_EQ(diffs.size(), 2U);
+  TEST_EQ_STR(diffs[0].c_str(), "z");
+  TEST_EQ_STR(diffs[1].c_str(), "test3");
+
+  // JSON leaves out absent fields and the union value, and keeps its type.
+  const std::string json = flatbuffers::StaticToJson(*monster1);
+  const std::string json_prefix =
+      R"({"pos":{"x":1.1,"y":2.2,"z":3.3,"test1":6.6,"test2":2,)"
+      R"("test3":{"a":11,"b":90}},"mana":1,"hp":2,"name":"my_monster",)"
+      R"("inventory":[4,5,6,7],"color":8,"test_type":0,"testbool":true,)";
+  TEST_EQ(json.find(json_prefix), 0U);
+  TEST_EQ(json.find("enemy"), std::string::npos);
+  TEST_EQ(json.find("\"test\":"), std::string::npos);
+
+  // Copy tables into a new builder, including strings and vectors.
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.Finish(cpp17::MyGame::Example::CreateStat(
+      fbb3, fbb3.CreateString("a\"b"), 42, 7));
+  auto stat = flatbuffers::GetRoot<Stat>(fbb3.GetBufferPointer());
+  TEST_EQ_STR(flatbuffers::StaticToJson(*stat).c_str(),
+              R"({"id":"a\"b","val":42,"count":7})");
+
+  flatbuffers::FlatBufferBuilder fbb4;
+  fbb4.Finish(flatbuffers::StaticCopy(fbb4, *stat));
+  auto stat_copy = flatbuffers::GetRoot<Stat>(fbb4.GetBufferPointer());
+  TEST_ASSERT(flatbuffers::StaticEqual(*stat, *stat_copy));
+  TEST_EQ(flatbuffers::StaticHash(*stat), flatbuffers::StaticHash(*stat_copy));
+  diffs.clear();
+  flatbuffers::StaticDiff(*stat, *stat_copy, on_diff);
+  TEST_EQ(diffs.size(), 0U);
+  auto mutable_stat_copy =
+      flatbuffers::GetMutableRoot<Stat>(fbb4.GetBufferPointer());
+  TEST_ASSERT(mutable_stat_copy->mutate_val(43));
+  TEST_ASSERT(!flatbuffers::StaticEqual(*stat, *stat_copy));
+  flatbuffers::StaticDiff(*stat, *stat_copy, on_diff);
+  TEST_EQ(diffs.size(), 1U);
+  TEST_EQ_STR(diffs[0].c_str(), "val");
+
+  flatbuffers::FlatBufferBuilder fbb5;
+  std::vector<int8_t> v8 = { -1, 0, 1 };
+  std::vector<double> vf64 = { 0.5, -2.0 };
+  fbb5.Finish(cpp17::MyGame::Example::CreateTypeAliases(
+      fbb5, -8, 8, -16, 16, -32, 32, -64, 64, 1.5f, 2.5,
+      fbb5.CreateVector(v8), fbb5.CreateVector(vf64)));
+  auto aliases = flatbuffers::GetRoot<TypeAliases>(fbb5.GetBufferPointer());
+  fbb4.Clear();
+  fbb4.Finish(flatbuffers::StaticCopy(fbb4, *aliases));
+  auto aliases_copy =
+      flatbuffers::GetRoot<TypeAliases>(fbb4.GetBufferPointer());
+  TEST_ASSERT(flatbuffers::StaticEqual(*aliases, *aliases_copy));
+  TEST_EQ_STR(flatbuffers::StaticToJson(*aliases_copy).c_str(),
+              R"({"i8":-8,"u8":8,"i16":-16,"u16":16,"i32":-32,"u32":32,)"
+              R"("i64":-64,"u64":64,"f32":1.5,"f64":2.5,"v8":[-1,0,1],)"
+              R"("vf64":[0.5,-2.0]})");
+
+  // Absent optional scalars are left out, and survive a copy as absent.
+  fbb5.Clear();
+  fbb5.Finish(cpp17::optional_scalars::CreateScalarStuff(
+      fbb5, 1, static_cast<int8_t>(2)));
+  auto opts = cpp17::optional_scalars::GetScalarStuff(fbb5.GetBufferPointer());
+  fbb4.Clear();
+  fbb4.Finish(flatbuffers::StaticCopy(fbb4, *opts));
+  auto opts_copy =
+      cpp17::optional_scalars::GetScalarStuff(fbb4.GetBufferPointer());
+  TEST_ASSERT(flatbuffers::StaticEqual(*opts, *opts_copy));
+  TEST_ASSERT(!opts_copy->maybe_u8().has_value());
+  TEST_EQ(opts_copy->maybe_i8().value(), 2);
+  const std::string opts_json = flatbuffers::StaticToJson(*opts_copy);
+  TEST_EQ(opts_json.find(R"({"just_i8":1,"maybe_i8":2,"default_i8":42,)"), 0U);
+  TEST_EQ(opts_json.find("maybe_u8"), std::string::npos);
+}
+
 void OptionalScalarsTest() {
   static_assert(
       std::is_same<flatbuffers::Optional<float>, std::optional<float>>::value);
@@ -246,6 +352,7 @@ int FlatBufferCpp17Tests() {
   CreateTableByTypeTest();
   OptionalScalarsTest();
   StringifyAnyFlatbuffersTypeTest();
+  StaticReflectionAlgorithmsTest();
   return 0;
 }
 
@@ -30,9 +30,12 @@ TEST_JS_TS_FLAGS="--gen-name-strings"
 TEST_BASE_FLAGS="--reflect-names --gen-mutable --gen-object-api"
 TEST_RUST_FLAGS="$TEST_BASE_FLAGS --gen-name-strings"
 TEST_NOINCL_FLAGS="$TEST_BASE_FLAGS --no-includes"
+# Every C++ header generated from monster_test.fbs must use the same flags,
+# since they all write monster_test_generated.h (or compare against it).
+TEST_MONSTER_CPP_FLAGS="$TEST_NOINCL_FLAGS $TEST_CPP_FLAGS --gen-json-printer --gen-json-parser --gen-partial-unpack --gen-static-layout --gen-hash"
 
 ../flatc --binary --cpp --java --kotlin  --csharp --dart --go --lobster --lua --ts --php --grpc \
-$TEST_NOINCL_FLAGS $TEST_CPP_FLAGS $TEST_CS_FLAGS -I include_test monster_test.fbs monsterdata_test.json
+$TEST_MONSTER_CPP_FLAGS $TEST_CS_FLAGS -I include_test monster_test.fbs monsterdata_test.json
 ../flatc --rust $TEST_RUST_FLAGS -I include_test monster_test.fbs monsterdata_test.json
 
 ../flatc --python $TEST_BASE_FLAGS -I include_test monster_test.fbs monsterdata_test.json
@@ -48,18 +51,19 @@ $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS $TEST_CS_FLAGS $TEST_JS_TS_FLAGS -o namespace
 ../flatc --rust -I include_test -o include_test include_test/include_test1.fbs
 ../flatc --rust -I include_test -o include_test/sub include_test/sub/include_test2.fbs
 ../flatc -b --schema --bfbs-comments --bfbs-builtins -I include_test monster_test.fbs
-../flatc --cpp --bfbs-comments --bfbs-builtins --bfbs-gen-embed $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS -I include_test monster_test.fbs
+../flatc --cpp --bfbs-comments --bfbs-builtins --bfbs-gen-embed $TEST_MONSTER_CPP_FLAGS -I include_test monster_test.fbs
 ../flatc -b --schema --bfbs-comments --bfbs-builtins -I include_test arrays_test.fbs
 ../flatc --jsonschema --schema -I include_test monster_test.fbs
 ../flatc --cpp --java --kotlin --csharp --python $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS $TEST_CS_FLAGS monster_extra.fbs monsterdata_extra.json
 ../flatc --cpp --java --csharp --jsonschema $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS $TEST_CS_FLAGS --scoped-enums arrays_test.fbs
 ../flatc --python $TEST_BASE_FLAGS arrays_test.fbs
 ../flatc --dart monster_extra.fbs
+../flatc --cpp $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS --cpp-arena arena_test.fbs
 
 # Generate optional scalar code for tests.
 ../flatc --java --kotlin --lobster --ts optional_scalars.fbs
 ../flatc --csharp --rust --gen-object-api optional_scalars.fbs
-../flatc $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS --cpp optional_scalars.fbs
+../flatc $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS --gen-static-layout --cpp optional_scalars.fbs
 
 # Generate string/vector default code for tests
 ../flatc --rust --gen-object-api more_defaults.fbs
@@ -77,7 +81,7 @@ cd $working_dir
 
 # Tests if the --filename-suffix and --filename-ext works and produces the same
 # outputs.
-../flatc --cpp --filename-suffix _suffix --filename-ext hpp $TEST_NOINCL_FLAGS $TEST_CPP_FLAGS -I include_test monster_test.fbs
+../flatc --cpp --filename-suffix _suffix --filename-ext hpp $TEST_MONSTER_CPP_FLAGS -I include_test monster_test.fbs
 if [ -f "monster_test_suffix.hpp" ]; then
   if ! cmp -s "monster_test_suffix.hpp" "monster_test_generated.h"; then
     echo "[Error] Filename suffix option did not produce identical results"
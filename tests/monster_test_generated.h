@@ -6,6 +6,9 @@
 
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/flexbuffers.h"
+#include "flatbuffers/util.h"
+#include "flatbuffers/hash.h"
+#include "flatbuffers/json_reader.h"
 
 namespace MyGame {
 
@@ -266,6 +269,7 @@ struct AnyUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, Any type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, Any _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MyGame::Example::MonsterT *AsMonster() {
@@ -408,6 +412,7 @@ struct AnyUniqueAliasesUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, AnyUniqueAliases type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, AnyUniqueAliases _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MyGame::Example::MonsterT *AsM() {
@@ -522,6 +527,7 @@ struct AnyAmbiguousAliasesUnion {
   void Reset();
 
   static void *UnPack(const void *obj, AnyAmbiguousAliases type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, AnyAmbiguousAliases _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   MyGame::Example::MonsterT *AsM1() {
@@ -757,6 +763,12 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Ability FLATBUFFERS_FINAL_CLASS {
   int KeyCompareWithValue(uint32_t val) const {
     return static_cast<int>(id() > val) - static_cast<int>(id() < val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(id());
+  }
+  uint32_t KeySortValue() const {
+    return id();
+  }
   uint32_t distance() const {
     return flatbuffers::EndianScalar(distance_);
   }
@@ -804,6 +816,7 @@ struct InParentNamespace FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   }
   InParentNamespaceT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(InParentNamespaceT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(InParentNamespaceT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<InParentNamespace> Pack(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
@@ -828,6 +841,13 @@ inline flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<InParentNamespace> CreateInParentNamespaceStaticLayout(
+    flatbuffers::FlatBufferBuilder &_fbb) {
+  static const flatbuffers::voffset_t _vtable[] = { 4, 4 };
+  const auto _t = _fbb.StartStaticTable(4, 4);
+  return flatbuffers::Offset<InParentNamespace>(_fbb.EndStaticTable(_t, _vtable));
+}
+
 flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 namespace Example2 {
@@ -857,6 +877,7 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   }
   MonsterT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(MonsterT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
@@ -881,6 +902,13 @@ inline flatbuffers::Offset<Monster> CreateMonster(
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<Monster> CreateMonsterStaticLayout(
+    flatbuffers::FlatBufferBuilder &_fbb) {
+  static const flatbuffers::voffset_t _vtable[] = { 4, 4 };
+  const auto _t = _fbb.StartStaticTable(4, 4);
+  return flatbuffers::Offset<Monster>(_fbb.EndStaticTable(_t, _vtable));
+}
+
 flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 }  // namespace Example2
@@ -924,6 +952,7 @@ struct TestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Ta
   }
   TestSimpleTableWithEnumT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(TestSimpleTableWithEnumT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(TestSimpleTableWithEnumT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<TestSimpleTableWithEnum> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
@@ -953,6 +982,15 @@ inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnu
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnumStaticLayout(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    MyGame::Example::Color color) {
+  static const flatbuffers::voffset_t _vtable[] = { 6, 8, 4 };
+  const auto _t = _fbb.StartStaticTable(8, 4);
+  _fbb.SetStaticField<uint8_t>(_t, 4, static_cast<uint8_t>(color));
+  return flatbuffers::Offset<TestSimpleTableWithEnum>(_fbb.EndStaticTable(_t, _vtable));
+}
+
 flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 struct StatT : public flatbuffers::NativeTable {
@@ -1009,6 +1047,12 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(uint16_t val) const {
     return static_cast<int>(count() > val) - static_cast<int>(count() < val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(count());
+  }
+  uint16_t KeySortValue() const {
+    return count();
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_ID) &&
@@ -1019,6 +1063,7 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   }
   StatT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(StatT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(StatT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Stat> Pack(flatbuffers::FlatBufferBuilder &_fbb, const StatT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
@@ -1058,6 +1103,22 @@ inline flatbuffers::Offset<Stat> CreateStat(
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<Stat> CreateStatStaticLayout(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> id,
+    int64_t val,
+    uint16_t count) {
+  if (!id.o) {
+    return CreateStat(_fbb, id, val, count);
+  }
+  static const flatbuffers::voffset_t _vtable[] = { 10, 24, 16, 8, 20 };
+  const auto _t = _fbb.StartStaticTable(24, 8);
+  _fbb.SetStaticField<int64_t>(_t, 8, val);
+  _fbb.SetStaticOffset(_t, 16, id);
+  _fbb.SetStaticField<uint16_t>(_t, 20, count);
+  return flatbuffers::Offset<Stat>(_fbb.EndStaticTable(_t, _vtable));
+}
+
 inline flatbuffers::Offset<Stat> CreateStatDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
     const char *id = nullptr,
@@ -1109,6 +1170,12 @@ struct Referrable FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(uint64_t val) const {
     return static_cast<int>(id() > val) - static_cast<int>(id() < val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(id());
+  }
+  uint64_t KeySortValue() const {
+    return id();
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint64_t>(verifier, VT_ID) &&
@@ -1116,6 +1183,7 @@ struct Referrable FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   }
   ReferrableT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(ReferrableT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ReferrableT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Referrable> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
@@ -1145,6 +1213,15 @@ inline flatbuffers::Offset<Referrable> CreateReferrable(
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<Referrable> CreateReferrableStaticLayout(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t id) {
+  static const flatbuffers::voffset_t _vtable[] = { 6, 16, 8 };
+  const auto _t = _fbb.StartStaticTable(16, 8);
+  _fbb.SetStaticField<uint64_t>(_t, 8, id);
+  return flatbuffers::Offset<Referrable>(_fbb.EndStaticTable(_t, _vtable));
+}
+
 flatbuffers::Offset<Referrable> CreateReferrable(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 struct MonsterT : public flatbuffers::NativeTable {
@@ -1343,6 +1420,12 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  uint64_t KeyHash() const {
+    return flatbuffers::HashKey(name());
+  }
+  const flatbuffers::String *KeySortValue() const {
+    return name();
+  }
   const flatbuffers::Vector<uint8_t> *inventory() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
   }
@@ -1739,6 +1822,7 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   }
   MonsterT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(MonsterT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
@@ -2316,6 +2400,7 @@ struct TypeAliases FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   }
   TypeAliasesT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(TypeAliasesT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(TypeAliasesT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<TypeAliases> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
@@ -2400,6 +2485,40 @@ inline flatbuffers::Offset<TypeAliases> CreateTypeAliases(
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<TypeAliases> CreateTypeAliasesStaticLayout(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int8_t i8,
+    uint8_t u8,
+    int16_t i16,
+    uint16_t u16,
+    int32_t i32,
+    uint32_t u32,
+    int64_t i64,
+    uint64_t u64,
+    float f32,
+    double f64,
+    flatbuffers::Offset<flatbuffers::Vector<int8_t>> v8,
+    flatbuffers::Offset<flatbuffers::Vector<double>> vf64) {
+  if (!v8.o || !vf64.o) {
+    return CreateTypeAliases(_fbb, i8, u8, i16, u16, i32, u32, i64, u64, f32, f64, v8, vf64);
+  }
+  static const flatbuffers::voffset_t _vtable[] = { 28, 64, 56, 57, 52, 54, 32, 36, 8, 16, 40, 24, 44, 48 };
+  const auto _t = _fbb.StartStaticTable(64, 8);
+  _fbb.SetStaticField<int64_t>(_t, 8, i64);
+  _fbb.SetStaticField<uint64_t>(_t, 16, u64);
+  _fbb.SetStaticField<double>(_t, 24, f64);
+  _fbb.SetStaticField<int32_t>(_t, 32, i32);
+  _fbb.SetStaticField<uint32_t>(_t, 36, u32);
+  _fbb.SetStaticField<float>(_t, 40, f32);
+  _fbb.SetStaticOffset(_t, 44, v8);
+  _fbb.SetStaticOffset(_t, 48, vf64);
+  _fbb.SetStaticField<int16_t>(_t, 52, i16);
+  _fbb.SetStaticField<uint16_t>(_t, 54, u16);
+  _fbb.SetStaticField<int8_t>(_t, 56, i8);
+  _fbb.SetStaticField<uint8_t>(_t, 57, u8);
+  return flatbuffers::Offset<TypeAliases>(_fbb.EndStaticTable(_t, _vtable));
+}
+
 inline flatbuffers::Offset<TypeAliases> CreateTypeAliasesDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
     int8_t i8 = 0,
@@ -2447,6 +2566,12 @@ inline void InParentNamespace::UnPackTo(InParentNamespaceT *_o, const flatbuffer
   (void)_resolver;
 }
 
+inline void InParentNamespace::UnPackTo(InParentNamespaceT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_fields;
+  (void)_resolver;
+}
+
 inline flatbuffers::Offset<InParentNamespace> InParentNamespace::Pack(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
   return CreateInParentNamespace(_fbb, _o, _rehasher);
 }
@@ -2472,6 +2597,12 @@ inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function
   (void)_resolver;
 }
 
+inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_fields;
+  (void)_resolver;
+}
+
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
   return CreateMonster(_fbb, _o, _rehasher);
 }
@@ -2500,6 +2631,13 @@ inline void TestSimpleTableWithEnum::UnPackTo(TestSimpleTableWithEnumT *_o, cons
   { auto _e = color(); _o->color = _e; }
 }
 
+inline void TestSimpleTableWithEnum::UnPackTo(TestSimpleTableWithEnumT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_fields;
+  (void)_resolver;
+  if (_fields.Contains(VT_COLOR)) { auto _e = color(); _o->color = _e; }
+}
+
 inline flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnum::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
   return CreateTestSimpleTableWithEnum(_fbb, _o, _rehasher);
 }
@@ -2523,11 +2661,20 @@ inline StatT *Stat::UnPack(const flatbuffers::resolver_function_t *_resolver) co
 inline void Stat::UnPackTo(StatT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = id(); if (_e) _o->id = _e->str(); }
+  { auto _e = id(); if (_e) _o->id.assign(_e->c_str(), _e->size()); else _o->id.clear(); }
   { auto _e = val(); _o->val = _e; }
   { auto _e = count(); _o->count = _e; }
 }
 
+inline void Stat::UnPackTo(StatT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_fields;
+  (void)_resolver;
+  if (_fields.Contains(VT_ID)) { auto _e = id(); if (_e) _o->id.assign(_e->c_str(), _e->size()); else _o->id.clear(); }
+  if (_fields.Contains(VT_VAL)) { auto _e = val(); _o->val = _e; }
+  if (_fields.Contains(VT_COUNT)) { auto _e = count(); _o->count = _e; }
+}
+
 inline flatbuffers::Offset<Stat> Stat::Pack(flatbuffers::FlatBufferBuilder &_fbb, const StatT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
   return CreateStat(_fbb, _o, _rehasher);
 }
@@ -2558,6 +2705,13 @@ inline void Referrable::UnPackTo(ReferrableT *_o, const flatbuffers::resolver_fu
   { auto _e = id(); _o->id = _e; }
 }
 
+inline void Referrable::UnPackTo(ReferrableT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_fields;
+  (void)_resolver;
+  if (_fields.Contains(VT_ID)) { auto _e = id(); _o->id = _e; }
+}
+
 inline flatbuffers::Offset<Referrable> Referrable::Pack(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
   return CreateReferrable(_fbb, _o, _rehasher);
 }
@@ -2581,20 +2735,19 @@ inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolv
 inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = pos(); if (_e) _o->pos = flatbuffers::unique_ptr<MyGame::Example::Vec3>(new MyGame::Example::Vec3(*_e)); }
+  { auto _e = pos(); if (_e) { if (_o->pos) *_o->pos = *_e; else _o->pos = flatbuffers::unique_ptr<MyGame::Example::Vec3>(new MyGame::Example::Vec3(*_e)); } else _o->pos = nullptr; }
   { auto _e = mana(); _o->mana = _e; }
   { auto _e = hp(); _o->hp = _e; }
-  { auto _e = name(); if (_e) _o->name = _e->str(); }
-  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } }
+  { auto _e = name(); if (_e) _o->name.assign(_e->c_str(), _e->size()); else _o->name.clear(); }
+  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } else _o->inventory.clear(); }
   { auto _e = color(); _o->color = _e; }
-  { auto _e = test_type(); _o->test.type = _e; }
-  { auto _e = test(); if (_e) _o->test.value = MyGame::Example::AnyUnion::UnPack(_e, test_type(), _resolver); }
-  { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test4[_i] = *_e->Get(_i); } } }
-  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i] = _e->Get(_i)->str(); } } }
-  { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayoftables[_i] = flatbuffers::unique_ptr<MyGame::Example::MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } }
-  { auto _e = enemy(); if (_e) _o->enemy = flatbuffers::unique_ptr<MyGame::Example::MonsterT>(_e->UnPack(_resolver)); }
-  { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testnestedflatbuffer.begin()); } }
-  { auto _e = testempty(); if (_e) _o->testempty = flatbuffers::unique_ptr<MyGame::Example::StatT>(_e->UnPack(_resolver)); }
+  { auto _e = test(); if (_e) _o->test.UnPackTo(_e, test_type(), _resolver); else _o->test.Reset(); }
+  { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->test4)); } else _o->test4.clear(); }
+  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->testarrayofstring.clear(); }
+  { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->testarrayoftables[_i]) _e->Get(_i)->UnPackTo(_o->testarrayoftables[_i].get(), _resolver); else _o->testarrayoftables[_i] = flatbuffers::unique_ptr<MyGame::Example::MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->testarrayoftables.clear(); }
+  { auto _e = enemy(); if (_e) { if (_o->enemy) _e->UnPackTo(_o->enemy.get(), _resolver); else _o->enemy = flatbuffers::unique_ptr<MyGame::Example::MonsterT>(_e->UnPack(_resolver)); } else _o->enemy = nullptr; }
+  { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testnestedflatbuffer.begin()); } else _o->testnestedflatbuffer.clear(); }
+  { auto _e = testempty(); if (_e) { if (_o->testempty) _e->UnPackTo(_o->testempty.get(), _resolver); else _o->testempty = flatbuffers::unique_ptr<MyGame::Example::StatT>(_e->UnPack(_resolver)); } else _o->testempty = nullptr; }
   { auto _e = testbool(); _o->testbool = _e; }
   { auto _e = testhashs32_fnv1(); _o->testhashs32_fnv1 = _e; }
   { auto _e = testhashu32_fnv1(); _o->testhashu32_fnv1 = _e; }
@@ -2605,39 +2758,97 @@ inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->testhashu32_fnv1a), static_cast<flatbuffers::hash_value_t>(_e)); else _o->testhashu32_fnv1a = nullptr; }
   { auto _e = testhashs64_fnv1a(); _o->testhashs64_fnv1a = _e; }
   { auto _e = testhashu64_fnv1a(); _o->testhashu64_fnv1a = _e; }
-  { auto _e = testarrayofbools(); if (_e) { _o->testarrayofbools.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofbools[_i] = _e->Get(_i) != 0; } } }
+  { auto _e = testarrayofbools(); if (_e) { _o->testarrayofbools.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofbools[_i] = _e->Get(_i) != 0; } } else _o->testarrayofbools.clear(); }
   { auto _e = testf(); _o->testf = _e; }
   { auto _e = testf2(); _o->testf2 = _e; }
   { auto _e = testf3(); _o->testf3 = _e; }
-  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i] = _e->Get(_i)->str(); } } }
-  { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofsortedstruct[_i] = *_e->Get(_i); } } }
-  { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->flex.begin()); } }
-  { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test5[_i] = *_e->Get(_i); } } }
-  { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_longs[_i] = _e->Get(_i); } } }
-  { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_doubles[_i] = _e->Get(_i); } } }
-  { auto _e = parent_namespace_test(); if (_e) _o->parent_namespace_test = flatbuffers::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); }
-  { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_referrables[_i] = flatbuffers::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } }
+  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->testarrayofstring2.clear(); }
+  { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->testarrayofsortedstruct)); } else _o->testarrayofsortedstruct.clear(); }
+  { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->flex.begin()); } else _o->flex.clear(); }
+  { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->test5)); } else _o->test5.clear(); }
+  { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vector_of_longs)); } else _o->vector_of_longs.clear(); }
+  { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vector_of_doubles)); } else _o->vector_of_doubles.clear(); }
+  { auto _e = parent_namespace_test(); if (_e) { if (_o->parent_namespace_test) _e->UnPackTo(_o->parent_namespace_test.get(), _resolver); else _o->parent_namespace_test = flatbuffers::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); } else _o->parent_namespace_test = nullptr; }
+  { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_referrables[_i]) _e->Get(_i)->UnPackTo(_o->vector_of_referrables[_i].get(), _resolver); else _o->vector_of_referrables[_i] = flatbuffers::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->vector_of_referrables.clear(); }
   { auto _e = single_weak_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->single_weak_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->single_weak_reference = nullptr; }
   { auto _e = vector_of_weak_references(); if (_e) { _o->vector_of_weak_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_weak_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_weak_references[_i] = nullptr; } } }
-  { auto _e = vector_of_strong_referrables(); if (_e) { _o->vector_of_strong_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_strong_referrables[_i] = flatbuffers::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } }
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_weak_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_weak_references[_i] = nullptr; } } else _o->vector_of_weak_references.clear(); }
+  { auto _e = vector_of_strong_referrables(); if (_e) { _o->vector_of_strong_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_strong_referrables[_i]) _e->Get(_i)->UnPackTo(_o->vector_of_strong_referrables[_i].get(), _resolver); else _o->vector_of_strong_referrables[_i] = flatbuffers::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->vector_of_strong_referrables.clear(); }
   { auto _e = co_owning_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->co_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->co_owning_reference = nullptr; }
   { auto _e = vector_of_co_owning_references(); if (_e) { _o->vector_of_co_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, default_ptr_type
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */; } } }
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */; } } else _o->vector_of_co_owning_references.clear(); }
   { auto _e = non_owning_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->non_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->non_owning_reference = nullptr; }
   { auto _e = vector_of_non_owning_references(); if (_e) { _o->vector_of_non_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } }
-  { auto _e = any_unique_type(); _o->any_unique.type = _e; }
-  { auto _e = any_unique(); if (_e) _o->any_unique.value = MyGame::Example::AnyUniqueAliasesUnion::UnPack(_e, any_unique_type(), _resolver); }
-  { auto _e = any_ambiguous_type(); _o->any_ambiguous.type = _e; }
-  { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.value = MyGame::Example::AnyAmbiguousAliasesUnion::UnPack(_e, any_ambiguous_type(), _resolver); }
-  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_enums[_i] = static_cast<MyGame::Example::Color>(_e->Get(_i)); } } }
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } else _o->vector_of_non_owning_references.clear(); }
+  { auto _e = any_unique(); if (_e) _o->any_unique.UnPackTo(_e, any_unique_type(), _resolver); else _o->any_unique.Reset(); }
+  { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.UnPackTo(_e, any_ambiguous_type(), _resolver); else _o->any_ambiguous.Reset(); }
+  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vector_of_enums)); } else _o->vector_of_enums.clear(); }
   { auto _e = signed_enum(); _o->signed_enum = _e; }
-  { auto _e = testrequirednestedflatbuffer(); if (_e) { _o->testrequirednestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testrequirednestedflatbuffer.begin()); } }
-  { auto _e = scalar_key_sorted_tables(); if (_e) { _o->scalar_key_sorted_tables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->scalar_key_sorted_tables[_i] = flatbuffers::unique_ptr<MyGame::Example::StatT>(_e->Get(_i)->UnPack(_resolver)); } } }
+  { auto _e = testrequirednestedflatbuffer(); if (_e) { _o->testrequirednestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testrequirednestedflatbuffer.begin()); } else _o->testrequirednestedflatbuffer.clear(); }
+  { auto _e = scalar_key_sorted_tables(); if (_e) { _o->scalar_key_sorted_tables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->scalar_key_sorted_tables[_i]) _e->Get(_i)->UnPackTo(_o->scalar_key_sorted_tables[_i].get(), _resolver); else _o->scalar_key_sorted_tables[_i] = flatbuffers::unique_ptr<MyGame::Example::StatT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->scalar_key_sorted_tables.clear(); }
+}
+
+inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_fields;
+  (void)_resolver;
+  if (_fields.Contains(VT_POS)) { auto _e = pos(); if (_e) { if (_o->pos) *_o->pos = *_e; else _o->pos = flatbuffers::unique_ptr<MyGame::Example::Vec3>(new MyGame::Example::Vec3(*_e)); } else _o->pos = nullptr; }
+  if (_fields.Contains(VT_MANA)) { auto _e = mana(); _o->mana = _e; }
+  if (_fields.Contains(VT_HP)) { auto _e = hp(); _o->hp = _e; }
+  if (_fields.Contains(VT_NAME)) { auto _e = name(); if (_e) _o->name.assign(_e->c_str(), _e->size()); else _o->name.clear(); }
+  if (_fields.Contains(VT_INVENTORY)) { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } else _o->inventory.clear(); }
+  if (_fields.Contains(VT_COLOR)) { auto _e = color(); _o->color = _e; }
+  if (_fields.Contains(VT_TEST)) { auto _e = test(); if (_e) _o->test.UnPackTo(_e, test_type(), _resolver); else _o->test.Reset(); }
+  if (_fields.Contains(VT_TEST4)) { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->test4)); } else _o->test4.clear(); }
+  if (_fields.Contains(VT_TESTARRAYOFSTRING)) { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->testarrayofstring.clear(); }
+  if (_fields.Contains(VT_TESTARRAYOFTABLES)) { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->testarrayoftables[_i]) _e->Get(_i)->UnPackTo(_o->testarrayoftables[_i].get(), _resolver); else _o->testarrayoftables[_i] = flatbuffers::unique_ptr<MyGame::Example::MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->testarrayoftables.clear(); }
+  if (_fields.Contains(VT_ENEMY)) { auto _e = enemy(); if (_e) { if (_o->enemy) _e->UnPackTo(_o->enemy.get(), _resolver); else _o->enemy = flatbuffers::unique_ptr<MyGame::Example::MonsterT>(_e->UnPack(_resolver)); } else _o->enemy = nullptr; }
+  if (_fields.Contains(VT_TESTNESTEDFLATBUFFER)) { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testnestedflatbuffer.begin()); } else _o->testnestedflatbuffer.clear(); }
+  if (_fields.Contains(VT_TESTEMPTY)) { auto _e = testempty(); if (_e) { if (_o->testempty) _e->UnPackTo(_o->testempty.get(), _resolver); else _o->testempty = flatbuffers::unique_ptr<MyGame::Example::StatT>(_e->UnPack(_resolver)); } else _o->testempty = nullptr; }
+  if (_fields.Contains(VT_TESTBOOL)) { auto _e = testbool(); _o->testbool = _e; }
+  if (_fields.Contains(VT_TESTHASHS32_FNV1)) { auto _e = testhashs32_fnv1(); _o->testhashs32_fnv1 = _e; }
+  if (_fields.Contains(VT_TESTHASHU32_FNV1)) { auto _e = testhashu32_fnv1(); _o->testhashu32_fnv1 = _e; }
+  if (_fields.Contains(VT_TESTHASHS64_FNV1)) { auto _e = testhashs64_fnv1(); _o->testhashs64_fnv1 = _e; }
+  if (_fields.Contains(VT_TESTHASHU64_FNV1)) { auto _e = testhashu64_fnv1(); _o->testhashu64_fnv1 = _e; }
+  if (_fields.Contains(VT_TESTHASHS32_FNV1A)) { auto _e = testhashs32_fnv1a(); _o->testhashs32_fnv1a = _e; }
+  if (_fields.Contains(VT_TESTHASHU32_FNV1A)) { auto _e = testhashu32_fnv1a(); //scalar resolver, naked 
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->testhashu32_fnv1a), static_cast<flatbuffers::hash_value_t>(_e)); else _o->testhashu32_fnv1a = nullptr; }
+  if (_fields.Contains(VT_TESTHASHS64_FNV1A)) { auto _e = testhashs64_fnv1a(); _o->testhashs64_fnv1a = _e; }
+  if (_fields.Contains(VT_TESTHASHU64_FNV1A)) { auto _e = testhashu64_fnv1a(); _o->testhashu64_fnv1a = _e; }
+  if (_fields.Contains(VT_TESTARRAYOFBOOLS)) { auto _e = testarrayofbools(); if (_e) { _o->testarrayofbools.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofbools[_i] = _e->Get(_i) != 0; } } else _o->testarrayofbools.clear(); }
+  if (_fields.Contains(VT_TESTF)) { auto _e = testf(); _o->testf = _e; }
+  if (_fields.Contains(VT_TESTF2)) { auto _e = testf2(); _o->testf2 = _e; }
+  if (_fields.Contains(VT_TESTF3)) { auto _e = testf3(); _o->testf3 = _e; }
+  if (_fields.Contains(VT_TESTARRAYOFSTRING2)) { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else _o->testarrayofstring2.clear(); }
+  if (_fields.Contains(VT_TESTARRAYOFSORTEDSTRUCT)) { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->testarrayofsortedstruct)); } else _o->testarrayofsortedstruct.clear(); }
+  if (_fields.Contains(VT_FLEX)) { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->flex.begin()); } else _o->flex.clear(); }
+  if (_fields.Contains(VT_TEST5)) { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->test5)); } else _o->test5.clear(); }
+  if (_fields.Contains(VT_VECTOR_OF_LONGS)) { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vector_of_longs)); } else _o->vector_of_longs.clear(); }
+  if (_fields.Contains(VT_VECTOR_OF_DOUBLES)) { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vector_of_doubles)); } else _o->vector_of_doubles.clear(); }
+  if (_fields.Contains(VT_PARENT_NAMESPACE_TEST)) { auto _e = parent_namespace_test(); if (_e) { if (_o->parent_namespace_test) _e->UnPackTo(_o->parent_namespace_test.get(), _resolver); else _o->parent_namespace_test = flatbuffers::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); } else _o->parent_namespace_test = nullptr; }
+  if (_fields.Contains(VT_VECTOR_OF_REFERRABLES)) { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_referrables[_i]) _e->Get(_i)->UnPackTo(_o->vector_of_referrables[_i].get(), _resolver); else _o->vector_of_referrables[_i] = flatbuffers::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->vector_of_referrables.clear(); }
+  if (_fields.Contains(VT_SINGLE_WEAK_REFERENCE)) { auto _e = single_weak_reference(); //scalar resolver, naked 
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->single_weak_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->single_weak_reference = nullptr; }
+  if (_fields.Contains(VT_VECTOR_OF_WEAK_REFERENCES)) { auto _e = vector_of_weak_references(); if (_e) { _o->vector_of_weak_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_weak_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_weak_references[_i] = nullptr; } } else _o->vector_of_weak_references.clear(); }
+  if (_fields.Contains(VT_VECTOR_OF_STRONG_REFERRABLES)) { auto _e = vector_of_strong_referrables(); if (_e) { _o->vector_of_strong_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_strong_referrables[_i]) _e->Get(_i)->UnPackTo(_o->vector_of_strong_referrables[_i].get(), _resolver); else _o->vector_of_strong_referrables[_i] = flatbuffers::unique_ptr<MyGame::Example::ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->vector_of_strong_referrables.clear(); }
+  if (_fields.Contains(VT_CO_OWNING_REFERENCE)) { auto _e = co_owning_reference(); //scalar resolver, naked 
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->co_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->co_owning_reference = nullptr; }
+  if (_fields.Contains(VT_VECTOR_OF_CO_OWNING_REFERENCES)) { auto _e = vector_of_co_owning_references(); if (_e) { _o->vector_of_co_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, default_ptr_type
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */; } } else _o->vector_of_co_owning_references.clear(); }
+  if (_fields.Contains(VT_NON_OWNING_REFERENCE)) { auto _e = non_owning_reference(); //scalar resolver, naked 
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->non_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->non_owning_reference = nullptr; }
+  if (_fields.Contains(VT_VECTOR_OF_NON_OWNING_REFERENCES)) { auto _e = vector_of_non_owning_references(); if (_e) { _o->vector_of_non_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } else _o->vector_of_non_owning_references.clear(); }
+  if (_fields.Contains(VT_ANY_UNIQUE)) { auto _e = any_unique(); if (_e) _o->any_unique.UnPackTo(_e, any_unique_type(), _resolver); else _o->any_unique.Reset(); }
+  if (_fields.Contains(VT_ANY_AMBIGUOUS)) { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.UnPackTo(_e, any_ambiguous_type(), _resolver); else _o->any_ambiguous.Reset(); }
+  if (_fields.Contains(VT_VECTOR_OF_ENUMS)) { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vector_of_enums)); } else _o->vector_of_enums.clear(); }
+  if (_fields.Contains(VT_SIGNED_ENUM)) { auto _e = signed_enum(); _o->signed_enum = _e; }
+  if (_fields.Contains(VT_TESTREQUIREDNESTEDFLATBUFFER)) { auto _e = testrequirednestedflatbuffer(); if (_e) { _o->testrequirednestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testrequirednestedflatbuffer.begin()); } else _o->testrequirednestedflatbuffer.clear(); }
+  if (_fields.Contains(VT_SCALAR_KEY_SORTED_TABLES)) { auto _e = scalar_key_sorted_tables(); if (_e) { _o->scalar_key_sorted_tables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->scalar_key_sorted_tables[_i]) _e->Get(_i)->UnPackTo(_o->scalar_key_sorted_tables[_i].get(), _resolver); else _o->scalar_key_sorted_tables[_i] = flatbuffers::unique_ptr<MyGame::Example::StatT>(_e->Get(_i)->UnPack(_resolver)); } } else _o->scalar_key_sorted_tables.clear(); }
 }
 
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -2771,8 +2982,26 @@ inline void TypeAliases::UnPackTo(TypeAliasesT *_o, const flatbuffers::resolver_
   { auto _e = u64(); _o->u64 = _e; }
   { auto _e = f32(); _o->f32 = _e; }
   { auto _e = f64(); _o->f64 = _e; }
-  { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->v8.begin()); } }
-  { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vf64[_i] = _e->Get(_i); } } }
+  { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->v8.begin()); } else _o->v8.clear(); }
+  { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vf64)); } else _o->vf64.clear(); }
+}
+
+inline void TypeAliases::UnPackTo(TypeAliasesT *_o, const flatbuffers::FieldSet &_fields, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_fields;
+  (void)_resolver;
+  if (_fields.Contains(VT_I8)) { auto _e = i8(); _o->i8 = _e; }
+  if (_fields.Contains(VT_U8)) { auto _e = u8(); _o->u8 = _e; }
+  if (_fields.Contains(VT_I16)) { auto _e = i16(); _o->i16 = _e; }
+  if (_fields.Contains(VT_U16)) { auto _e = u16(); _o->u16 = _e; }
+  if (_fields.Contains(VT_I32)) { auto _e = i32(); _o->i32 = _e; }
+  if (_fields.Contains(VT_U32)) { auto _e = u32(); _o->u32 = _e; }
+  if (_fields.Contains(VT_I64)) { auto _e = i64(); _o->i64 = _e; }
+  if (_fields.Contains(VT_U64)) { auto _e = u64(); _o->u64 = _e; }
+  if (_fields.Contains(VT_F32)) { auto _e = f32(); _o->f32 = _e; }
+  if (_fields.Contains(VT_F64)) { auto _e = f64(); _o->f64 = _e; }
+  if (_fields.Contains(VT_V8)) { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->v8.begin()); } else _o->v8.clear(); }
+  if (_fields.Contains(VT_VF64)) { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); flatbuffers::CopyVectorTo(*_e, flatbuffers::data(_o->vf64)); } else _o->vf64.clear(); }
 }
 
 inline flatbuffers::Offset<TypeAliases> TypeAliases::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -2862,6 +3091,35 @@ inline void *AnyUnion::UnPack(const void *obj, Any type, const flatbuffers::reso
   }
 }
 
+inline void AnyUnion::UnPackTo(const void *obj, Any _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case Any_Monster: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case Any_TestSimpleTableWithEnum: {
+        auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::TestSimpleTableWithEnumT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case Any_MyGame_Example2_Monster: {
+        auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example2::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
 inline flatbuffers::Offset<void> AnyUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Any_Monster: {
@@ -2973,6 +3231,35 @@ inline void *AnyUniqueAliasesUnion::UnPack(const void *obj, AnyUniqueAliases typ
   }
 }
 
+inline void AnyUniqueAliasesUnion::UnPackTo(const void *obj, AnyUniqueAliases _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case AnyUniqueAliases_M: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case AnyUniqueAliases_TS: {
+        auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::TestSimpleTableWithEnumT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case AnyUniqueAliases_M2: {
+        auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example2::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
 inline flatbuffers::Offset<void> AnyUniqueAliasesUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case AnyUniqueAliases_M: {
@@ -3084,6 +3371,35 @@ inline void *AnyAmbiguousAliasesUnion::UnPack(const void *obj, AnyAmbiguousAlias
   }
 }
 
+inline void AnyAmbiguousAliasesUnion::UnPackTo(const void *obj, AnyAmbiguousAliases _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case AnyAmbiguousAliases_M1: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case AnyAmbiguousAliases_M2: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case AnyAmbiguousAliases_M3: {
+        auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+        auto dst = reinterpret_cast<MyGame::Example::MonsterT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
 inline flatbuffers::Offset<void> AnyAmbiguousAliasesUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case AnyAmbiguousAliases_M1: {
@@ -3144,6 +3460,2732 @@ inline void AnyAmbiguousAliasesUnion::Reset() {
   type = AnyAmbiguousAliases_NONE;
 }
 
+template<typename Sink> inline bool ToJsonAny(const void *obj, Any type, Sink &sink);
+template<typename Sink> inline bool ToJsonAnyUniqueAliases(const void *obj, AnyUniqueAliases type, Sink &sink);
+template<typename Sink> inline bool ToJsonAnyAmbiguousAliases(const void *obj, AnyAmbiguousAliases type, Sink &sink);
+}  // namespace Example
+
+template<typename Sink> inline bool ToJson(const InParentNamespace *obj, Sink &sink);
+namespace Example2 {
+
+template<typename Sink> inline bool ToJson(const Monster *obj, Sink &sink);
+}  // namespace Example2
+
+namespace Example {
+
+template<typename Sink> inline bool ToJson(const Test *obj, Sink &sink);
+template<typename Sink> inline bool ToJson(const TestSimpleTableWithEnum *obj, Sink &sink);
+template<typename Sink> inline bool ToJson(const Vec3 *obj, Sink &sink);
+template<typename Sink> inline bool ToJson(const Ability *obj, Sink &sink);
+template<typename Sink> inline bool ToJson(const Stat *obj, Sink &sink);
+template<typename Sink> inline bool ToJson(const Referrable *obj, Sink &sink);
+template<typename Sink> inline bool ToJson(const Monster *obj, Sink &sink);
+template<typename Sink> inline bool ToJson(const TypeAliases *obj, Sink &sink);
+
+template<typename Sink> inline bool ToJsonAny(const void *obj, Any type, Sink &sink) {
+  switch (type) {
+    case Any_Monster: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return ToJson(ptr, sink);
+    }
+    case Any_TestSimpleTableWithEnum: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+      return ToJson(ptr, sink);
+    }
+    case Any_MyGame_Example2_Monster: {
+      const auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+      return ToJson(ptr, sink);
+    }
+    default: return false;
+  }
+}
+
+template<typename Sink> inline bool ToJsonAnyUniqueAliases(const void *obj, AnyUniqueAliases type, Sink &sink) {
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return ToJson(ptr, sink);
+    }
+    case AnyUniqueAliases_TS: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+      return ToJson(ptr, sink);
+    }
+    case AnyUniqueAliases_M2: {
+      const auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+      return ToJson(ptr, sink);
+    }
+    default: return false;
+  }
+}
+
+template<typename Sink> inline bool ToJsonAnyAmbiguousAliases(const void *obj, AnyAmbiguousAliases type, Sink &sink) {
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return ToJson(ptr, sink);
+    }
+    case AnyAmbiguousAliases_M2: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return ToJson(ptr, sink);
+    }
+    case AnyAmbiguousAliases_M3: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return ToJson(ptr, sink);
+    }
+    default: return false;
+  }
+}
+
+}  // namespace Example
+
+template<typename Sink> inline bool ToJson(const InParentNamespace *obj, Sink &sink) {
+  char sep = '{';
+  (void)obj;
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+namespace Example2 {
+
+template<typename Sink> inline bool ToJson(const Monster *obj, Sink &sink) {
+  char sep = '{';
+  (void)obj;
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+}  // namespace Example2
+
+namespace Example {
+
+template<typename Sink> inline bool ToJson(const Test *obj, Sink &sink) {
+  char sep = '{';
+  flatbuffers::JsonAppendKey(sink, sep, "\"a\":");
+  flatbuffers::JsonAppendNumber(sink, obj->a());
+  flatbuffers::JsonAppendKey(sink, sep, "\"b\":");
+  flatbuffers::JsonAppendNumber(sink, obj->b());
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+template<typename Sink> inline bool ToJson(const TestSimpleTableWithEnum *obj, Sink &sink) {
+  char sep = '{';
+  flatbuffers::JsonAppendKey(sink, sep, "\"color\":");
+  {
+    const auto e = static_cast<MyGame::Example::Color>(obj->color());
+    flatbuffers::JsonAppendEnum(sink, MyGame::Example::EnumNameColor(e),
+                                static_cast<uint8_t>(e));
+  }
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+template<typename Sink> inline bool ToJson(const Vec3 *obj, Sink &sink) {
+  char sep = '{';
+  flatbuffers::JsonAppendKey(sink, sep, "\"x\":");
+  flatbuffers::JsonAppendNumber(sink, obj->x());
+  flatbuffers::JsonAppendKey(sink, sep, "\"y\":");
+  flatbuffers::JsonAppendNumber(sink, obj->y());
+  flatbuffers::JsonAppendKey(sink, sep, "\"z\":");
+  flatbuffers::JsonAppendNumber(sink, obj->z());
+  flatbuffers::JsonAppendKey(sink, sep, "\"test1\":");
+  flatbuffers::JsonAppendNumber(sink, obj->test1());
+  flatbuffers::JsonAppendKey(sink, sep, "\"test2\":");
+  {
+    const auto e = static_cast<MyGame::Example::Color>(obj->test2());
+    flatbuffers::JsonAppendEnum(sink, MyGame::Example::EnumNameColor(e),
+                                static_cast<uint8_t>(e));
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"test3\":");
+  if (!ToJson(&obj->test3(), sink)) return false;
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+template<typename Sink> inline bool ToJson(const Ability *obj, Sink &sink) {
+  char sep = '{';
+  flatbuffers::JsonAppendKey(sink, sep, "\"id\":");
+  flatbuffers::JsonAppendNumber(sink, obj->id());
+  flatbuffers::JsonAppendKey(sink, sep, "\"distance\":");
+  flatbuffers::JsonAppendNumber(sink, obj->distance());
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+template<typename Sink> inline bool ToJson(const Stat *obj, Sink &sink) {
+  char sep = '{';
+  if (const auto p = obj->id()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"id\":");
+    {
+      const auto s = p;
+      if (!flatbuffers::JsonAppendString(sink, s->c_str(), s->size())) return false;
+    }
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"val\":");
+  flatbuffers::JsonAppendNumber(sink, obj->val());
+  flatbuffers::JsonAppendKey(sink, sep, "\"count\":");
+  flatbuffers::JsonAppendNumber(sink, obj->count());
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+template<typename Sink> inline bool ToJson(const Referrable *obj, Sink &sink) {
+  char sep = '{';
+  flatbuffers::JsonAppendKey(sink, sep, "\"id\":");
+  flatbuffers::JsonAppendNumber(sink, obj->id());
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+template<typename Sink> inline bool ToJson(const Monster *obj, Sink &sink) {
+  char sep = '{';
+  if (const auto p = obj->pos()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"pos\":");
+    if (!ToJson(p, sink)) return false;
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"mana\":");
+  flatbuffers::JsonAppendNumber(sink, obj->mana());
+  flatbuffers::JsonAppendKey(sink, sep, "\"hp\":");
+  flatbuffers::JsonAppendNumber(sink, obj->hp());
+  if (const auto p = obj->name()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"name\":");
+    {
+      const auto s = p;
+      if (!flatbuffers::JsonAppendString(sink, s->c_str(), s->size())) return false;
+    }
+  }
+  if (const auto v = obj->inventory()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"inventory\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      flatbuffers::JsonAppendNumber(sink, v->Get(i));
+    }
+    sink.append("]", 1);
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"color\":");
+  {
+    const auto e = static_cast<MyGame::Example::Color>(obj->color());
+    flatbuffers::JsonAppendEnum(sink, MyGame::Example::EnumNameColor(e),
+                                static_cast<uint8_t>(e));
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"test_type\":");
+  {
+    const auto e = static_cast<MyGame::Example::Any>(obj->test_type());
+    flatbuffers::JsonAppendEnum(sink, MyGame::Example::EnumNameAny(e),
+                                static_cast<uint8_t>(e));
+  }
+  if (const auto u = obj->test()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"test\":");
+    if (!MyGame::Example::ToJsonAny(u, obj->test_type(), sink)) return false;
+  }
+  if (const auto v = obj->test4()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"test4\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      if (!ToJson(v->Get(i), sink)) return false;
+    }
+    sink.append("]", 1);
+  }
+  if (const auto v = obj->testarrayofstring()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"testarrayofstring\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      {
+        const auto s = v->Get(i);
+        if (!flatbuffers::JsonAppendString(sink, s->c_str(), s->size())) return false;
+      }
+    }
+    sink.append("]", 1);
+  }
+  if (const auto v = obj->testarrayoftables()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"testarrayoftables\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      if (!ToJson(v->Get(i), sink)) return false;
+    }
+    sink.append("]", 1);
+  }
+  if (const auto p = obj->enemy()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"enemy\":");
+    if (!ToJson(p, sink)) return false;
+  }
+  if (obj->testnestedflatbuffer()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"testnestedflatbuffer\":");
+    if (!ToJson(obj->testnestedflatbuffer_nested_root(), sink)) return false;
+  }
+  if (const auto p = obj->testempty()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"testempty\":");
+    if (!ToJson(p, sink)) return false;
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"testbool\":");
+  flatbuffers::JsonAppendBool(sink, obj->testbool());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testhashs32_fnv1\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testhashs32_fnv1());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testhashu32_fnv1\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testhashu32_fnv1());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testhashs64_fnv1\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testhashs64_fnv1());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testhashu64_fnv1\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testhashu64_fnv1());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testhashs32_fnv1a\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testhashs32_fnv1a());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testhashu32_fnv1a\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testhashu32_fnv1a());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testhashs64_fnv1a\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testhashs64_fnv1a());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testhashu64_fnv1a\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testhashu64_fnv1a());
+  if (const auto v = obj->testarrayofbools()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"testarrayofbools\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      flatbuffers::JsonAppendBool(sink, v->Get(i));
+    }
+    sink.append("]", 1);
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"testf\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testf());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testf2\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testf2());
+  flatbuffers::JsonAppendKey(sink, sep, "\"testf3\":");
+  flatbuffers::JsonAppendNumber(sink, obj->testf3());
+  if (const auto v = obj->testarrayofstring2()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"testarrayofstring2\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      {
+        const auto s = v->Get(i);
+        if (!flatbuffers::JsonAppendString(sink, s->c_str(), s->size())) return false;
+      }
+    }
+    sink.append("]", 1);
+  }
+  if (const auto v = obj->testarrayofsortedstruct()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"testarrayofsortedstruct\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      if (!ToJson(v->Get(i), sink)) return false;
+    }
+    sink.append("]", 1);
+  }
+  if (obj->flex()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"flex\":");
+    std::string flex;
+    obj->flex_flexbuffer_root().ToString(true, true, flex);
+    sink.append(flex.c_str(), flex.size());
+  }
+  if (const auto v = obj->test5()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"test5\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      if (!ToJson(v->Get(i), sink)) return false;
+    }
+    sink.append("]", 1);
+  }
+  if (const auto v = obj->vector_of_longs()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"vector_of_longs\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      flatbuffers::JsonAppendNumber(sink, v->Get(i));
+    }
+    sink.append("]", 1);
+  }
+  if (const auto v = obj->vector_of_doubles()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"vector_of_doubles\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      flatbuffers::JsonAppendNumber(sink, v->Get(i));
+    }
+    sink.append("]", 1);
+  }
+  if (const auto p = obj->parent_namespace_test()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"parent_namespace_test\":");
+    if (!ToJson(p, sink)) return false;
+  }
+  if (const auto v = obj->vector_of_referrables()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"vector_of_referrables\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      if (!ToJson(v->Get(i), sink)) return false;
+    }
+    sink.append("]", 1);
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"single_weak_reference\":");
+  flatbuffers::JsonAppendNumber(sink, obj->single_weak_reference());
+  if (const auto v = obj->vector_of_weak_references()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"vector_of_weak_references\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      flatbuffers::JsonAppendNumber(sink, v->Get(i));
+    }
+    sink.append("]", 1);
+  }
+  if (const auto v = obj->vector_of_strong_referrables()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"vector_of_strong_referrables\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      if (!ToJson(v->Get(i), sink)) return false;
+    }
+    sink.append("]", 1);
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"co_owning_reference\":");
+  flatbuffers::JsonAppendNumber(sink, obj->co_owning_reference());
+  if (const auto v = obj->vector_of_co_owning_references()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"vector_of_co_owning_references\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      flatbuffers::JsonAppendNumber(sink, v->Get(i));
+    }
+    sink.append("]", 1);
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"non_owning_reference\":");
+  flatbuffers::JsonAppendNumber(sink, obj->non_owning_reference());
+  if (const auto v = obj->vector_of_non_owning_references()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"vector_of_non_owning_references\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      flatbuffers::JsonAppendNumber(sink, v->Get(i));
+    }
+    sink.append("]", 1);
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"any_unique_type\":");
+  {
+    const auto e = static_cast<MyGame::Example::AnyUniqueAliases>(obj->any_unique_type());
+    flatbuffers::JsonAppendEnum(sink, MyGame::Example::EnumNameAnyUniqueAliases(e),
+                                static_cast<uint8_t>(e));
+  }
+  if (const auto u = obj->any_unique()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"any_unique\":");
+    if (!MyGame::Example::ToJsonAnyUniqueAliases(u, obj->any_unique_type(), sink)) return false;
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"any_ambiguous_type\":");
+  {
+    const auto e = static_cast<MyGame::Example::AnyAmbiguousAliases>(obj->any_ambiguous_type());
+    flatbuffers::JsonAppendEnum(sink, MyGame::Example::EnumNameAnyAmbiguousAliases(e),
+                                static_cast<uint8_t>(e));
+  }
+  if (const auto u = obj->any_ambiguous()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"any_ambiguous\":");
+    if (!MyGame::Example::ToJsonAnyAmbiguousAliases(u, obj->any_ambiguous_type(), sink)) return false;
+  }
+  if (const auto v = obj->vector_of_enums()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"vector_of_enums\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      {
+        const auto e = static_cast<MyGame::Example::Color>(v->Get(i));
+        flatbuffers::JsonAppendEnum(sink, MyGame::Example::EnumNameColor(e),
+                                    static_cast<uint8_t>(e));
+      }
+    }
+    sink.append("]", 1);
+  }
+  flatbuffers::JsonAppendKey(sink, sep, "\"signed_enum\":");
+  {
+    const auto e = static_cast<MyGame::Example::Race>(obj->signed_enum());
+    flatbuffers::JsonAppendEnum(sink, MyGame::Example::EnumNameRace(e),
+                                static_cast<int8_t>(e));
+  }
+  if (obj->testrequirednestedflatbuffer()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"testrequirednestedflatbuffer\":");
+    if (!ToJson(obj->testrequirednestedflatbuffer_nested_root(), sink)) return false;
+  }
+  if (const auto v = obj->scalar_key_sorted_tables()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"scalar_key_sorted_tables\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      if (!ToJson(v->Get(i), sink)) return false;
+    }
+    sink.append("]", 1);
+  }
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+template<typename Sink> inline bool ToJson(const TypeAliases *obj, Sink &sink) {
+  char sep = '{';
+  flatbuffers::JsonAppendKey(sink, sep, "\"i8\":");
+  flatbuffers::JsonAppendNumber(sink, obj->i8());
+  flatbuffers::JsonAppendKey(sink, sep, "\"u8\":");
+  flatbuffers::JsonAppendNumber(sink, obj->u8());
+  flatbuffers::JsonAppendKey(sink, sep, "\"i16\":");
+  flatbuffers::JsonAppendNumber(sink, obj->i16());
+  flatbuffers::JsonAppendKey(sink, sep, "\"u16\":");
+  flatbuffers::JsonAppendNumber(sink, obj->u16());
+  flatbuffers::JsonAppendKey(sink, sep, "\"i32\":");
+  flatbuffers::JsonAppendNumber(sink, obj->i32());
+  flatbuffers::JsonAppendKey(sink, sep, "\"u32\":");
+  flatbuffers::JsonAppendNumber(sink, obj->u32());
+  flatbuffers::JsonAppendKey(sink, sep, "\"i64\":");
+  flatbuffers::JsonAppendNumber(sink, obj->i64());
+  flatbuffers::JsonAppendKey(sink, sep, "\"u64\":");
+  flatbuffers::JsonAppendNumber(sink, obj->u64());
+  flatbuffers::JsonAppendKey(sink, sep, "\"f32\":");
+  flatbuffers::JsonAppendNumber(sink, obj->f32());
+  flatbuffers::JsonAppendKey(sink, sep, "\"f64\":");
+  flatbuffers::JsonAppendNumber(sink, obj->f64());
+  if (const auto v = obj->v8()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"v8\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      flatbuffers::JsonAppendNumber(sink, v->Get(i));
+    }
+    sink.append("]", 1);
+  }
+  if (const auto v = obj->vf64()) {
+    flatbuffers::JsonAppendKey(sink, sep, "\"vf64\":");
+    sink.append("[", 1);
+    for (flatbuffers::uoffset_t i = 0; i < v->size(); i++) {
+      if (i) sink.append(",", 1);
+      flatbuffers::JsonAppendNumber(sink, v->Get(i));
+    }
+    sink.append("]", 1);
+  }
+  if (sep == '{') sink.append("{", 1);
+  sink.append("}", 1);
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Color *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, Race *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, Any *_val);
+inline bool FromJsonAny(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, Any _type, flatbuffers::Offset<void> *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, AnyUniqueAliases *_val);
+inline bool FromJsonAnyUniqueAliases(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, AnyUniqueAliases _type, flatbuffers::Offset<void> *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, AnyAmbiguousAliases *_val);
+inline bool FromJsonAnyAmbiguousAliases(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, AnyAmbiguousAliases _type, flatbuffers::Offset<void> *_val);
+}  // namespace Example
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<InParentNamespace> *_val);
+namespace Example2 {
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_val);
+}  // namespace Example2
+
+namespace Example {
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Test *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TestSimpleTableWithEnum> *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, Vec3 *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, Ability *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Stat> *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Referrable> *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_val);
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TypeAliases> *_val);
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Color *_val) {
+  uint8_t _bits = 0;
+  if (!_reader.IsNextName()) {
+    if (!_reader.ParseScalar(&_bits)) return false;
+    *_val = static_cast<Color>(_bits);
+    return true;
+  }
+  const char *_str;
+  const char *_word;
+  size_t _len;
+  if (!_reader.ParseName(&_str, &_len)) return false;
+  const char *const _end = _str + _len;
+  while (flatbuffers::JsonReader::NextWord(&_str, _end, &_word, &_len)) {
+    switch (_len) {
+      case 3:
+        if (!memcmp(_word, "Red", 3)) {
+          _bits |= static_cast<uint8_t>(Color_Red);
+          continue;
+        }
+        break;
+      case 4:
+        if (!memcmp(_word, "Blue", 4)) {
+          _bits |= static_cast<uint8_t>(Color_Blue);
+          continue;
+        }
+        break;
+      case 5:
+        if (!memcmp(_word, "Green", 5)) {
+          _bits |= static_cast<uint8_t>(Color_Green);
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown enum value");
+  }
+  *_val = static_cast<Color>(_bits);
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Race *_val) {
+  int8_t _bits = 0;
+  if (!_reader.IsNextName()) {
+    if (!_reader.ParseScalar(&_bits)) return false;
+    *_val = static_cast<Race>(_bits);
+    return true;
+  }
+  const char *_str;
+  const char *_word;
+  size_t _len;
+  if (!_reader.ParseName(&_str, &_len)) return false;
+  const char *const _end = _str + _len;
+  while (flatbuffers::JsonReader::NextWord(&_str, _end, &_word, &_len)) {
+    switch (_len) {
+      case 3:
+        if (!memcmp(_word, "Elf", 3)) {
+          _bits |= static_cast<int8_t>(Race_Elf);
+          continue;
+        }
+        break;
+      case 4:
+        if (!memcmp(_word, "None", 4)) {
+          _bits |= static_cast<int8_t>(Race_None);
+          continue;
+        }
+        break;
+      case 5:
+        if (!memcmp(_word, "Human", 5)) {
+          _bits |= static_cast<int8_t>(Race_Human);
+          continue;
+        }
+        if (!memcmp(_word, "Dwarf", 5)) {
+          _bits |= static_cast<int8_t>(Race_Dwarf);
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown enum value");
+  }
+  *_val = static_cast<Race>(_bits);
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Any *_val) {
+  uint8_t _bits = 0;
+  if (!_reader.IsNextName()) {
+    if (!_reader.ParseScalar(&_bits)) return false;
+    *_val = static_cast<Any>(_bits);
+    return true;
+  }
+  const char *_str;
+  const char *_word;
+  size_t _len;
+  if (!_reader.ParseName(&_str, &_len)) return false;
+  const char *const _end = _str + _len;
+  while (flatbuffers::JsonReader::NextWord(&_str, _end, &_word, &_len)) {
+    switch (_len) {
+      case 4:
+        if (!memcmp(_word, "NONE", 4)) {
+          _bits |= static_cast<uint8_t>(Any_NONE);
+          continue;
+        }
+        break;
+      case 7:
+        if (!memcmp(_word, "Monster", 7)) {
+          _bits |= static_cast<uint8_t>(Any_Monster);
+          continue;
+        }
+        break;
+      case 23:
+        if (!memcmp(_word, "TestSimpleTableWithEnum", 23)) {
+          _bits |= static_cast<uint8_t>(Any_TestSimpleTableWithEnum);
+          continue;
+        }
+        if (!memcmp(_word, "MyGame_Example2_Monster", 23)) {
+          _bits |= static_cast<uint8_t>(Any_MyGame_Example2_Monster);
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown enum value");
+  }
+  *_val = static_cast<Any>(_bits);
+  return true;
+}
+
+inline bool FromJsonAny(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, Any _type, flatbuffers::Offset<void> *_val) {
+  switch (_type) {
+    case Any_Monster: {
+      flatbuffers::Offset<MyGame::Example::Monster> _obj;
+      if (!FromJson(_reader, _fbb, &_obj)) return false;
+      *_val = _obj.Union();
+      return true;
+    }
+    case Any_TestSimpleTableWithEnum: {
+      flatbuffers::Offset<MyGame::Example::TestSimpleTableWithEnum> _obj;
+      if (!FromJson(_reader, _fbb, &_obj)) return false;
+      *_val = _obj.Union();
+      return true;
+    }
+    case Any_MyGame_Example2_Monster: {
+      flatbuffers::Offset<MyGame::Example2::Monster> _obj;
+      if (!FromJson(_reader, _fbb, &_obj)) return false;
+      *_val = _obj.Union();
+      return true;
+    }
+    default: return _reader.Fail("missing or unknown union type");
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, AnyUniqueAliases *_val) {
+  uint8_t _bits = 0;
+  if (!_reader.IsNextName()) {
+    if (!_reader.ParseScalar(&_bits)) return false;
+    *_val = static_cast<AnyUniqueAliases>(_bits);
+    return true;
+  }
+  const char *_str;
+  const char *_word;
+  size_t _len;
+  if (!_reader.ParseName(&_str, &_len)) return false;
+  const char *const _end = _str + _len;
+  while (flatbuffers::JsonReader::NextWord(&_str, _end, &_word, &_len)) {
+    switch (_len) {
+      case 1:
+        if (!memcmp(_word, "M", 1)) {
+          _bits |= static_cast<uint8_t>(AnyUniqueAliases_M);
+          continue;
+        }
+        break;
+      case 2:
+        if (!memcmp(_word, "TS", 2)) {
+          _bits |= static_cast<uint8_t>(AnyUniqueAliases_TS);
+          continue;
+        }
+        if (!memcmp(_word, "M2", 2)) {
+          _bits |= static_cast<uint8_t>(AnyUniqueAliases_M2);
+          continue;
+        }
+        break;
+      case 4:
+        if (!memcmp(_word, "NONE", 4)) {
+          _bits |= static_cast<uint8_t>(AnyUniqueAliases_NONE);
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown enum value");
+  }
+  *_val = static_cast<AnyUniqueAliases>(_bits);
+  return true;
+}
+
+inline bool FromJsonAnyUniqueAliases(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, AnyUniqueAliases _type, flatbuffers::Offset<void> *_val) {
+  switch (_type) {
+    case AnyUniqueAliases_M: {
+      flatbuffers::Offset<MyGame::Example::Monster> _obj;
+      if (!FromJson(_reader, _fbb, &_obj)) return false;
+      *_val = _obj.Union();
+      return true;
+    }
+    case AnyUniqueAliases_TS: {
+      flatbuffers::Offset<MyGame::Example::TestSimpleTableWithEnum> _obj;
+      if (!FromJson(_reader, _fbb, &_obj)) return false;
+      *_val = _obj.Union();
+      return true;
+    }
+    case AnyUniqueAliases_M2: {
+      flatbuffers::Offset<MyGame::Example2::Monster> _obj;
+      if (!FromJson(_reader, _fbb, &_obj)) return false;
+      *_val = _obj.Union();
+      return true;
+    }
+    default: return _reader.Fail("missing or unknown union type");
+  }
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, AnyAmbiguousAliases *_val) {
+  uint8_t _bits = 0;
+  if (!_reader.IsNextName()) {
+    if (!_reader.ParseScalar(&_bits)) return false;
+    *_val = static_cast<AnyAmbiguousAliases>(_bits);
+    return true;
+  }
+  const char *_str;
+  const char *_word;
+  size_t _len;
+  if (!_reader.ParseName(&_str, &_len)) return false;
+  const char *const _end = _str + _len;
+  while (flatbuffers::JsonReader::NextWord(&_str, _end, &_word, &_len)) {
+    switch (_len) {
+      case 2:
+        if (!memcmp(_word, "M1", 2)) {
+          _bits |= static_cast<uint8_t>(AnyAmbiguousAliases_M1);
+          continue;
+        }
+        if (!memcmp(_word, "M2", 2)) {
+          _bits |= static_cast<uint8_t>(AnyAmbiguousAliases_M2);
+          continue;
+        }
+        if (!memcmp(_word, "M3", 2)) {
+          _bits |= static_cast<uint8_t>(AnyAmbiguousAliases_M3);
+          continue;
+        }
+        break;
+      case 4:
+        if (!memcmp(_word, "NONE", 4)) {
+          _bits |= static_cast<uint8_t>(AnyAmbiguousAliases_NONE);
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown enum value");
+  }
+  *_val = static_cast<AnyAmbiguousAliases>(_bits);
+  return true;
+}
+
+inline bool FromJsonAnyAmbiguousAliases(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, AnyAmbiguousAliases _type, flatbuffers::Offset<void> *_val) {
+  switch (_type) {
+    case AnyAmbiguousAliases_M1: {
+      flatbuffers::Offset<MyGame::Example::Monster> _obj;
+      if (!FromJson(_reader, _fbb, &_obj)) return false;
+      *_val = _obj.Union();
+      return true;
+    }
+    case AnyAmbiguousAliases_M2: {
+      flatbuffers::Offset<MyGame::Example::Monster> _obj;
+      if (!FromJson(_reader, _fbb, &_obj)) return false;
+      *_val = _obj.Union();
+      return true;
+    }
+    case AnyAmbiguousAliases_M3: {
+      flatbuffers::Offset<MyGame::Example::Monster> _obj;
+      if (!FromJson(_reader, _fbb, &_obj)) return false;
+      *_val = _obj.Union();
+      return true;
+    }
+    default: return _reader.Fail("missing or unknown union type");
+  }
+}
+
+}  // namespace Example
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<InParentNamespace> *_val) {
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  *_val = CreateInParentNamespace(_fbb);
+  return true;
+}
+
+inline bool FromJson(const char *_json, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<InParentNamespace> *_val, std::string *_error = nullptr) {
+  flatbuffers::JsonReader _reader(_json);
+  if (FromJson(_reader, _fbb, _val) && _reader.End()) return true;
+  if (_error) *_error = _reader.error();
+  return false;
+}
+
+namespace Example2 {
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_val) {
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  *_val = CreateMonster(_fbb);
+  return true;
+}
+
+inline bool FromJson(const char *_json, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_val, std::string *_error = nullptr) {
+  flatbuffers::JsonReader _reader(_json);
+  if (FromJson(_reader, _fbb, _val) && _reader.End()) return true;
+  if (_error) *_error = _reader.error();
+  return false;
+}
+
+}  // namespace Example2
+
+namespace Example {
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Test *_val) {
+  uint8_t *const _base = reinterpret_cast<uint8_t *>(_val);
+  bool _seen[2] = {};
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  *_val = Test();
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      case 1:
+        if (!memcmp(_key, "a", 1)) {
+          if (_seen[0]) return _reader.Fail("field set more than once");
+          _seen[0] = true;
+          int16_t _v = int16_t();
+          if (!_reader.ParseScalar(&_v)) return false;
+          flatbuffers::WriteScalar(_base + 0, static_cast<int16_t>(_v));
+          continue;
+        }
+        if (!memcmp(_key, "b", 1)) {
+          if (_seen[1]) return _reader.Fail("field set more than once");
+          _seen[1] = true;
+          int8_t _v = int8_t();
+          if (!_reader.ParseScalar(&_v)) return false;
+          flatbuffers::WriteScalar(_base + 2, static_cast<int8_t>(_v));
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  for (size_t _i = 0; _i < 2; _i++) {
+    if (!_seen[_i]) return _reader.Fail("wrong number of fields in struct");
+  }
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TestSimpleTableWithEnum> *_val) {
+  MyGame::Example::Color color = MyGame::Example::Color_Green;
+  bool _seen[1] = {};
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      case 5:
+        if (!memcmp(_key, "color", 5)) {
+          if (_seen[0]) return _reader.Fail("field set more than once");
+          _seen[0] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!FromJson(_reader, &color)) return false;
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  *_val = CreateTestSimpleTableWithEnum(_fbb, color);
+  return true;
+}
+
+inline bool FromJson(const char *_json, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TestSimpleTableWithEnum> *_val, std::string *_error = nullptr) {
+  flatbuffers::JsonReader _reader(_json);
+  if (FromJson(_reader, _fbb, _val) && _reader.End()) return true;
+  if (_error) *_error = _reader.error();
+  return false;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Vec3 *_val) {
+  uint8_t *const _base = reinterpret_cast<uint8_t *>(_val);
+  bool _seen[6] = {};
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  *_val = Vec3();
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      case 1:
+        if (!memcmp(_key, "x", 1)) {
+          if (_seen[0]) return _reader.Fail("field set more than once");
+          _seen[0] = true;
+          float _v = float();
+          if (!_reader.ParseScalar(&_v)) return false;
+          flatbuffers::WriteScalar(_base + 0, static_cast<float>(_v));
+          continue;
+        }
+        if (!memcmp(_key, "y", 1)) {
+          if (_seen[1]) return _reader.Fail("field set more than once");
+          _seen[1] = true;
+          float _v = float();
+          if (!_reader.ParseScalar(&_v)) return false;
+          flatbuffers::WriteScalar(_base + 4, static_cast<float>(_v));
+          continue;
+        }
+        if (!memcmp(_key, "z", 1)) {
+          if (_seen[2]) return _reader.Fail("field set more than once");
+          _seen[2] = true;
+          float _v = float();
+          if (!_reader.ParseScalar(&_v)) return false;
+          flatbuffers::WriteScalar(_base + 8, static_cast<float>(_v));
+          continue;
+        }
+        break;
+      case 5:
+        if (!memcmp(_key, "test1", 5)) {
+          if (_seen[3]) return _reader.Fail("field set more than once");
+          _seen[3] = true;
+          double _v = double();
+          if (!_reader.ParseScalar(&_v)) return false;
+          flatbuffers::WriteScalar(_base + 16, static_cast<double>(_v));
+          continue;
+        }
+        if (!memcmp(_key, "test2", 5)) {
+          if (_seen[4]) return _reader.Fail("field set more than once");
+          _seen[4] = true;
+          MyGame::Example::Color _v = MyGame::Example::Color();
+          if (!FromJson(_reader, &_v)) return false;
+          flatbuffers::WriteScalar(_base + 24, static_cast<uint8_t>(_v));
+          continue;
+        }
+        if (!memcmp(_key, "test3", 5)) {
+          if (_seen[5]) return _reader.Fail("field set more than once");
+          _seen[5] = true;
+          if (!FromJson(_reader, reinterpret_cast<MyGame::Example::Test *>(_base + 26))) return false;
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  for (size_t _i = 0; _i < 6; _i++) {
+    if (!_seen[_i]) return _reader.Fail("wrong number of fields in struct");
+  }
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, Ability *_val) {
+  uint8_t *const _base = reinterpret_cast<uint8_t *>(_val);
+  bool _seen[2] = {};
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  *_val = Ability();
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      case 2:
+        if (!memcmp(_key, "id", 2)) {
+          if (_seen[0]) return _reader.Fail("field set more than once");
+          _seen[0] = true;
+          uint32_t _v = uint32_t();
+          if (!_reader.ParseScalar(&_v)) return false;
+          flatbuffers::WriteScalar(_base + 0, static_cast<uint32_t>(_v));
+          continue;
+        }
+        break;
+      case 8:
+        if (!memcmp(_key, "distance", 8)) {
+          if (_seen[1]) return _reader.Fail("field set more than once");
+          _seen[1] = true;
+          uint32_t _v = uint32_t();
+          if (!_reader.ParseScalar(&_v)) return false;
+          flatbuffers::WriteScalar(_base + 4, static_cast<uint32_t>(_v));
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  for (size_t _i = 0; _i < 2; _i++) {
+    if (!_seen[_i]) return _reader.Fail("wrong number of fields in struct");
+  }
+  return true;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Stat> *_val) {
+  flatbuffers::Offset<flatbuffers::String> id = 0;
+  int64_t val = 0;
+  uint16_t count = 0;
+  bool _seen[3] = {};
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      case 2:
+        if (!memcmp(_key, "id", 2)) {
+          if (_seen[0]) return _reader.Fail("field set more than once");
+          _seen[0] = true;
+          if (_reader.AcceptNull()) continue;
+          const char *_str;
+          size_t _len;
+          if (!_reader.ParseString(&_str, &_len)) return false;
+          id = _fbb.CreateString(_str, _len);
+          continue;
+        }
+        break;
+      case 3:
+        if (!memcmp(_key, "val", 3)) {
+          if (_seen[1]) return _reader.Fail("field set more than once");
+          _seen[1] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&val)) return false;
+          continue;
+        }
+        break;
+      case 5:
+        if (!memcmp(_key, "count", 5)) {
+          if (_seen[2]) return _reader.Fail("field set more than once");
+          _seen[2] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&count)) return false;
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  *_val = CreateStat(_fbb, id, val, count);
+  return true;
+}
+
+inline bool FromJson(const char *_json, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Stat> *_val, std::string *_error = nullptr) {
+  flatbuffers::JsonReader _reader(_json);
+  if (FromJson(_reader, _fbb, _val) && _reader.End()) return true;
+  if (_error) *_error = _reader.error();
+  return false;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Referrable> *_val) {
+  uint64_t id = 0;
+  bool _seen[1] = {};
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      case 2:
+        if (!memcmp(_key, "id", 2)) {
+          if (_seen[0]) return _reader.Fail("field set more than once");
+          _seen[0] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            id = static_cast<uint64_t>(flatbuffers::HashFnv1a<uint64_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&id)) {
+            return false;
+          }
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  *_val = CreateReferrable(_fbb, id);
+  return true;
+}
+
+inline bool FromJson(const char *_json, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Referrable> *_val, std::string *_error = nullptr) {
+  flatbuffers::JsonReader _reader(_json);
+  if (FromJson(_reader, _fbb, _val) && _reader.End()) return true;
+  if (_error) *_error = _reader.error();
+  return false;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_val) {
+  const MyGame::Example::Vec3 *pos = 0;
+  MyGame::Example::Vec3 pos_;
+  int16_t mana = 150;
+  int16_t hp = 100;
+  flatbuffers::Offset<flatbuffers::String> name = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> inventory = 0;
+  MyGame::Example::Color color = MyGame::Example::Color_Blue;
+  MyGame::Example::Any test_type = MyGame::Example::Any_NONE;
+  flatbuffers::Offset<void> test = 0;
+  const char *test_json_ = nullptr;
+  flatbuffers::Offset<flatbuffers::Vector<const MyGame::Example::Test *>> test4 = 0;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> testarrayofstring = 0;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<MyGame::Example::Monster>>> testarrayoftables = 0;
+  flatbuffers::Offset<MyGame::Example::Monster> enemy = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testnestedflatbuffer = 0;
+  flatbuffers::Offset<MyGame::Example::Stat> testempty = 0;
+  bool testbool = false;
+  int32_t testhashs32_fnv1 = 0;
+  uint32_t testhashu32_fnv1 = 0;
+  int64_t testhashs64_fnv1 = 0;
+  uint64_t testhashu64_fnv1 = 0;
+  int32_t testhashs32_fnv1a = 0;
+  uint32_t testhashu32_fnv1a = 0;
+  int64_t testhashs64_fnv1a = 0;
+  uint64_t testhashu64_fnv1a = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testarrayofbools = 0;
+  float testf = 3.14159f;
+  float testf2 = 3.0f;
+  float testf3 = 0.0f;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> testarrayofstring2 = 0;
+  flatbuffers::Offset<flatbuffers::Vector<const MyGame::Example::Ability *>> testarrayofsortedstruct = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flex = 0;
+  flatbuffers::Offset<flatbuffers::Vector<const MyGame::Example::Test *>> test5 = 0;
+  flatbuffers::Offset<flatbuffers::Vector<int64_t>> vector_of_longs = 0;
+  flatbuffers::Offset<flatbuffers::Vector<double>> vector_of_doubles = 0;
+  flatbuffers::Offset<MyGame::InParentNamespace> parent_namespace_test = 0;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<MyGame::Example::Referrable>>> vector_of_referrables = 0;
+  uint64_t single_weak_reference = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint64_t>> vector_of_weak_references = 0;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<MyGame::Example::Referrable>>> vector_of_strong_referrables = 0;
+  uint64_t co_owning_reference = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint64_t>> vector_of_co_owning_references = 0;
+  uint64_t non_owning_reference = 0;
+  flatbuffers::Offset<flatbuffers::Vector<uint64_t>> vector_of_non_owning_references = 0;
+  MyGame::Example::AnyUniqueAliases any_unique_type = MyGame::Example::AnyUniqueAliases_NONE;
+  flatbuffers::Offset<void> any_unique = 0;
+  const char *any_unique_json_ = nullptr;
+  MyGame::Example::AnyAmbiguousAliases any_ambiguous_type = MyGame::Example::AnyAmbiguousAliases_NONE;
+  flatbuffers::Offset<void> any_ambiguous = 0;
+  const char *any_ambiguous_json_ = nullptr;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> vector_of_enums = 0;
+  MyGame::Example::Race signed_enum = MyGame::Example::Race_None;
+  flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testrequirednestedflatbuffer = 0;
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<MyGame::Example::Stat>>> scalar_key_sorted_tables = 0;
+  bool _seen[51] = {};
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      case 2:
+        if (!memcmp(_key, "hp", 2)) {
+          if (_seen[2]) return _reader.Fail("field set more than once");
+          _seen[2] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&hp)) return false;
+          continue;
+        }
+        break;
+      case 3:
+        if (!memcmp(_key, "pos", 3)) {
+          if (_seen[0]) return _reader.Fail("field set more than once");
+          _seen[0] = true;
+          if (_reader.AcceptNull()) continue;
+          if (!FromJson(_reader, &pos_)) return false;
+          pos = &pos_;
+          continue;
+        }
+        break;
+      case 4:
+        if (!memcmp(_key, "mana", 4)) {
+          if (_seen[1]) return _reader.Fail("field set more than once");
+          _seen[1] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&mana)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "name", 4)) {
+          if (_seen[3]) return _reader.Fail("field set more than once");
+          _seen[3] = true;
+          if (_reader.AcceptNull()) continue;
+          const char *_str;
+          size_t _len;
+          if (!_reader.ParseString(&_str, &_len)) return false;
+          name = _fbb.CreateString(_str, _len);
+          continue;
+        }
+        if (!memcmp(_key, "test", 4)) {
+          if (_seen[8]) return _reader.Fail("field set more than once");
+          _seen[8] = true;
+          if (_reader.AcceptNull()) continue;
+          if (test_type == MyGame::Example::Any_NONE) {
+            test_json_ = _reader.position();
+            if (!_reader.Skip()) return false;
+            continue;
+          }
+          if (!MyGame::Example::FromJsonAny(_reader, _fbb, test_type, &test)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "flex", 4)) {
+          if (_seen[30]) return _reader.Fail("field set more than once");
+          _seen[30] = true;
+          if (_reader.AcceptNull()) continue;
+          flexbuffers::Builder _flex(1024, flexbuffers::BUILDER_FLAG_SHARE_ALL);
+          if (!_reader.ParseFlexBufferValue(&_flex)) return false;
+          _flex.Finish();
+          _fbb.ForceVectorAlignment(_flex.GetSize(), sizeof(uint8_t), sizeof(flatbuffers::largest_scalar_t));
+          flex = _fbb.CreateVector(_flex.GetBuffer());
+          continue;
+        }
+        break;
+      case 5:
+        if (!memcmp(_key, "color", 5)) {
+          if (_seen[6]) return _reader.Fail("field set more than once");
+          _seen[6] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!FromJson(_reader, &color)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "test4", 5)) {
+          if (_seen[9]) return _reader.Fail("field set more than once");
+          _seen[9] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<MyGame::Example::Test> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              _elems.push_back(MyGame::Example::Test());
+              if (!FromJson(_reader, &_elems.back())) return false;
+            }
+            if (!_reader.ok()) return false;
+            test4 = _fbb.CreateVectorOfStructs(_elems);
+          }
+          continue;
+        }
+        if (!memcmp(_key, "enemy", 5)) {
+          if (_seen[12]) return _reader.Fail("field set more than once");
+          _seen[12] = true;
+          if (_reader.AcceptNull()) continue;
+          if (!FromJson(_reader, _fbb, &enemy)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "testf", 5)) {
+          if (_seen[25]) return _reader.Fail("field set more than once");
+          _seen[25] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&testf)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "test5", 5)) {
+          if (_seen[31]) return _reader.Fail("field set more than once");
+          _seen[31] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<MyGame::Example::Test> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              _elems.push_back(MyGame::Example::Test());
+              if (!FromJson(_reader, &_elems.back())) return false;
+            }
+            if (!_reader.ok()) return false;
+            test5 = _fbb.CreateVectorOfStructs(_elems);
+          }
+          continue;
+        }
+        break;
+      case 6:
+        if (!memcmp(_key, "testf2", 6)) {
+          if (_seen[26]) return _reader.Fail("field set more than once");
+          _seen[26] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&testf2)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "testf3", 6)) {
+          if (_seen[27]) return _reader.Fail("field set more than once");
+          _seen[27] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&testf3)) return false;
+          continue;
+        }
+        break;
+      case 8:
+        if (!memcmp(_key, "friendly", 8)) {
+          if (_seen[4]) return _reader.Fail("field set more than once");
+          _seen[4] = true;
+          if (!_reader.Skip()) return false;
+          continue;
+        }
+        if (!memcmp(_key, "testbool", 8)) {
+          if (_seen[15]) return _reader.Fail("field set more than once");
+          _seen[15] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&testbool)) return false;
+          continue;
+        }
+        break;
+      case 9:
+        if (!memcmp(_key, "inventory", 9)) {
+          if (_seen[5]) return _reader.Fail("field set more than once");
+          _seen[5] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<uint8_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              uint8_t _v = uint8_t();
+              if (!_reader.ParseScalar(&_v)) return false;
+              _elems.push_back(static_cast<uint8_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            inventory = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        if (!memcmp(_key, "test_type", 9)) {
+          if (_seen[7]) return _reader.Fail("field set more than once");
+          _seen[7] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!FromJson(_reader, &test_type)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "testempty", 9)) {
+          if (_seen[14]) return _reader.Fail("field set more than once");
+          _seen[14] = true;
+          if (_reader.AcceptNull()) continue;
+          if (!FromJson(_reader, _fbb, &testempty)) return false;
+          continue;
+        }
+        break;
+      case 10:
+        if (!memcmp(_key, "any_unique", 10)) {
+          if (_seen[44]) return _reader.Fail("field set more than once");
+          _seen[44] = true;
+          if (_reader.AcceptNull()) continue;
+          if (any_unique_type == MyGame::Example::AnyUniqueAliases_NONE) {
+            any_unique_json_ = _reader.position();
+            if (!_reader.Skip()) return false;
+            continue;
+          }
+          if (!MyGame::Example::FromJsonAnyUniqueAliases(_reader, _fbb, any_unique_type, &any_unique)) return false;
+          continue;
+        }
+        break;
+      case 11:
+        if (!memcmp(_key, "signed_enum", 11)) {
+          if (_seen[48]) return _reader.Fail("field set more than once");
+          _seen[48] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!FromJson(_reader, &signed_enum)) return false;
+          continue;
+        }
+        break;
+      case 13:
+        if (!memcmp(_key, "any_ambiguous", 13)) {
+          if (_seen[46]) return _reader.Fail("field set more than once");
+          _seen[46] = true;
+          if (_reader.AcceptNull()) continue;
+          if (any_ambiguous_type == MyGame::Example::AnyAmbiguousAliases_NONE) {
+            any_ambiguous_json_ = _reader.position();
+            if (!_reader.Skip()) return false;
+            continue;
+          }
+          if (!MyGame::Example::FromJsonAnyAmbiguousAliases(_reader, _fbb, any_ambiguous_type, &any_ambiguous)) return false;
+          continue;
+        }
+        break;
+      case 15:
+        if (!memcmp(_key, "vector_of_longs", 15)) {
+          if (_seen[32]) return _reader.Fail("field set more than once");
+          _seen[32] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<int64_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              int64_t _v = int64_t();
+              if (!_reader.ParseScalar(&_v)) return false;
+              _elems.push_back(static_cast<int64_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            vector_of_longs = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        if (!memcmp(_key, "any_unique_type", 15)) {
+          if (_seen[43]) return _reader.Fail("field set more than once");
+          _seen[43] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!FromJson(_reader, &any_unique_type)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "vector_of_enums", 15)) {
+          if (_seen[47]) return _reader.Fail("field set more than once");
+          _seen[47] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<uint8_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              MyGame::Example::Color _v = MyGame::Example::Color();
+              if (!FromJson(_reader, &_v)) return false;
+              _elems.push_back(static_cast<uint8_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            vector_of_enums = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        break;
+      case 16:
+        if (!memcmp(_key, "testhashs32_fnv1", 16)) {
+          if (_seen[16]) return _reader.Fail("field set more than once");
+          _seen[16] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            testhashs32_fnv1 = static_cast<int32_t>(flatbuffers::HashFnv1<uint32_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&testhashs32_fnv1)) {
+            return false;
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testhashu32_fnv1", 16)) {
+          if (_seen[17]) return _reader.Fail("field set more than once");
+          _seen[17] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            testhashu32_fnv1 = static_cast<uint32_t>(flatbuffers::HashFnv1<uint32_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&testhashu32_fnv1)) {
+            return false;
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testhashs64_fnv1", 16)) {
+          if (_seen[18]) return _reader.Fail("field set more than once");
+          _seen[18] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            testhashs64_fnv1 = static_cast<int64_t>(flatbuffers::HashFnv1<uint64_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&testhashs64_fnv1)) {
+            return false;
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testhashu64_fnv1", 16)) {
+          if (_seen[19]) return _reader.Fail("field set more than once");
+          _seen[19] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            testhashu64_fnv1 = static_cast<uint64_t>(flatbuffers::HashFnv1<uint64_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&testhashu64_fnv1)) {
+            return false;
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testarrayofbools", 16)) {
+          if (_seen[24]) return _reader.Fail("field set more than once");
+          _seen[24] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<uint8_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              bool _v = bool();
+              if (!_reader.ParseScalar(&_v)) return false;
+              _elems.push_back(static_cast<uint8_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            testarrayofbools = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        break;
+      case 17:
+        if (!memcmp(_key, "testarrayofstring", 17)) {
+          if (_seen[10]) return _reader.Fail("field set more than once");
+          _seen[10] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<flatbuffers::Offset<flatbuffers::String>> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              const char *_str;
+              size_t _len;
+              if (!_reader.ParseString(&_str, &_len)) return false;
+              _elems.push_back(_fbb.CreateString(_str, _len));
+            }
+            if (!_reader.ok()) return false;
+            testarrayofstring = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testarrayoftables", 17)) {
+          if (_seen[11]) return _reader.Fail("field set more than once");
+          _seen[11] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<flatbuffers::Offset<MyGame::Example::Monster>> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              flatbuffers::Offset<MyGame::Example::Monster> _elem;
+              if (!FromJson(_reader, _fbb, &_elem)) return false;
+              _elems.push_back(_elem);
+            }
+            if (!_reader.ok()) return false;
+            testarrayoftables = _fbb.CreateVectorOfSortedTables(&_elems);
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testhashs32_fnv1a", 17)) {
+          if (_seen[20]) return _reader.Fail("field set more than once");
+          _seen[20] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            testhashs32_fnv1a = static_cast<int32_t>(flatbuffers::HashFnv1a<uint32_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&testhashs32_fnv1a)) {
+            return false;
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testhashu32_fnv1a", 17)) {
+          if (_seen[21]) return _reader.Fail("field set more than once");
+          _seen[21] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            testhashu32_fnv1a = static_cast<uint32_t>(flatbuffers::HashFnv1a<uint32_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&testhashu32_fnv1a)) {
+            return false;
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testhashs64_fnv1a", 17)) {
+          if (_seen[22]) return _reader.Fail("field set more than once");
+          _seen[22] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            testhashs64_fnv1a = static_cast<int64_t>(flatbuffers::HashFnv1a<uint64_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&testhashs64_fnv1a)) {
+            return false;
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testhashu64_fnv1a", 17)) {
+          if (_seen[23]) return _reader.Fail("field set more than once");
+          _seen[23] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            testhashu64_fnv1a = static_cast<uint64_t>(flatbuffers::HashFnv1a<uint64_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&testhashu64_fnv1a)) {
+            return false;
+          }
+          continue;
+        }
+        if (!memcmp(_key, "vector_of_doubles", 17)) {
+          if (_seen[33]) return _reader.Fail("field set more than once");
+          _seen[33] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<double> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              double _v = double();
+              if (!_reader.ParseScalar(&_v)) return false;
+              _elems.push_back(static_cast<double>(_v));
+            }
+            if (!_reader.ok()) return false;
+            vector_of_doubles = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        break;
+      case 18:
+        if (!memcmp(_key, "testarrayofstring2", 18)) {
+          if (_seen[28]) return _reader.Fail("field set more than once");
+          _seen[28] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<flatbuffers::Offset<flatbuffers::String>> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              const char *_str;
+              size_t _len;
+              if (!_reader.ParseString(&_str, &_len)) return false;
+              _elems.push_back(_fbb.CreateString(_str, _len));
+            }
+            if (!_reader.ok()) return false;
+            testarrayofstring2 = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        if (!memcmp(_key, "any_ambiguous_type", 18)) {
+          if (_seen[45]) return _reader.Fail("field set more than once");
+          _seen[45] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!FromJson(_reader, &any_ambiguous_type)) return false;
+          continue;
+        }
+        break;
+      case 19:
+        if (!memcmp(_key, "co_owning_reference", 19)) {
+          if (_seen[39]) return _reader.Fail("field set more than once");
+          _seen[39] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            co_owning_reference = static_cast<uint64_t>(flatbuffers::HashFnv1a<uint64_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&co_owning_reference)) {
+            return false;
+          }
+          continue;
+        }
+        break;
+      case 20:
+        if (!memcmp(_key, "testnestedflatbuffer", 20)) {
+          if (_seen[13]) return _reader.Fail("field set more than once");
+          _seen[13] = true;
+          if (_reader.AcceptNull()) continue;
+          if (_reader.Peek() == '{') {
+            flatbuffers::FlatBufferBuilder _nested;
+            flatbuffers::Offset<MyGame::Example::Monster> _root;
+            if (!FromJson(_reader, _nested, &_root)) return false;
+            _nested.Finish(_root);
+            _fbb.ForceVectorAlignment(_nested.GetSize(), sizeof(uint8_t), _nested.GetBufferMinAlignment());
+            testnestedflatbuffer = _fbb.CreateVector(_nested.GetBufferPointer(), _nested.GetSize());
+            continue;
+          }
+          {
+            std::vector<uint8_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              uint8_t _v = uint8_t();
+              if (!_reader.ParseScalar(&_v)) return false;
+              _elems.push_back(static_cast<uint8_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            testnestedflatbuffer = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        if (!memcmp(_key, "non_owning_reference", 20)) {
+          if (_seen[41]) return _reader.Fail("field set more than once");
+          _seen[41] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            non_owning_reference = static_cast<uint64_t>(flatbuffers::HashFnv1a<uint64_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&non_owning_reference)) {
+            return false;
+          }
+          continue;
+        }
+        break;
+      case 21:
+        if (!memcmp(_key, "parent_namespace_test", 21)) {
+          if (_seen[34]) return _reader.Fail("field set more than once");
+          _seen[34] = true;
+          if (_reader.AcceptNull()) continue;
+          if (!FromJson(_reader, _fbb, &parent_namespace_test)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "vector_of_referrables", 21)) {
+          if (_seen[35]) return _reader.Fail("field set more than once");
+          _seen[35] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<flatbuffers::Offset<MyGame::Example::Referrable>> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              flatbuffers::Offset<MyGame::Example::Referrable> _elem;
+              if (!FromJson(_reader, _fbb, &_elem)) return false;
+              _elems.push_back(_elem);
+            }
+            if (!_reader.ok()) return false;
+            vector_of_referrables = _fbb.CreateVectorOfSortedTables(&_elems);
+          }
+          continue;
+        }
+        if (!memcmp(_key, "single_weak_reference", 21)) {
+          if (_seen[36]) return _reader.Fail("field set more than once");
+          _seen[36] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (_reader.IsNextName()) {
+            const char *_str;
+            size_t _len;
+            if (!_reader.ParseName(&_str, &_len)) return false;
+            const std::string _name(_str, _len);
+            single_weak_reference = static_cast<uint64_t>(flatbuffers::HashFnv1a<uint64_t>(_name.c_str()));
+          } else if (!_reader.ParseScalar(&single_weak_reference)) {
+            return false;
+          }
+          continue;
+        }
+        break;
+      case 23:
+        if (!memcmp(_key, "testarrayofsortedstruct", 23)) {
+          if (_seen[29]) return _reader.Fail("field set more than once");
+          _seen[29] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<MyGame::Example::Ability> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              _elems.push_back(MyGame::Example::Ability());
+              if (!FromJson(_reader, &_elems.back())) return false;
+            }
+            if (!_reader.ok()) return false;
+            testarrayofsortedstruct = _fbb.CreateVectorOfSortedStructs(&_elems);
+          }
+          continue;
+        }
+        break;
+      case 24:
+        if (!memcmp(_key, "scalar_key_sorted_tables", 24)) {
+          if (_seen[50]) return _reader.Fail("field set more than once");
+          _seen[50] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<flatbuffers::Offset<MyGame::Example::Stat>> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              flatbuffers::Offset<MyGame::Example::Stat> _elem;
+              if (!FromJson(_reader, _fbb, &_elem)) return false;
+              _elems.push_back(_elem);
+            }
+            if (!_reader.ok()) return false;
+            scalar_key_sorted_tables = _fbb.CreateVectorOfSortedTables(&_elems);
+          }
+          continue;
+        }
+        break;
+      case 25:
+        if (!memcmp(_key, "vector_of_weak_references", 25)) {
+          if (_seen[37]) return _reader.Fail("field set more than once");
+          _seen[37] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<uint64_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              uint64_t _v = uint64_t();
+              if (_reader.IsNextName()) {
+                const char *_str;
+                size_t _len;
+                if (!_reader.ParseName(&_str, &_len)) return false;
+                const std::string _name(_str, _len);
+                _v = static_cast<uint64_t>(flatbuffers::HashFnv1a<uint64_t>(_name.c_str()));
+              } else if (!_reader.ParseScalar(&_v)) {
+                return false;
+              }
+              _elems.push_back(static_cast<uint64_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            vector_of_weak_references = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        break;
+      case 28:
+        if (!memcmp(_key, "vector_of_strong_referrables", 28)) {
+          if (_seen[38]) return _reader.Fail("field set more than once");
+          _seen[38] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<flatbuffers::Offset<MyGame::Example::Referrable>> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              flatbuffers::Offset<MyGame::Example::Referrable> _elem;
+              if (!FromJson(_reader, _fbb, &_elem)) return false;
+              _elems.push_back(_elem);
+            }
+            if (!_reader.ok()) return false;
+            vector_of_strong_referrables = _fbb.CreateVectorOfSortedTables(&_elems);
+          }
+          continue;
+        }
+        if (!memcmp(_key, "testrequirednestedflatbuffer", 28)) {
+          if (_seen[49]) return _reader.Fail("field set more than once");
+          _seen[49] = true;
+          if (_reader.AcceptNull()) continue;
+          if (_reader.Peek() == '{') {
+            flatbuffers::FlatBufferBuilder _nested;
+            flatbuffers::Offset<MyGame::Example::Monster> _root;
+            if (!FromJson(_reader, _nested, &_root)) return false;
+            _nested.Finish(_root);
+            _fbb.ForceVectorAlignment(_nested.GetSize(), sizeof(uint8_t), _nested.GetBufferMinAlignment());
+            testrequirednestedflatbuffer = _fbb.CreateVector(_nested.GetBufferPointer(), _nested.GetSize());
+            continue;
+          }
+          {
+            std::vector<uint8_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              uint8_t _v = uint8_t();
+              if (!_reader.ParseScalar(&_v)) return false;
+              _elems.push_back(static_cast<uint8_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            testrequirednestedflatbuffer = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        break;
+      case 30:
+        if (!memcmp(_key, "vector_of_co_owning_references", 30)) {
+          if (_seen[40]) return _reader.Fail("field set more than once");
+          _seen[40] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<uint64_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              uint64_t _v = uint64_t();
+              if (_reader.IsNextName()) {
+                const char *_str;
+                size_t _len;
+                if (!_reader.ParseName(&_str, &_len)) return false;
+                const std::string _name(_str, _len);
+                _v = static_cast<uint64_t>(flatbuffers::HashFnv1a<uint64_t>(_name.c_str()));
+              } else if (!_reader.ParseScalar(&_v)) {
+                return false;
+              }
+              _elems.push_back(static_cast<uint64_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            vector_of_co_owning_references = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        break;
+      case 31:
+        if (!memcmp(_key, "vector_of_non_owning_references", 31)) {
+          if (_seen[42]) return _reader.Fail("field set more than once");
+          _seen[42] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<uint64_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              uint64_t _v = uint64_t();
+              if (_reader.IsNextName()) {
+                const char *_str;
+                size_t _len;
+                if (!_reader.ParseName(&_str, &_len)) return false;
+                const std::string _name(_str, _len);
+                _v = static_cast<uint64_t>(flatbuffers::HashFnv1a<uint64_t>(_name.c_str()));
+              } else if (!_reader.ParseScalar(&_v)) {
+                return false;
+              }
+              _elems.push_back(static_cast<uint64_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            vector_of_non_owning_references = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  if (test_json_) {
+    const char *const _resume = _reader.position();
+    _reader.Seek(test_json_);
+    if (!MyGame::Example::FromJsonAny(_reader, _fbb, test_type, &test)) return false;
+    _reader.Seek(_resume);
+  }
+  if (any_unique_json_) {
+    const char *const _resume = _reader.position();
+    _reader.Seek(any_unique_json_);
+    if (!MyGame::Example::FromJsonAnyUniqueAliases(_reader, _fbb, any_unique_type, &any_unique)) return false;
+    _reader.Seek(_resume);
+  }
+  if (any_ambiguous_json_) {
+    const char *const _resume = _reader.position();
+    _reader.Seek(any_ambiguous_json_);
+    if (!MyGame::Example::FromJsonAnyAmbiguousAliases(_reader, _fbb, any_ambiguous_type, &any_ambiguous)) return false;
+    _reader.Seek(_resume);
+  }
+  if (name.IsNull())
+    return _reader.Fail("required field is missing: name in Monster");
+  *_val = CreateMonster(_fbb, pos, mana, hp, name, inventory, color, test_type, test, test4, testarrayofstring, testarrayoftables, enemy, testnestedflatbuffer, testempty, testbool, testhashs32_fnv1, testhashu32_fnv1, testhashs64_fnv1, testhashu64_fnv1, testhashs32_fnv1a, testhashu32_fnv1a, testhashs64_fnv1a, testhashu64_fnv1a, testarrayofbools, testf, testf2, testf3, testarrayofstring2, testarrayofsortedstruct, flex, test5, vector_of_longs, vector_of_doubles, parent_namespace_test, vector_of_referrables, single_weak_reference, vector_of_weak_references, vector_of_strong_referrables, co_owning_reference, vector_of_co_owning_references, non_owning_reference, vector_of_non_owning_references, any_unique_type, any_unique, any_ambiguous_type, any_ambiguous, vector_of_enums, signed_enum, testrequirednestedflatbuffer, scalar_key_sorted_tables);
+  return true;
+}
+
+inline bool FromJson(const char *_json, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<Monster> *_val, std::string *_error = nullptr) {
+  flatbuffers::JsonReader _reader(_json);
+  if (FromJson(_reader, _fbb, _val) && _reader.End()) return true;
+  if (_error) *_error = _reader.error();
+  return false;
+}
+
+inline bool FromJson(flatbuffers::JsonReader &_reader, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TypeAliases> *_val) {
+  int8_t i8 = 0;
+  uint8_t u8 = 0;
+  int16_t i16 = 0;
+  uint16_t u16 = 0;
+  int32_t i32 = 0;
+  uint32_t u32 = 0;
+  int64_t i64 = 0;
+  uint64_t u64 = 0;
+  float f32 = 0.0f;
+  double f64 = 0.0;
+  flatbuffers::Offset<flatbuffers::Vector<int8_t>> v8 = 0;
+  flatbuffers::Offset<flatbuffers::Vector<double>> vf64 = 0;
+  bool _seen[12] = {};
+  bool _first = true;
+  const char *_key;
+  size_t _key_len;
+  if (!_reader.BeginObject()) return false;
+  while (_reader.NextMember(&_first, &_key, &_key_len)) {
+    switch (_key_len) {
+      case 2:
+        if (!memcmp(_key, "i8", 2)) {
+          if (_seen[0]) return _reader.Fail("field set more than once");
+          _seen[0] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&i8)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "u8", 2)) {
+          if (_seen[1]) return _reader.Fail("field set more than once");
+          _seen[1] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&u8)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "v8", 2)) {
+          if (_seen[10]) return _reader.Fail("field set more than once");
+          _seen[10] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<int8_t> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              int8_t _v = int8_t();
+              if (!_reader.ParseScalar(&_v)) return false;
+              _elems.push_back(static_cast<int8_t>(_v));
+            }
+            if (!_reader.ok()) return false;
+            v8 = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        break;
+      case 3:
+        if (!memcmp(_key, "i16", 3)) {
+          if (_seen[2]) return _reader.Fail("field set more than once");
+          _seen[2] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&i16)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "u16", 3)) {
+          if (_seen[3]) return _reader.Fail("field set more than once");
+          _seen[3] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&u16)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "i32", 3)) {
+          if (_seen[4]) return _reader.Fail("field set more than once");
+          _seen[4] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&i32)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "u32", 3)) {
+          if (_seen[5]) return _reader.Fail("field set more than once");
+          _seen[5] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&u32)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "i64", 3)) {
+          if (_seen[6]) return _reader.Fail("field set more than once");
+          _seen[6] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&i64)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "u64", 3)) {
+          if (_seen[7]) return _reader.Fail("field set more than once");
+          _seen[7] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&u64)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "f32", 3)) {
+          if (_seen[8]) return _reader.Fail("field set more than once");
+          _seen[8] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&f32)) return false;
+          continue;
+        }
+        if (!memcmp(_key, "f64", 3)) {
+          if (_seen[9]) return _reader.Fail("field set more than once");
+          _seen[9] = true;
+          if (_reader.AcceptNull())
+            return _reader.Fail("null for a non-optional scalar");
+          if (!_reader.ParseScalar(&f64)) return false;
+          continue;
+        }
+        break;
+      case 4:
+        if (!memcmp(_key, "vf64", 4)) {
+          if (_seen[11]) return _reader.Fail("field set more than once");
+          _seen[11] = true;
+          if (_reader.AcceptNull()) continue;
+          {
+            std::vector<double> _elems;
+            bool _first_elem = true;
+            if (!_reader.BeginArray()) return false;
+            while (_reader.NextElement(&_first_elem)) {
+              double _v = double();
+              if (!_reader.ParseScalar(&_v)) return false;
+              _elems.push_back(static_cast<double>(_v));
+            }
+            if (!_reader.ok()) return false;
+            vf64 = _fbb.CreateVector(_elems);
+          }
+          continue;
+        }
+        break;
+      default: break;
+    }
+    return _reader.Fail("unknown field");
+  }
+  if (!_reader.ok()) return false;
+  *_val = CreateTypeAliases(_fbb, i8, u8, i16, u16, i32, u32, i64, u64, f32, f64, v8, vf64);
+  return true;
+}
+
+inline bool FromJson(const char *_json, flatbuffers::FlatBufferBuilder &_fbb, flatbuffers::Offset<TypeAliases> *_val, std::string *_error = nullptr) {
+  flatbuffers::JsonReader _reader(_json);
+  if (FromJson(_reader, _fbb, _val) && _reader.End()) return true;
+  if (_error) *_error = _reader.error();
+  return false;
+}
+
+inline uint64_t HashAny(const void *obj, Any type);
+inline uint64_t Hash(const AnyUnion &obj);
+inline uint64_t HashAnyUniqueAliases(const void *obj, AnyUniqueAliases type);
+inline uint64_t Hash(const AnyUniqueAliasesUnion &obj);
+inline uint64_t HashAnyAmbiguousAliases(const void *obj, AnyAmbiguousAliases type);
+inline uint64_t Hash(const AnyAmbiguousAliasesUnion &obj);
+}  // namespace Example
+
+inline uint64_t Hash(const InParentNamespace *obj);
+inline uint64_t Hash(const InParentNamespaceT *obj);
+namespace Example2 {
+
+inline uint64_t Hash(const Monster *obj);
+inline uint64_t Hash(const MonsterT *obj);
+}  // namespace Example2
+
+namespace Example {
+
+inline uint64_t Hash(const Test *obj);
+inline uint64_t Hash(const TestSimpleTableWithEnum *obj);
+inline uint64_t Hash(const TestSimpleTableWithEnumT *obj);
+inline uint64_t Hash(const Vec3 *obj);
+inline uint64_t Hash(const Ability *obj);
+inline uint64_t Hash(const Stat *obj);
+inline uint64_t Hash(const StatT *obj);
+inline uint64_t Hash(const Referrable *obj);
+inline uint64_t Hash(const ReferrableT *obj);
+inline uint64_t Hash(const Monster *obj);
+inline uint64_t Hash(const MonsterT *obj);
+inline uint64_t Hash(const TypeAliases *obj);
+inline uint64_t Hash(const TypeAliasesT *obj);
+
+inline uint64_t HashAny(const void *obj, Any type) {
+  const auto h = flatbuffers::HashKey(type);
+  switch (type) {
+    case Any_Monster: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case Any_TestSimpleTableWithEnum: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case Any_MyGame_Example2_Monster: {
+      const auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    default: return h;
+  }
+}
+
+inline uint64_t Hash(const AnyUnion &obj) {
+  const auto h = flatbuffers::HashKey(obj.type);
+  switch (obj.type) {
+    case Any_Monster: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(obj.value);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case Any_TestSimpleTableWithEnum: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnumT *>(obj.value);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case Any_MyGame_Example2_Monster: {
+      const auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(obj.value);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    default: return h;
+  }
+}
+
+inline uint64_t HashAnyUniqueAliases(const void *obj, AnyUniqueAliases type) {
+  const auto h = flatbuffers::HashKey(type);
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case AnyUniqueAliases_TS: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case AnyUniqueAliases_M2: {
+      const auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    default: return h;
+  }
+}
+
+inline uint64_t Hash(const AnyUniqueAliasesUnion &obj) {
+  const auto h = flatbuffers::HashKey(obj.type);
+  switch (obj.type) {
+    case AnyUniqueAliases_M: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(obj.value);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case AnyUniqueAliases_TS: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnumT *>(obj.value);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case AnyUniqueAliases_M2: {
+      const auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(obj.value);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    default: return h;
+  }
+}
+
+inline uint64_t HashAnyAmbiguousAliases(const void *obj, AnyAmbiguousAliases type) {
+  const auto h = flatbuffers::HashKey(type);
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case AnyAmbiguousAliases_M2: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case AnyAmbiguousAliases_M3: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    default: return h;
+  }
+}
+
+inline uint64_t Hash(const AnyAmbiguousAliasesUnion &obj) {
+  const auto h = flatbuffers::HashKey(obj.type);
+  switch (obj.type) {
+    case AnyAmbiguousAliases_M1: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(obj.value);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case AnyAmbiguousAliases_M2: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(obj.value);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    case AnyAmbiguousAliases_M3: {
+      const auto ptr = reinterpret_cast<const MyGame::Example::MonsterT *>(obj.value);
+      return flatbuffers::HashCombine(h, Hash(ptr));
+    }
+    default: return h;
+  }
+}
+
+}  // namespace Example
+
+inline uint64_t Hash(const InParentNamespace *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  return h;
+}
+
+inline uint64_t Hash(const InParentNamespaceT *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  return h;
+}
+
+namespace Example2 {
+
+inline uint64_t Hash(const Monster *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  return h;
+}
+
+inline uint64_t Hash(const MonsterT *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  return h;
+}
+
+}  // namespace Example2
+
+namespace Example {
+
+inline uint64_t Hash(const Test *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->a()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->b()));
+  return h;
+}
+
+inline uint64_t Hash(const TestSimpleTableWithEnum *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->color()));
+  return h;
+}
+
+inline uint64_t Hash(const TestSimpleTableWithEnumT *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->color));
+  return h;
+}
+
+inline uint64_t Hash(const Vec3 *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->x()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->y()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->z()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->test1()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->test2()));
+  h = flatbuffers::HashCombine(h, Hash(&obj->test3()));
+  return h;
+}
+
+inline uint64_t Hash(const Ability *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->id()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->distance()));
+  return h;
+}
+
+inline uint64_t Hash(const Stat *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashString(obj->id()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->val()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->count()));
+  return h;
+}
+
+inline uint64_t Hash(const StatT *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashString(obj->id));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->val));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->count));
+  return h;
+}
+
+inline uint64_t Hash(const Referrable *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->id()));
+  return h;
+}
+
+inline uint64_t Hash(const ReferrableT *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->id));
+  return h;
+}
+
+inline uint64_t Hash(const Monster *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, Hash(obj->pos()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->mana()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->hp()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashString(obj->name()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->inventory()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->color()));
+  h = flatbuffers::HashCombine(h, MyGame::Example::HashAny(obj->test(), obj->test_type()));
+  {
+    const auto v = obj->test4();
+    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);
+    if (v) {
+      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)
+        vh = flatbuffers::HashCombine(vh, Hash(v->Get(i)));
+    }
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  {
+    const auto v = obj->testarrayofstring();
+    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);
+    if (v) {
+      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)
+        vh = flatbuffers::HashCombine(vh, flatbuffers::HashString(v->Get(i)));
+    }
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  {
+    const auto v = obj->testarrayoftables();
+    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);
+    if (v) {
+      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)
+        vh = flatbuffers::HashCombine(vh, Hash(v->Get(i)));
+    }
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  h = flatbuffers::HashCombine(h, Hash(obj->enemy()));
+  {
+    const auto v = obj->testnestedflatbuffer();
+    const auto root = v && v->size()
+        ? obj->testnestedflatbuffer_nested_root() : nullptr;
+    h = flatbuffers::HashCombine(h, Hash(root));
+  }
+  h = flatbuffers::HashCombine(h, Hash(obj->testempty()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testbool()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashs32_fnv1()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashu32_fnv1()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashs64_fnv1()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashu64_fnv1()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashs32_fnv1a()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashs64_fnv1a()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashu64_fnv1a()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->testarrayofbools()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testf()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testf2()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testf3()));
+  {
+    const auto v = obj->testarrayofstring2();
+    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);
+    if (v) {
+      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)
+        vh = flatbuffers::HashCombine(vh, flatbuffers::HashString(v->Get(i)));
+    }
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  {
+    const auto v = obj->testarrayofsortedstruct();
+    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);
+    if (v) {
+      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)
+        vh = flatbuffers::HashCombine(vh, Hash(v->Get(i)));
+    }
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->flex()));
+  {
+    const auto v = obj->test5();
+    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);
+    if (v) {
+      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)
+        vh = flatbuffers::HashCombine(vh, Hash(v->Get(i)));
+    }
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->vector_of_longs()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->vector_of_doubles()));
+  h = flatbuffers::HashCombine(h, Hash(obj->parent_namespace_test()));
+  {
+    const auto v = obj->vector_of_referrables();
+    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);
+    if (v) {
+      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)
+        vh = flatbuffers::HashCombine(vh, Hash(v->Get(i)));
+    }
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  {
+    const auto v = obj->vector_of_strong_referrables();
+    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);
+    if (v) {
+      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)
+        vh = flatbuffers::HashCombine(vh, Hash(v->Get(i)));
+    }
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  h = flatbuffers::HashCombine(h, MyGame::Example::HashAnyUniqueAliases(obj->any_unique(), obj->any_unique_type()));
+  h = flatbuffers::HashCombine(h, MyGame::Example::HashAnyAmbiguousAliases(obj->any_ambiguous(), obj->any_ambiguous_type()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->vector_of_enums()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->signed_enum()));
+  {
+    const auto v = obj->testrequirednestedflatbuffer();
+    const auto root = v && v->size()
+        ? obj->testrequirednestedflatbuffer_nested_root() : nullptr;
+    h = flatbuffers::HashCombine(h, Hash(root));
+  }
+  {
+    const auto v = obj->scalar_key_sorted_tables();
+    uint64_t vh = flatbuffers::HashKey(v ? v->size() : 0);
+    if (v) {
+      for (flatbuffers::uoffset_t i = 0; i < v->size(); i++)
+        vh = flatbuffers::HashCombine(vh, Hash(v->Get(i)));
+    }
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  return h;
+}
+
+inline uint64_t Hash(const MonsterT *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, Hash(obj->pos.get()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->mana));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->hp));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashString(obj->name));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->inventory));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->color));
+  h = flatbuffers::HashCombine(h, Hash(obj->test));
+  {
+    uint64_t vh = flatbuffers::HashKey(obj->test4.size());
+    for (const auto &e : obj->test4)
+      vh = flatbuffers::HashCombine(vh, Hash(&e));
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  {
+    uint64_t vh = flatbuffers::HashKey(obj->testarrayofstring.size());
+    for (const auto &e : obj->testarrayofstring)
+      vh = flatbuffers::HashCombine(vh, flatbuffers::HashString(e));
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  {
+    uint64_t vh = flatbuffers::HashKey(obj->testarrayoftables.size());
+    for (const auto &e : obj->testarrayoftables)
+      vh = flatbuffers::HashCombine(vh, Hash(e.get()));
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  h = flatbuffers::HashCombine(h, Hash(obj->enemy.get()));
+  {
+    const auto &v = obj->testnestedflatbuffer;
+    const auto root = v.empty() ? nullptr
+        : flatbuffers::GetRoot<MyGame::Example::Monster>(v.data());
+    h = flatbuffers::HashCombine(h, Hash(root));
+  }
+  h = flatbuffers::HashCombine(h, Hash(obj->testempty.get()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testbool));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashs32_fnv1));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashu32_fnv1));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashs64_fnv1));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashu64_fnv1));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashs32_fnv1a));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashs64_fnv1a));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testhashu64_fnv1a));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->testarrayofbools));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testf));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testf2));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->testf3));
+  {
+    uint64_t vh = flatbuffers::HashKey(obj->testarrayofstring2.size());
+    for (const auto &e : obj->testarrayofstring2)
+      vh = flatbuffers::HashCombine(vh, flatbuffers::HashString(e));
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  {
+    uint64_t vh = flatbuffers::HashKey(obj->testarrayofsortedstruct.size());
+    for (const auto &e : obj->testarrayofsortedstruct)
+      vh = flatbuffers::HashCombine(vh, Hash(&e));
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->flex));
+  {
+    uint64_t vh = flatbuffers::HashKey(obj->test5.size());
+    for (const auto &e : obj->test5)
+      vh = flatbuffers::HashCombine(vh, Hash(&e));
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->vector_of_longs));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->vector_of_doubles));
+  h = flatbuffers::HashCombine(h, Hash(obj->parent_namespace_test.get()));
+  {
+    uint64_t vh = flatbuffers::HashKey(obj->vector_of_referrables.size());
+    for (const auto &e : obj->vector_of_referrables)
+      vh = flatbuffers::HashCombine(vh, Hash(e.get()));
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  {
+    uint64_t vh = flatbuffers::HashKey(obj->vector_of_strong_referrables.size());
+    for (const auto &e : obj->vector_of_strong_referrables)
+      vh = flatbuffers::HashCombine(vh, Hash(e.get()));
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  h = flatbuffers::HashCombine(h, Hash(obj->any_unique));
+  h = flatbuffers::HashCombine(h, Hash(obj->any_ambiguous));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->vector_of_enums));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->signed_enum));
+  {
+    const auto &v = obj->testrequirednestedflatbuffer;
+    const auto root = v.empty() ? nullptr
+        : flatbuffers::GetRoot<MyGame::Example::Monster>(v.data());
+    h = flatbuffers::HashCombine(h, Hash(root));
+  }
+  {
+    uint64_t vh = flatbuffers::HashKey(obj->scalar_key_sorted_tables.size());
+    for (const auto &e : obj->scalar_key_sorted_tables)
+      vh = flatbuffers::HashCombine(vh, Hash(e.get()));
+    h = flatbuffers::HashCombine(h, vh);
+  }
+  return h;
+}
+
+inline uint64_t Hash(const TypeAliases *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->i8()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->u8()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->i16()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->u16()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->i32()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->u32()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->i64()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->u64()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->f32()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->f64()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->v8()));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->vf64()));
+  return h;
+}
+
+inline uint64_t Hash(const TypeAliasesT *obj) {
+  if (!obj) return flatbuffers::kHashAbsent;
+  uint64_t h = 0;
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->i8));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->u8));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->i16));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->u16));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->i32));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->u32));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->i64));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->u64));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->f32));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashKey(obj->f64));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->v8));
+  h = flatbuffers::HashCombine(h, flatbuffers::HashScalars(obj->vf64));
+  return h;
+}
+
 inline const flatbuffers::TypeTable *ColorTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_UCHAR, 0, 0 },
@@ -3610,4 +6652,68 @@ inline flatbuffers::unique_ptr<MyGame::Example::MonsterT> UnPackSizePrefixedMons
 }  // namespace Example
 }  // namespace MyGame
 
+namespace std {
+
+template<> struct hash<MyGame::InParentNamespaceT> {
+  size_t operator()(const MyGame::InParentNamespaceT &obj) const {
+    return static_cast<size_t>(MyGame::Hash(&obj));
+  }
+};
+
+template<> struct hash<MyGame::Example2::MonsterT> {
+  size_t operator()(const MyGame::Example2::MonsterT &obj) const {
+    return static_cast<size_t>(MyGame::Example2::Hash(&obj));
+  }
+};
+
+template<> struct hash<MyGame::Example::Test> {
+  size_t operator()(const MyGame::Example::Test &obj) const {
+    return static_cast<size_t>(MyGame::Example::Hash(&obj));
+  }
+};
+
+template<> struct hash<MyGame::Example::TestSimpleTableWithEnumT> {
+  size_t operator()(const MyGame::Example::TestSimpleTableWithEnumT &obj) const {
+    return static_cast<size_t>(MyGame::Example::Hash(&obj));
+  }
+};
+
+template<> struct hash<MyGame::Example::Vec3> {
+  size_t operator()(const MyGame::Example::Vec3 &obj) const {
+    return static_cast<size_t>(MyGame::Example::Hash(&obj));
+  }
+};
+
+template<> struct hash<MyGame::Example::Ability> {
+  size_t operator()(const MyGame::Example::Ability &obj) const {
+    return static_cast<size_t>(MyGame::Example::Hash(&obj));
+  }
+};
+
+template<> struct hash<MyGame::Example::StatT> {
+  size_t operator()(const MyGame::Example::StatT &obj) const {
+    return static_cast<size_t>(MyGame::Example::Hash(&obj));
+  }
+};
+
+template<> struct hash<MyGame::Example::ReferrableT> {
+  size_t operator()(const MyGame::Example::ReferrableT &obj) const {
+    return static_cast<size_t>(MyGame::Example::Hash(&obj));
+  }
+};
+
+template<> struct hash<MyGame::Example::MonsterT> {
+  size_t operator()(const MyGame::Example::MonsterT &obj) const {
+    return static_cast<size_t>(MyGame::Example::Hash(&obj));
+  }
+};
+
+template<> struct hash<MyGame::Example::TypeAliasesT> {
+  size_t operator()(const MyGame::Example::TypeAliasesT &obj) const {
+    return static_cast<size_t>(MyGame::Example::Hash(&obj));
+  }
+};
+
+}  // namespace std
+
 #endif  // FLATBUFFERS_GENERATED_MONSTERTEST_MYGAME_EXAMPLE_H_
@@ -92,6 +92,7 @@ struct UnionInNestedNSUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, UnionInNestedNS type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, UnionInNestedNS _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   NamespaceA::NamespaceB::TableInNestedNST *AsTableInNestedNS() {
@@ -342,6 +343,23 @@ inline void *UnionInNestedNSUnion::UnPack(const void *obj, UnionInNestedNS type,
   }
 }
 
+inline void UnionInNestedNSUnion::UnPackTo(const void *obj, UnionInNestedNS _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case UnionInNestedNS_TableInNestedNS: {
+        auto ptr = reinterpret_cast<const NamespaceA::NamespaceB::TableInNestedNS *>(obj);
+        auto dst = reinterpret_cast<NamespaceA::NamespaceB::TableInNestedNST *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
 inline flatbuffers::Offset<void> UnionInNestedNSUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case UnionInNestedNS_TableInNestedNS: {
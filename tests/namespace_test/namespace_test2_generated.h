@@ -379,11 +379,10 @@ inline TableInFirstNST *TableInFirstNS::UnPack(const flatbuffers::resolver_funct
 inline void TableInFirstNS::UnPackTo(TableInFirstNST *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = foo_table(); if (_e) _o->foo_table = flatbuffers::unique_ptr<NamespaceA::NamespaceB::TableInNestedNST>(_e->UnPack(_resolver)); }
+  { auto _e = foo_table(); if (_e) { if (_o->foo_table) _e->UnPackTo(_o->foo_table.get(), _resolver); else _o->foo_table = flatbuffers::unique_ptr<NamespaceA::NamespaceB::TableInNestedNST>(_e->UnPack(_resolver)); } else _o->foo_table = nullptr; }
   { auto _e = foo_enum(); _o->foo_enum = _e; }
-  { auto _e = foo_union_type(); _o->foo_union.type = _e; }
-  { auto _e = foo_union(); if (_e) _o->foo_union.value = NamespaceA::NamespaceB::UnionInNestedNSUnion::UnPack(_e, foo_union_type(), _resolver); }
-  { auto _e = foo_struct(); if (_e) _o->foo_struct = flatbuffers::unique_ptr<NamespaceA::NamespaceB::StructInNestedNS>(new NamespaceA::NamespaceB::StructInNestedNS(*_e)); }
+  { auto _e = foo_union(); if (_e) _o->foo_union.UnPackTo(_e, foo_union_type(), _resolver); else _o->foo_union.Reset(); }
+  { auto _e = foo_struct(); if (_e) { if (_o->foo_struct) *_o->foo_struct = *_e; else _o->foo_struct = flatbuffers::unique_ptr<NamespaceA::NamespaceB::StructInNestedNS>(new NamespaceA::NamespaceB::StructInNestedNS(*_e)); } else _o->foo_struct = nullptr; }
 }
 
 inline flatbuffers::Offset<TableInFirstNS> TableInFirstNS::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TableInFirstNST* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -421,8 +420,8 @@ inline TableInCT *TableInC::UnPack(const flatbuffers::resolver_function_t *_reso
 inline void TableInC::UnPackTo(TableInCT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = refer_to_a1(); if (_e) _o->refer_to_a1 = flatbuffers::unique_ptr<NamespaceA::TableInFirstNST>(_e->UnPack(_resolver)); }
-  { auto _e = refer_to_a2(); if (_e) _o->refer_to_a2 = flatbuffers::unique_ptr<NamespaceA::SecondTableInAT>(_e->UnPack(_resolver)); }
+  { auto _e = refer_to_a1(); if (_e) { if (_o->refer_to_a1) _e->UnPackTo(_o->refer_to_a1.get(), _resolver); else _o->refer_to_a1 = flatbuffers::unique_ptr<NamespaceA::TableInFirstNST>(_e->UnPack(_resolver)); } else _o->refer_to_a1 = nullptr; }
+  { auto _e = refer_to_a2(); if (_e) { if (_o->refer_to_a2) _e->UnPackTo(_o->refer_to_a2.get(), _resolver); else _o->refer_to_a2 = flatbuffers::unique_ptr<NamespaceA::SecondTableInAT>(_e->UnPack(_resolver)); } else _o->refer_to_a2 = nullptr; }
 }
 
 inline flatbuffers::Offset<TableInC> TableInC::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TableInCT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -454,7 +453,7 @@ inline SecondTableInAT *SecondTableInA::UnPack(const flatbuffers::resolver_funct
 inline void SecondTableInA::UnPackTo(SecondTableInAT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = refer_to_c(); if (_e) _o->refer_to_c = flatbuffers::unique_ptr<NamespaceC::TableInCT>(_e->UnPack(_resolver)); }
+  { auto _e = refer_to_c(); if (_e) { if (_o->refer_to_c) _e->UnPackTo(_o->refer_to_c.get(), _resolver); else _o->refer_to_c = flatbuffers::unique_ptr<NamespaceC::TableInCT>(_e->UnPack(_resolver)); } else _o->refer_to_c = nullptr; }
 }
 
 inline flatbuffers::Offset<SecondTableInA> SecondTableInA::Pack(flatbuffers::FlatBufferBuilder &_fbb, const SecondTableInAT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -641,6 +641,88 @@ inline flatbuffers::Offset<ScalarStuff> CreateScalarStuff(
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<ScalarStuff> CreateScalarStuffStaticLayout(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int8_t just_i8,
+    flatbuffers::Optional<int8_t> maybe_i8,
+    int8_t default_i8,
+    uint8_t just_u8,
+    flatbuffers::Optional<uint8_t> maybe_u8,
+    uint8_t default_u8,
+    int16_t just_i16,
+    flatbuffers::Optional<int16_t> maybe_i16,
+    int16_t default_i16,
+    uint16_t just_u16,
+    flatbuffers::Optional<uint16_t> maybe_u16,
+    uint16_t default_u16,
+    int32_t just_i32,
+    flatbuffers::Optional<int32_t> maybe_i32,
+    int32_t default_i32,
+    uint32_t just_u32,
+    flatbuffers::Optional<uint32_t> maybe_u32,
+    uint32_t default_u32,
+    int64_t just_i64,
+    flatbuffers::Optional<int64_t> maybe_i64,
+    int64_t default_i64,
+    uint64_t just_u64,
+    flatbuffers::Optional<uint64_t> maybe_u64,
+    uint64_t default_u64,
+    float just_f32,
+    flatbuffers::Optional<float> maybe_f32,
+    float default_f32,
+    double just_f64,
+    flatbuffers::Optional<double> maybe_f64,
+    double default_f64,
+    bool just_bool,
+    flatbuffers::Optional<bool> maybe_bool,
+    bool default_bool,
+    optional_scalars::OptionalByte just_enum,
+    flatbuffers::Optional<optional_scalars::OptionalByte> maybe_enum,
+    optional_scalars::OptionalByte default_enum) {
+  if (!maybe_i64.has_value() || !maybe_u64.has_value() || !maybe_f64.has_value() || !maybe_i32.has_value() || !maybe_u32.has_value() || !maybe_f32.has_value() || !maybe_i16.has_value() || !maybe_u16.has_value() || !maybe_i8.has_value() || !maybe_u8.has_value() || !maybe_bool.has_value() || !maybe_enum.has_value()) {
+    return CreateScalarStuff(_fbb, just_i8, maybe_i8, default_i8, just_u8, maybe_u8, default_u8, just_i16, maybe_i16, default_i16, just_u16, maybe_u16, default_u16, just_i32, maybe_i32, default_i32, just_u32, maybe_u32, default_u32, just_i64, maybe_i64, default_i64, just_u64, maybe_u64, default_u64, just_f32, maybe_f32, default_f32, just_f64, maybe_f64, default_f64, just_bool, maybe_bool, default_bool, just_enum, maybe_enum, default_enum);
+  }
+  static const flatbuffers::voffset_t _vtable[] = { 76, 144, 128, 129, 130, 131, 132, 133, 116, 118, 120, 122, 124, 126, 80, 84, 88, 92, 96, 100, 8, 16, 24, 32, 40, 48, 104, 108, 112, 56, 64, 72, 134, 135, 136, 137, 138, 139 };
+  const auto _t = _fbb.StartStaticTable(144, 8);
+  _fbb.SetStaticField<int64_t>(_t, 8, just_i64);
+  _fbb.SetStaticField<int64_t>(_t, 16, *maybe_i64);
+  _fbb.SetStaticField<int64_t>(_t, 24, default_i64);
+  _fbb.SetStaticField<uint64_t>(_t, 32, just_u64);
+  _fbb.SetStaticField<uint64_t>(_t, 40, *maybe_u64);
+  _fbb.SetStaticField<uint64_t>(_t, 48, default_u64);
+  _fbb.SetStaticField<double>(_t, 56, just_f64);
+  _fbb.SetStaticField<double>(_t, 64, *maybe_f64);
+  _fbb.SetStaticField<double>(_t, 72, default_f64);
+  _fbb.SetStaticField<int32_t>(_t, 80, just_i32);
+  _fbb.SetStaticField<int32_t>(_t, 84, *maybe_i32);
+  _fbb.SetStaticField<int32_t>(_t, 88, default_i32);
+  _fbb.SetStaticField<uint32_t>(_t, 92, just_u32);
+  _fbb.SetStaticField<uint32_t>(_t, 96, *maybe_u32);
+  _fbb.SetStaticField<uint32_t>(_t, 100, default_u32);
+  _fbb.SetStaticField<float>(_t, 104, just_f32);
+  _fbb.SetStaticField<float>(_t, 108, *maybe_f32);
+  _fbb.SetStaticField<float>(_t, 112, default_f32);
+  _fbb.SetStaticField<int16_t>(_t, 116, just_i16);
+  _fbb.SetStaticField<int16_t>(_t, 118, *maybe_i16);
+  _fbb.SetStaticField<int16_t>(_t, 120, default_i16);
+  _fbb.SetStaticField<uint16_t>(_t, 122, just_u16);
+  _fbb.SetStaticField<uint16_t>(_t, 124, *maybe_u16);
+  _fbb.SetStaticField<uint16_t>(_t, 126, default_u16);
+  _fbb.SetStaticField<int8_t>(_t, 128, just_i8);
+  _fbb.SetStaticField<int8_t>(_t, 129, *maybe_i8);
+  _fbb.SetStaticField<int8_t>(_t, 130, default_i8);
+  _fbb.SetStaticField<uint8_t>(_t, 131, just_u8);
+  _fbb.SetStaticField<uint8_t>(_t, 132, *maybe_u8);
+  _fbb.SetStaticField<uint8_t>(_t, 133, default_u8);
+  _fbb.SetStaticField<uint8_t>(_t, 134, static_cast<uint8_t>(just_bool));
+  _fbb.SetStaticField<uint8_t>(_t, 135, static_cast<uint8_t>(*maybe_bool));
+  _fbb.SetStaticField<uint8_t>(_t, 136, static_cast<uint8_t>(default_bool));
+  _fbb.SetStaticField<int8_t>(_t, 137, static_cast<int8_t>(just_enum));
+  _fbb.SetStaticField<int8_t>(_t, 138, static_cast<int8_t>(*maybe_enum));
+  _fbb.SetStaticField<int8_t>(_t, 139, static_cast<int8_t>(default_enum));
+  return flatbuffers::Offset<ScalarStuff>(_fbb.EndStaticTable(_t, _vtable));
+}
+
 flatbuffers::Offset<ScalarStuff> CreateScalarStuff(flatbuffers::FlatBufferBuilder &_fbb, const ScalarStuffT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 inline ScalarStuffT *ScalarStuff::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
@@ -14,10 +14,14 @@
  * limitations under the License.
  */
 #include <cmath>
+#include <thread>
+#include <unordered_set>
 
 #include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/flatc.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/minireflect.h"
+#include "flatbuffers/patch.h"
 #include "flatbuffers/registry.h"
 #include "flatbuffers/util.h"
 
@@ -42,6 +46,7 @@
 #endif
 
 #include "native_type_test_generated.h"
+#include "arena_test_generated.h"
 #include "test_assert.h"
 
 #include "flatbuffers/flexbuffers.h"
@@ -361,6 +366,13 @@ void AccessFlatBufferTest(const uint8_t *flatbuf, size_t length,
   TEST_NOTNULL(vecoftables->LookupByKey("Barney"));
   TEST_NOTNULL(vecoftables->LookupByKey("Fred"));
   TEST_NOTNULL(vecoftables->LookupByKey("Wilma"));
+  flatbuffers::KeyIndex<flatbuffers::Offset<Monster>> index(vecoftables);
+  TEST_EQ(index.size(), 3U);
+  TEST_EQ(index.LookupByKey("Barney"), vecoftables->Get(0));
+  TEST_EQ(index.LookupByKey("Fred"), vecoftables->Get(1));
+  TEST_EQ(index.LookupByKey("Wilma"), vecoftables->Get(2));
+  TEST_EQ(index.LookupByKey("Barn"), static_cast<const Monster *>(nullptr));
+  TEST_EQ(index.LookupByKey(""), static_cast<const Monster *>(nullptr));
 
   // Test accessing a vector of sorted structs
   auto vecofstructs = monster->testarrayofsortedstruct();
@@ -374,6 +386,14 @@ void AccessFlatBufferTest(const uint8_t *flatbuf, size_t length,
     TEST_NOTNULL(vecofstructs->LookupByKey(3));
     TEST_EQ(static_cast<const Ability *>(nullptr),
             vecofstructs->LookupByKey(5));
+    flatbuffers::KeyIndex<const Ability *> struct_index(vecofstructs);
+    TEST_EQ(struct_index.LookupByKey(3), vecofstructs->LookupByKey(3));
+    // Keys of another type are converted to the key field type first.
+    TEST_EQ(struct_index.LookupByKey(3.0), vecofstructs->LookupByKey(3));
+    TEST_EQ(struct_index.LookupByKey(static_cast<int64_t>(3)),
+            vecofstructs->LookupByKey(3));
+    TEST_EQ(static_cast<const Ability *>(nullptr),
+            struct_index.LookupByKey(5));
   }
 
   if (auto vec_of_stat = monster->scalar_key_sorted_tables()) {
@@ -382,6 +402,8 @@ void AccessFlatBufferTest(const uint8_t *flatbuf, size_t length,
     TEST_NOTNULL(stat_0->id());
     TEST_EQ(0, stat_0->count());
     TEST_EQ_STR("miss", stat_0->id()->c_str());
+    flatbuffers::KeyIndex<flatbuffers::Offset<Stat>> stat_index(vec_of_stat);
+    TEST_EQ(stat_index.LookupByKey(static_cast<uint16_t>(0u)), stat_0);
   }
 
   // Test nested FlatBuffers if available:
@@ -581,6 +603,335 @@ void ObjectFlatBuffersTest(uint8_t *flatbuf) {
   TEST_EQ(tests[0].b(), 20);
   TEST_EQ(tests[1].a(), 30);
   TEST_EQ(tests[1].b(), 40);
+
+  // Vectors of scalars and enums are unpacked with a bulk copy.
+  monster2->vector_of_longs.assign(3, -(1LL << 40));
+  monster2->vector_of_doubles.assign(2, 1.5);
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.Finish(CreateMonster(fbb3, monster2.get(), &rehasher),
+              MonsterIdentifier());
+  auto monster4 = UnPackMonster(fbb3.GetBufferPointer(), &resolver);
+  TEST_EQ(monster4->vector_of_longs == monster2->vector_of_longs, true);
+  TEST_EQ(monster4->vector_of_doubles == monster2->vector_of_doubles, true);
+  TEST_EQ(monster4->vector_of_enums == monster2->vector_of_enums, true);
+  TEST_EQ(monster4->vector_of_enums.size(), 2U);
+}
+
+// Unpack into an object that already holds data.
+void UnPackToReuseTest(const uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  MonsterT o;
+  monster->UnPackTo(&o);
+  const auto pos = o.pos.get();
+  const auto table = o.testarrayoftables[1].get();
+  const auto test = o.test.value;
+
+  // The same message again reuses sub-objects, and unpacks the same data.
+  monster->UnPackTo(&o);
+  TEST_EQ(o.pos.get() == pos, true);
+  TEST_EQ(o.testarrayoftables[1].get() == table, true);
+  TEST_EQ(o.test.value == test, true);
+  flatbuffers::FlatBufferBuilder fbb;
+  fbb.Finish(Monster::Pack(fbb, &o), MonsterIdentifier());
+  auto repacked = flatbuffers::FlatBufferToString(fbb.GetBufferPointer(),
+                                                  MonsterTypeTable());
+  TEST_EQ_STR(
+      repacked.c_str(),
+      flatbuffers::FlatBufferToString(flatbuf, MonsterTypeTable()).c_str());
+
+  // Fields missing from another message are reset.
+  flatbuffers::FlatBufferBuilder fbb2;
+  fbb2.Finish(CreateMonster(fbb2, nullptr, 150, 100, fbb2.CreateString("x")),
+              MonsterIdentifier());
+  GetMonster(fbb2.GetBufferPointer())->UnPackTo(&o);
+  TEST_EQ(o.pos == nullptr, true);
+  TEST_EQ(o.test.type, Any_NONE);
+  TEST_EQ(o.test.value == nullptr, true);
+  TEST_EQ(o.testarrayoftables.size(), 0U);
+  TEST_EQ(o.inventory.size(), 0U);
+  TEST_EQ_STR(o.name.c_str(), "x");
+}
+
+void PartialUnPackTest(const uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  MonsterT o;
+  o.hp = 1;
+  flatbuffers::FieldSet fields;
+  fields.Add(Monster::VT_NAME).Add(Monster::VT_INVENTORY).Add(Monster::VT_TEST);
+  TEST_EQ(fields.Contains(Monster::VT_NAME), true);
+  TEST_EQ(fields.Contains(Monster::VT_HP), false);
+  TEST_EQ(fields.Contains(Monster::VT_SCALAR_KEY_SORTED_TABLES), false);
+  monster->UnPackTo(&o, fields);
+  TEST_EQ_STR(o.name.c_str(), "MyMonster");
+  TEST_EQ(o.inventory.size(), 10U);
+  TEST_EQ(o.test.type, Any_Monster);
+  TEST_EQ_STR(o.test.AsMonster()->name.c_str(), "Fred");
+  // Fields not in the set are left untouched.
+  TEST_EQ(o.hp, 1);
+  TEST_EQ(o.pos == nullptr, true);
+  TEST_EQ(o.testarrayoftables.size(), 0U);
+
+  // Unpacking the remaining fields completes the object.
+  fields.Remove(Monster::VT_NAME).Add(Monster::VT_HP);
+  TEST_EQ(fields.Contains(Monster::VT_NAME), false);
+  o.name = "x";
+  monster->UnPackTo(&o, fields);
+  TEST_EQ(o.hp, 80);
+  TEST_EQ_STR(o.name.c_str(), "x");
+}
+
+// Sorted vectors long enough to be radix sorted by their keys.
+void SortedVectorTest() {
+  const int num_elems = 1000;
+  flatbuffers::FlatBufferBuilder fbb;
+  lcg_reset();  // Keep it deterministic.
+  std::vector<flatbuffers::Offset<Stat>> stats;
+  std::vector<Ability> abilities;
+  std::vector<uint32_t> ability_ids;
+  std::vector<flatbuffers::Offset<reflection::EnumVal>> enum_vals;
+  auto name = fbb.CreateString("v");
+  for (int i = 0; i < num_elems; i++) {
+    auto r = lcg_rand();
+    auto count = static_cast<uint16_t>(r % 300);  // With duplicates.
+    stats.push_back(CreateStat(fbb, 0, i, count));
+    abilities.push_back(Ability(r, static_cast<uint32_t>(i)));
+    ability_ids.push_back(r);
+    auto value = static_cast<int64_t>(r % 2000) - 1000;
+    enum_vals.push_back(reflection::CreateEnumVal(fbb, name, value));
+  }
+  auto stats_vec = fbb.CreateVectorOfSortedTables(&stats);
+  auto abilities_vec = fbb.CreateVectorOfSortedStructs(&abilities);
+  auto enum_vals_vec = fbb.CreateVectorOfSortedTables(&enum_vals);
+  auto sorted_stats = flatbuffers::GetTemporaryPointer(fbb, stats_vec);
+  auto sorted_abilities = flatbuffers::GetTemporaryPointer(fbb, abilities_vec);
+  auto sorted_enum_vals = flatbuffers::GetTemporaryPointer(fbb, enum_vals_vec);
+  TEST_EQ(sorted_stats->size(), static_cast<flatbuffers::uoffset_t>(num_elems));
+  for (flatbuffers::uoffset_t i = 1; i < sorted_stats->size(); i++) {
+    auto a = sorted_stats->Get(i - 1);
+    auto b = sorted_stats->Get(i);
+    TEST_EQ(a->count() <= b->count(), true);
+    // Equal keys keep their order.
+    if (a->count() == b->count()) TEST_EQ(a->val() < b->val(), true);
+    TEST_EQ(
+        sorted_abilities->Get(i - 1)->id() <= sorted_abilities->Get(i)->id(),
+        true);
+    TEST_EQ(sorted_enum_vals->Get(i - 1)->value() <=
+                sorted_enum_vals->Get(i)->value(),
+            true);
+  }
+  // Structs are moved as a whole.
+  for (flatbuffers::uoffset_t i = 0; i < sorted_abilities->size(); i++) {
+    auto ability = sorted_abilities->Get(i);
+    TEST_EQ(ability->id(), ability_ids[ability->distance()]);
+  }
+  TEST_EQ(sorted_enum_vals->Get(0)->value() < 0, true);
+  auto count = sorted_stats->Get(num_elems / 2)->count();
+  TEST_EQ(sorted_stats->LookupByKey(count)->count(), count);
+
+  // Structs with only KeyCompareLessThan, as generated before KeySortValue,
+  // are sorted with it.
+  struct LegacyKeyed {
+    uint32_t id;
+    bool KeyCompareLessThan(const LegacyKeyed *o) const { return id < o->id; }
+  };
+  std::vector<LegacyKeyed> legacy(num_elems);
+  for (int i = 0; i < num_elems; i++) legacy[i].id = ability_ids[i];
+  auto legacy_vec = fbb.CreateVectorOfSortedStructs(&legacy);
+  auto sorted_legacy = flatbuffers::GetTemporaryPointer(fbb, legacy_vec);
+  for (flatbuffers::uoffset_t i = 1; i < sorted_legacy->size(); i++) {
+    TEST_EQ(sorted_legacy->Get(i - 1)->id <= sorted_legacy->Get(i)->id, true);
+  }
+}
+
+void PrefetchFilterTest(const uint8_t *flatbuf) {
+  auto tables = GetMonster(flatbuf)->testarrayoftables();
+  std::string names;
+  for (auto monster : flatbuffers::Prefetched(tables, 2)) {
+    names += monster->name()->str() + " ";
+  }
+  TEST_EQ_STR(names.c_str(), "Barney Fred Wilma ");
+
+  struct HasLetter {
+    explicit HasLetter(char c) : c_(c) {}
+    bool operator()(const Monster *m) const {
+      return strchr(m->name()->c_str(), c_) != nullptr;
+    }
+    char c_;
+  };
+  names.clear();
+  auto with_a = flatbuffers::Filter(flatbuffers::Prefetched(tables),
+                                    HasLetter('a'));
+  for (auto it = with_a.begin(); it != with_a.end(); ++it) {
+    names += (*it)->name()->str() + " ";
+  }
+  TEST_EQ_STR(names.c_str(), "Barney Wilma ");
+  names.clear();
+  for (auto monster : flatbuffers::Filter(with_a, HasLetter('W'))) {
+    names += monster->name()->str() + " ";
+  }
+  TEST_EQ_STR(names.c_str(), "Wilma ");
+
+  // Both are input iterators, which standard algorithms accept.
+  typedef decltype(with_a.begin()) FilterIterator;
+  typedef flatbuffers::PrefetchIterator<Monster> PrefetchIterator;
+  TEST_EQ((std::is_same<std::iterator_traits<FilterIterator>::iterator_category,
+                        std::input_iterator_tag>::value),
+          true);
+  TEST_EQ(
+      (std::is_same<std::iterator_traits<PrefetchIterator>::iterator_category,
+                    std::input_iterator_tag>::value),
+      true);
+  TEST_EQ(std::distance(with_a.begin(), with_a.end()), 2);
+  TEST_EQ(std::count_if(with_a.begin(), with_a.end(), HasLetter('B')), 1);
+
+  const flatbuffers::Vector<flatbuffers::Offset<Monster>> *none = nullptr;
+  auto empty = flatbuffers::Prefetched(none);
+  TEST_EQ(empty.begin() == empty.end(), true);
+}
+
+void HashTest(const uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  const auto hash = Hash(monster);
+  TEST_EQ(hash, Hash(monster));
+
+  // The object API type hashes like the table, and so does the table
+  // re-serialized from it, though with a different layout.
+  flatbuffers::unique_ptr<MonsterT> native(monster->UnPack());
+  TEST_EQ(Hash(native.get()), hash);
+  TEST_EQ(std::hash<MonsterT>()(*native), static_cast<size_t>(hash));
+  flatbuffers::FlatBufferBuilder fbb;
+  FinishMonsterBuffer(fbb, Monster::Pack(fbb, native.get()));
+  TEST_EQ(Hash(GetMonster(fbb.GetBufferPointer())), hash);
+
+  // Changes anywhere in the tree change the hash.
+  native->hp++;
+  TEST_EQ(Hash(native.get()) != hash, true);
+  native->hp--;
+  native->testarrayoftables[1]->name = "Freddy";
+  const auto renamed = Hash(native.get());
+  TEST_EQ(renamed != hash, true);
+  native->testarrayoftables[1]->name = "Fred";
+  native->test.AsMonster()->name = "Barney";
+  TEST_EQ(Hash(native.get()) != hash, true);
+  TEST_EQ(Hash(native.get()) != renamed, true);
+  native->test.AsMonster()->name = "Fred";
+  native->pos->mutate_z(native->pos->z() + 1);
+  TEST_EQ(Hash(native.get()) != hash, true);
+  native->pos->mutate_z(native->pos->z() - 1);
+  native->inventory.back()++;
+  TEST_EQ(Hash(native.get()) != hash, true);
+  native->inventory.back()--;
+  TEST_EQ(Hash(native.get()), hash);
+
+  // Nested flatbuffers hash by their contents, not their bytes.
+  flatbuffers::FlatBufferBuilder nestedfbb;
+  FinishMonsterBuffer(nestedfbb,
+                      CreateMonster(nestedfbb, nullptr, 150, 80,
+                                    nestedfbb.CreateString("Nested")));
+  native->testnestedflatbuffer.assign(
+      nestedfbb.GetBufferPointer(),
+      nestedfbb.GetBufferPointer() + nestedfbb.GetSize());
+  const auto nested = Hash(native.get());
+  TEST_EQ(nested != hash, true);
+  nestedfbb.Clear();
+  nestedfbb.ForceDefaults(true);
+  FinishMonsterBuffer(nestedfbb,
+                      CreateMonster(nestedfbb, nullptr, 150, 80,
+                                    nestedfbb.CreateString("Nested")));
+  TEST_EQ(native->testnestedflatbuffer.size() != nestedfbb.GetSize(), true);
+  native->testnestedflatbuffer.assign(
+      nestedfbb.GetBufferPointer(),
+      nestedfbb.GetBufferPointer() + nestedfbb.GetSize());
+  TEST_EQ(Hash(native.get()), nested);
+  fbb.Clear();
+  FinishMonsterBuffer(fbb, Monster::Pack(fbb, native.get()));
+  TEST_EQ(Hash(GetMonster(fbb.GetBufferPointer())), nested);
+
+  // Equal objects are deduplicated in unordered containers.
+  StatT stat;
+  stat.id = "a";
+  stat.val = 1;
+  std::unordered_set<StatT> set;
+  set.insert(stat);
+  stat.count = 2;
+  set.insert(stat);
+  stat.count = 0;
+  set.insert(stat);
+  TEST_EQ(set.size(), 2U);
+  TEST_EQ(std::hash<Vec3>()(*native->pos),
+          static_cast<size_t>(Hash(monster->pos())));
+
+  // Scalar vectors hash by value: -0.0 equals 0.0, and floats and bools
+  // hash as in a buffer.
+  std::vector<double> zeros = { 0.0, -0.0 };
+  std::vector<double> more_zeros = { -0.0, 0.0 };
+  TEST_EQ(flatbuffers::HashScalars(zeros),
+          flatbuffers::HashScalars(more_zeros));
+  std::vector<bool> bools = { true, false, true };
+  const uint8_t bool_bytes[] = { 1, 0, 1 };
+  TEST_EQ(flatbuffers::HashScalars(bools),
+          flatbuffers::HashScalars(bool_bytes, 3));
+  std::vector<int32_t> ints(100);
+  for (size_t i = 0; i < ints.size(); i++) ints[i] = static_cast<int32_t>(i);
+  const auto ints_hash = flatbuffers::HashScalars(ints);
+  ints[97] = -1;
+  TEST_EQ(flatbuffers::HashScalars(ints) != ints_hash, true);
+  ints.pop_back();
+  TEST_EQ(flatbuffers::HashScalars(ints) != ints_hash, true);
+}
+
+void StaticLayoutTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto id = fbb.CreateString("static");
+  std::vector<flatbuffers::Offset<Stat>> stats;
+  stats.push_back(CreateStatStaticLayout(fbb, id, -5, 7));
+  stats.push_back(CreateStatStaticLayout(fbb, id, 10, 0));
+  stats.push_back(CreateStat(fbb, id, 1, 2));
+  stats.push_back(CreateStatStaticLayout(fbb, id, 3, 4));
+  // A null offset falls back to CreateStat.
+  stats.push_back(CreateStatStaticLayout(fbb, 0, 6, 1));
+  auto vec = fbb.CreateVector(stats);
+  auto name = fbb.CreateString("m");
+  MonsterBuilder mb(fbb);
+  mb.add_name(name);
+  mb.add_scalar_key_sorted_tables(vec);
+  FinishMonsterBuffer(fbb, mb.Finish());
+
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto tables = GetMonster(fbb.GetBufferPointer())->scalar_key_sorted_tables();
+  TEST_EQ(tables->size(), 5U);
+  TEST_EQ_STR(tables->Get(0)->id()->c_str(), "static");
+  TEST_EQ(tables->Get(0)->val(), -5);
+  TEST_EQ(tables->Get(0)->count(), 7);
+  TEST_EQ_STR(tables->Get(1)->id()->c_str(), "static");
+  TEST_EQ(tables->Get(1)->val(), 10);
+  // Unlike with CreateStat, fields equal to their defaults are present.
+  TEST_EQ(flatbuffers::IsFieldPresent(tables->Get(1), Stat::VT_COUNT), true);
+  TEST_EQ(flatbuffers::IsFieldPresent(tables->Get(2), Stat::VT_COUNT), true);
+  TEST_EQ(tables->Get(3)->val(), 3);
+  TEST_EQ(tables->Get(3)->count(), 4);
+  TEST_EQ(tables->Get(4)->id() == nullptr, true);
+  TEST_EQ(tables->Get(4)->val(), 6);
+  TEST_EQ(tables->Get(4)->count(), 1);
+  // All static layout tables share one vtable.
+  auto vtable = [&](flatbuffers::uoffset_t i) {
+    return reinterpret_cast<const flatbuffers::Table *>(tables->Get(i))
+        ->GetVTable();
+  };
+  TEST_EQ(vtable(0) == vtable(1), true);
+  TEST_EQ(vtable(0) == vtable(3), true);
+
+  // The shared vtable is forgotten with the buffer it was written to.
+  fbb.Release();
+  auto id2 = fbb.CreateString("again");
+  fbb.Finish(CreateStatStaticLayout(fbb, id2, 8, 9));
+  flatbuffers::Verifier verifier2(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(verifier2.VerifyBuffer<Stat>(nullptr), true);
+  auto stat = flatbuffers::GetRoot<Stat>(fbb.GetBufferPointer());
+  TEST_EQ_STR(stat->id()->c_str(), "again");
+  TEST_EQ(stat->val(), 8);
+  TEST_EQ(stat->count(), 9);
 }
 
 // Prefix a FlatBuffer with a size field.
@@ -684,6 +1035,52 @@ void JsonEnumsTest() {
   TEST_EQ(std::string::npos != future_json.find("color: 13"), true);
 }
 
+void JsonDirectScalarTablesTest() {
+  const char *schema =
+      "enum E:byte { A, B }\n"
+      "table Scalars { a:int; b:double = 1; c:bool; d:E = B; e:short = null; "
+      "f:ulong; }\n"
+      "table Root { s:Scalars; v:[Scalars]; name:string; }\n"
+      "root_type Root;\n";
+  const char *json =
+      "{ name: \"x\", s: { c: true, a: 7, e: 3, f: 1 },"
+      "  v: [ { b: 2.5, d: A }, { e: null }, {} ] }";
+
+  flatbuffers::Parser sorted;
+  TEST_EQ(sorted.Parse(schema), true);
+  TEST_EQ(sorted.ParseJson(json), true);
+
+  flatbuffers::Parser direct;
+  direct.opts.json_direct_scalar_tables = true;
+  TEST_EQ(direct.Parse(schema), true);
+  TEST_EQ(direct.ParseJson(json), true);
+
+  // Layouts may differ, but the contents must not.
+  std::string sorted_text, direct_text;
+  TEST_EQ(GenerateText(sorted, sorted.builder_.GetBufferPointer(),
+                       &sorted_text),
+          true);
+  TEST_EQ(GenerateText(direct, direct.builder_.GetBufferPointer(),
+                       &direct_text),
+          true);
+  TEST_EQ_STR(sorted_text.c_str(), direct_text.c_str());
+  TEST_NOTNULL(strstr(direct_text.c_str(), "e: 3"));
+
+  // An optional scalar that was given a value is stored even if it is 0.
+  TEST_EQ(direct.ParseJson("{ s: { e: 0 } }"), true);
+  auto root = flatbuffers::GetRoot<flatbuffers::Table>(
+      direct.builder_.GetBufferPointer());
+  auto s = root->GetPointer<const flatbuffers::Table *>(4);
+  TEST_NOTNULL(s);
+  TEST_EQ(s->CheckField(12), true);
+  TEST_EQ(s->CheckField(4), false);
+
+  TEST_EQ(direct.ParseJson("{ s: { a: 1, a: 2 } }"), false);
+  TEST_NOTNULL(strstr(direct.error_.c_str(), "field set more than once: a"));
+  TEST_EQ(direct.ParseJson("{ s: { z: 1 } }"), false);
+  TEST_NOTNULL(strstr(direct.error_.c_str(), "unknown field: z"));
+}
+
 #if defined(FLATBUFFERS_HAS_NEW_STRTOD) && (FLATBUFFERS_HAS_NEW_STRTOD > 0)
 // The IEEE-754 quiet_NaN is not simple binary constant.
 // All binary NaN bit strings have all the bits of the biased exponent field E
@@ -895,6 +1292,17 @@ void ParseAndGenerateTextTest(bool binary) {
   TEST_EQ_STR(jsongen_utf8.c_str(), jsonfile_utf8.c_str());
 }
 
+// Counts the buffers a builder allocates.
+class CountingAllocator : public flatbuffers::DefaultAllocator {
+ public:
+  CountingAllocator() : allocations(0) {}
+  uint8_t *allocate(size_t size) FLATBUFFERS_OVERRIDE {
+    allocations++;
+    return flatbuffers::DefaultAllocator::allocate(size);
+  }
+  int allocations;
+};
+
 void ReflectionTest(uint8_t *flatbuf, size_t length) {
   // Load a binary schema.
   std::string bfbsfile;
@@ -973,6 +1381,36 @@ void ReflectionTest(uint8_t *flatbuf, size_t length) {
                                     *test3_object->fields()->LookupByKey("a")),
           10);
 
+  // Or resolve paths to fields once, and access them directly.
+  flatbuffers::FieldPath pos_z(schema, *root_table, "pos.z");
+  TEST_EQ(pos_z.ok(), true);
+  TEST_EQ(pos_z.Get<float>(root), 3.0f);
+  flatbuffers::FieldPath test3_a(schema, *root_table, "pos.test3.a");
+  TEST_EQ(test3_a.GetI(root), 10);
+  flatbuffers::FieldPath name_path(schema, *root_table, "name");
+  TEST_EQ_STR(name_path.GetS(root)->c_str(), "MyMonster");
+  flatbuffers::FieldPath enemy_hp(schema, *root_table, "enemy.hp");
+  TEST_EQ(enemy_hp.GetAddressOf(root) == nullptr, true);
+  TEST_EQ(enemy_hp.Get<int16_t>(root), 100);
+  TEST_EQ(enemy_hp.Set<int16_t>(&root, 1), false);
+  TEST_EQ(flatbuffers::FieldPath(schema, *root_table, "pos.w").ok(), false);
+  TEST_EQ(flatbuffers::FieldPath(schema, *root_table, "hp.x").ok(), false);
+
+  // Read a field of all tables in a vector at once.
+  typedef flatbuffers::Offset<flatbuffers::Table> TableOffset;
+  auto &tables = *flatbuffers::GetFieldV<TableOffset>(
+      root, *fields->LookupByKey("testarrayoftables"));
+  double column[3];
+  TEST_EQ(flatbuffers::ExtractColumn(tables, hp_field,
+                                     flatbuffers::span<double>(column, 3)),
+          true);
+  TEST_EQ(column[0], 1000.0);  // Barney.
+  TEST_EQ(column[1], 100.0);   // Fred, default.
+  TEST_EQ(column[2], 100.0);   // Wilma, default.
+  TEST_EQ(flatbuffers::ExtractColumn(tables, *fields->LookupByKey("name"),
+                                     flatbuffers::span<double>(column, 3)),
+          false);
+
   // We can also modify it.
   flatbuffers::SetField<uint16_t>(&root, hp_field, 200);
   hp = flatbuffers::GetFieldI<uint16_t>(root, hp_field);
@@ -1066,6 +1504,64 @@ void ReflectionTest(uint8_t *flatbuf, size_t length) {
   SetFieldT(*rroot, name_field, string_ptr);
   TEST_EQ_STR(GetFieldS(**rroot, name_field)->c_str(), "hank");
 
+  // Also replace a table.
+  flatbuffers::FlatBufferBuilder tablefbb;
+  auto barney_name = tablefbb.CreateString("Barney");
+  MonsterBuilder barney_builder(tablefbb);
+  barney_builder.add_name(barney_name);
+  barney_builder.add_hp(2000);
+  tablefbb.Finish(barney_builder.Finish());
+  auto barney_ptr = flatbuffers::AddFlatBuffer(
+      resizingbuf, tablefbb.GetBufferPointer(), tablefbb.GetSize());
+  flatbuffers::GetFieldV<flatbuffers::Offset<flatbuffers::Table>>(
+      **rroot, *fields->LookupByKey("testarrayoftables"))
+      ->MutateOffset(0, barney_ptr);
+
+  // The old name and table are unreachable now, so compacting the buffer
+  // removes them.
+  flatbuffers::CompactReport report;
+  TEST_EQ(flatbuffers::Compact(schema, &resizingbuf, nullptr, &report), true);
+  TEST_EQ(report.new_size, resizingbuf.size());
+  TEST_EQ(report.old_size - report.new_size >= strlen("totally new string"),
+          true);
+  TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(),
+                              flatbuffers::vector_data(resizingbuf),
+                              resizingbuf.size()),
+          true);
+  auto compacted = GetMonster(flatbuffers::vector_data(resizingbuf));
+  TEST_EQ_STR(compacted->name()->c_str(), "hank");
+  TEST_EQ_STR(compacted->testarrayofstring()->Get(2)->c_str(), "hank");
+  TEST_EQ(compacted->inventory()->size(), 110U);
+  TEST_EQ(compacted->inventory()->Get(109), 50);
+  TEST_EQ(compacted->testarrayoftables()->Get(0)->hp(), 2000);
+  TEST_EQ_STR(compacted->testarrayoftables()->Get(2)->name()->c_str(),
+              "Wilma");
+  // Compacting again finds nothing more to remove.
+  TEST_EQ(flatbuffers::Compact(schema, &resizingbuf, nullptr, &report), true);
+  TEST_EQ(report.old_size, report.new_size);
+
+  // Compacting also merges identical vtables.
+  flatbuffers::FlatBufferBuilder dupfbb;
+  dupfbb.DedupVtables(false);
+  flatbuffers::Offset<Monster> dup_monsters[2] = {
+    CreateMonster(dupfbb, nullptr, 0, 0, dupfbb.CreateString("a")),
+    CreateMonster(dupfbb, nullptr, 0, 0, dupfbb.CreateString("b"))
+  };
+  FinishMonsterBuffer(
+      dupfbb, CreateMonster(dupfbb, nullptr, 0, 0, dupfbb.CreateString("c"), 0,
+                            Color_Blue, Any_NONE, 0, 0, 0,
+                            dupfbb.CreateVector(dup_monsters, 2)));
+  std::vector<uint8_t> dupbuf(dupfbb.GetBufferPointer(),
+                              dupfbb.GetBufferPointer() + dupfbb.GetSize());
+  TEST_EQ(flatbuffers::Compact(schema, &dupbuf, nullptr, &report), true);
+  TEST_EQ(report.vtables_merged, 1U);
+  TEST_EQ(report.new_size < report.old_size, true);
+  TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(),
+                              flatbuffers::vector_data(dupbuf), dupbuf.size()),
+          true);
+  auto dup_monster = GetMonster(flatbuffers::vector_data(dupbuf));
+  TEST_EQ_STR(dup_monster->testarrayoftables()->Get(1)->name()->c_str(), "b");
+
   // Using reflection, rather than mutating binary FlatBuffers, we can also copy
   // tables and other things out of other FlatBuffers into a FlatBufferBuilder,
   // either part or whole.
@@ -1080,6 +1576,159 @@ void ReflectionTest(uint8_t *flatbuf, size_t length) {
   TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(),
                               fbb.GetBufferPointer(), fbb.GetSize()),
           true);
+
+  // The same, but measuring the copy first, and copying vectors of tables in
+  // chunks, run in reverse order to show they don't depend on each other.
+  flatbuffers::TableCopier copier(schema, true);
+  size_t chunks_run = 0;
+  copier.SetParallelism(
+      [&](size_t num_chunks, const std::function<void(size_t)> &task) {
+        for (size_t i = num_chunks; i > 0; i--) task(i - 1);
+        chunks_run += num_chunks;
+      },
+      2, 2);
+  // A builder of the measured size never grows.
+  auto &source = *flatbuffers::GetAnyRoot(flatbuf);
+  auto measured = copier.Measure(*root_table, source);
+  CountingAllocator allocator;
+  flatbuffers::FlatBufferBuilder pfbb(measured, &allocator);
+  pfbb.Finish(copier.CopyTable(pfbb, *root_table, source), MonsterIdentifier());
+  TEST_EQ(chunks_run > 0, true);
+  TEST_EQ(allocator.allocations, 1);
+  TEST_EQ(pfbb.GetSize() <= measured, true);
+  AccessFlatBufferTest(pfbb.GetBufferPointer(), pfbb.GetSize());
+  TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(),
+                              pfbb.GetBufferPointer(), pfbb.GetSize()),
+          true);
+
+  // The chunks can run on threads of their own, with the same result.
+  copier.SetParallelism(
+      [](size_t num_chunks, const std::function<void(size_t)> &task) {
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < num_chunks; i++)
+          threads.push_back(std::thread(task, i));
+        task(0);
+        for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+      },
+      3, 2);
+  flatbuffers::FlatBufferBuilder tfbb(copier.Measure(*root_table, source));
+  tfbb.Finish(copier.CopyTable(tfbb, *root_table, source), MonsterIdentifier());
+  AccessFlatBufferTest(tfbb.GetBufferPointer(), tfbb.GetSize());
+  TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(),
+                              tfbb.GetBufferPointer(), tfbb.GetSize()),
+          true);
+}
+
+void ResizeBatchTest(uint8_t *flatbuf, size_t length) {
+  std::string bfbsfile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "monster_test.bfbs").c_str(),
+                                true, &bfbsfile),
+          true);
+  auto &schema = *reflection::GetSchema(bfbsfile.c_str());
+
+  // Record edits all over the buffer, growing and shrinking, then apply them
+  // at once.
+  std::vector<uint8_t> resizingbuf(flatbuf, flatbuf + length);
+  auto monster = GetMonster(flatbuffers::vector_data(resizingbuf));
+  flatbuffers::ResizeBatch batch(schema, &resizingbuf);
+  batch.SetString(monster->name(), "a much longer name than before");
+  batch.SetString(monster->testarrayoftables()->Get(0)->name(), "B");
+  batch.SetString(monster->testarrayoftables()->Get(2)->name(), "Wilma!");
+  batch.SetString(monster->testarrayofstring()->Get(1), "frederick");
+  batch.SetString(monster->testarrayofstring()->Get(1), "fredrick");
+  batch.ResizeVector<uint8_t>(monster->inventory(), 3, 0);
+  auto nested_size = monster->testnestedflatbuffer()->size();
+  batch.ResizeVector<uint8_t>(monster->testnestedflatbuffer(), nested_size + 5,
+                              7);
+  batch.ResizeVector<flatbuffers::Offset<flatbuffers::String>>(
+      monster->testarrayofstring2(), 1, 0);
+  TEST_EQ(batch.size(), 8U);
+  batch.Apply();
+  TEST_EQ(batch.size(), 0U);
+
+  flatbuffers::Verifier verifier(flatbuffers::vector_data(resizingbuf),
+                                 resizingbuf.size());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(),
+                              flatbuffers::vector_data(resizingbuf),
+                              resizingbuf.size()),
+          true);
+  monster = GetMonster(flatbuffers::vector_data(resizingbuf));
+  TEST_EQ_STR(monster->name()->c_str(), "a much longer name than before");
+  TEST_EQ(monster->hp(), 80);
+  auto tables = monster->testarrayoftables();
+  TEST_EQ_STR(tables->Get(0)->name()->c_str(), "B");
+  TEST_EQ(tables->Get(0)->hp(), 1000);
+  TEST_EQ_STR(tables->Get(1)->name()->c_str(), "Fred");
+  TEST_EQ_STR(tables->Get(2)->name()->c_str(), "Wilma!");
+  TEST_EQ_STR(monster->testarrayofstring()->Get(0)->c_str(), "bob");
+  // These two share a string.
+  TEST_EQ_STR(monster->testarrayofstring()->Get(1)->c_str(), "fredrick");
+  TEST_EQ_STR(monster->testarrayofstring()->Get(3)->c_str(), "fredrick");
+  TEST_EQ(monster->inventory()->size(), 3U);
+  TEST_EQ(monster->inventory()->Get(2), 2);
+  TEST_EQ(monster->testnestedflatbuffer()->size(), nested_size + 5);
+  TEST_EQ(monster->testnestedflatbuffer()->Get(nested_size + 4), 7);
+  TEST_EQ_STR(monster->testnestedflatbuffer_nested_root()->name()->c_str(),
+              "NestedMonster");
+  TEST_EQ(monster->testarrayofstring2()->size(), 1U);
+  TEST_EQ_STR(monster->testarrayofstring2()->Get(0)->c_str(), "jane");
+  TEST_EQ_STR(monster->test_as_Monster()->name()->c_str(), "Fred");
+}
+
+void DiffPatchTest(const uint8_t *flatbuf) {
+  std::string bfbsfile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "monster_test.bfbs").c_str(),
+                                true, &bfbsfile),
+          true);
+  auto &schema = *reflection::GetSchema(bfbsfile.c_str());
+
+  // Change a few fields, in nested tables too, add and remove some, and
+  // change the type of the union.
+  auto monster = GetMonster(flatbuf)->UnPack();
+  monster->hp = 20;
+  monster->name = "Changed";
+  monster->testarrayoftables[1]->name = "Freddy";
+  monster->enemy.reset(new MonsterT());
+  monster->enemy->name = "Enemy";
+  monster->testnestedflatbuffer.clear();
+  TestSimpleTableWithEnumT simple;
+  simple.color = Color_Green;
+  monster->test.Set(simple);
+  flatbuffers::FlatBufferBuilder newfbb;
+  FinishMonsterBuffer(newfbb, Monster::Pack(newfbb, monster));
+  delete monster;
+
+  flatbuffers::FlatBufferBuilder patchfbb;
+  flatbuffers::Diff(schema, flatbuf, newfbb.GetBufferPointer(), &patchfbb);
+  flatbuffers::Verifier verifier(patchfbb.GetBufferPointer(),
+                                 patchfbb.GetSize());
+  TEST_EQ(reflection::patch::VerifyTablePatchBuffer(verifier), true);
+  TEST_EQ(patchfbb.GetSize() < newfbb.GetSize(), true);
+  auto patch = reflection::patch::GetTablePatch(patchfbb.GetBufferPointer());
+  TEST_EQ(patch->fields()->size(), 7U);
+
+  flatbuffers::FlatBufferBuilder patchedfbb;
+  flatbuffers::ApplyPatch(schema, flatbuf, patchfbb.GetBufferPointer(),
+                          &patchedfbb);
+  TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(),
+                              patchedfbb.GetBufferPointer(),
+                              patchedfbb.GetSize()),
+          true);
+  TEST_EQ(MonsterBufferHasIdentifier(patchedfbb.GetBufferPointer()), true);
+  TEST_EQ_STR(flatbuffers::FlatBufferToString(patchedfbb.GetBufferPointer(),
+                                              MonsterTypeTable())
+                  .c_str(),
+              flatbuffers::FlatBufferToString(newfbb.GetBufferPointer(),
+                                              MonsterTypeTable())
+                  .c_str());
+
+  // Nothing changed, nothing to patch.
+  flatbuffers::FlatBufferBuilder emptyfbb;
+  flatbuffers::Diff(schema, flatbuf, flatbuf, &emptyfbb);
+  auto emptypatch =
+      reflection::patch::GetTablePatch(emptyfbb.GetBufferPointer());
+  TEST_EQ(emptypatch->fields()->size(), 0U);
 }
 
 void MiniReflectFlatBuffersTest(uint8_t *flatbuf) {
@@ -1115,6 +1764,18 @@ void MiniReflectFlatBuffersTest(uint8_t *flatbuf) {
       "scalar_key_sorted_tables: [ { id: \"miss\" } ] "
       "}");
 
+  // The text can also be appended to a reused buffer, with vectors cut short.
+  std::string text = "monster: ";
+  flatbuffers::FlatBufferToSink(text, flatbuf, Monster::MiniReflectTypeTable(),
+                                false, true, 3);
+  TEST_EQ(text.find("monster: { pos: { x: 1.0, y: 2.0, z: 3.0, "), 0);
+  TEST_NOTNULL(strstr(text.c_str(), "inventory: [ 0, 1, 2, ... 7 more ], "));
+  TEST_NOTNULL(strstr(text.c_str(),
+                      "testarrayofstring: [ \"bob\", \"fred\", \"bob\", "
+                      "... 1 more ], "));
+  TEST_NOTNULL(strstr(text.c_str(), "test4: [ { a: 10, b: 20 }, { a: 30, "
+                                    "b: 40 } ], "));
+
   Test test(16, 32);
   Vec3 vec(1, 2, 3, 1.5, Color_Red, test);
   flatbuffers::FlatBufferBuilder vec_builder;
@@ -2193,6 +2854,209 @@ void GenerateTableTextTest() {
   TEST_EQ_STR(jsongen.c_str(), "{a: 10,b: 20}");
 }
 
+void GeneratedJsonPrinterTest() {
+  std::string schemafile;
+  std::string jsonfile;
+  bool ok =
+      flatbuffers::LoadFile((test_data_path + "monster_test.fbs").c_str(),
+                            false, &schemafile) &&
+      flatbuffers::LoadFile((test_data_path + "monsterdata_test.json").c_str(),
+                            false, &jsonfile);
+  TEST_EQ(ok, true);
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(test_data_path, "include_test");
+  const char *include_directories[] = { test_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  flatbuffers::Parser parser;
+  ok = parser.Parse(schemafile.c_str(), include_directories) &&
+       parser.ParseJson(jsonfile.c_str());
+  TEST_EQ(ok, true);
+  std::vector<uint8_t> original(
+      parser.builder_.GetBufferPointer(),
+      parser.builder_.GetBufferPointer() + parser.builder_.GetSize());
+
+  // The generated printer needs no schema, and writes compact JSON.
+  std::string json;
+  TEST_EQ(ToJson(GetMonster(original.data()), json), true);
+  TEST_EQ(json.find("{\"pos\":{\"x\":1.0,\"y\":2.0,\"z\":3.0,"), 0);
+  TEST_NOTNULL(strstr(json.c_str(), "\"name\":\"MyMonster\""));
+
+  // It must describe the same data as the text generator does.
+  TEST_EQ(parser.ParseJson(json.c_str()), true);
+  std::string expected, actual;
+  TEST_EQ(GenerateText(parser, original.data(), &expected), true);
+  TEST_EQ(GenerateText(parser, parser.builder_.GetBufferPointer(), &actual),
+          true);
+  TEST_EQ_STR(actual.c_str(), expected.c_str());
+
+  // Non-finite numbers, which JSON cannot represent, are written as null.
+  json.clear();
+  flatbuffers::JsonAppendNumber(json, std::numeric_limits<float>::quiet_NaN());
+  json += ",";
+  flatbuffers::JsonAppendNumber(json, -infinity_d);
+  json += ",";
+  flatbuffers::JsonAppendNumber(json, infinity_f);
+  json += ",";
+  flatbuffers::JsonAppendNumber(json, 0.5);
+  TEST_EQ_STR(json.c_str(), "null,null,null,0.5");
+}
+
+void GeneratedJsonParserTest() {
+  std::string schemafile;
+  std::string jsonfile;
+  bool ok =
+      flatbuffers::LoadFile((test_data_path + "monster_test.fbs").c_str(),
+                            false, &schemafile) &&
+      flatbuffers::LoadFile((test_data_path + "monsterdata_test.json").c_str(),
+                            false, &jsonfile);
+  TEST_EQ(ok, true);
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(test_data_path, "include_test");
+  const char *include_directories[] = { test_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse(schemafile.c_str(), include_directories), true);
+
+  // The generated parser needs no schema, and must build the same data as
+  // the schema parser does. The second document has a union value before
+  // its type, bit flags, escapes, a flexbuffer, a nested flatbuffer and a
+  // null table.
+  const char *documents[] = {
+    jsonfile.c_str(),
+    "{ name: \"N\\u00e9\\n\", test: { name: \"Fred\", hp: 7 },"
+    "  test_type: Monster, color: \"Red Green\", inventory: [1, 2,],"
+    "  flex: { a: [1, 2.5, \"x\", true, null] },"
+    "  testnestedflatbuffer: { name: \"Inner\" },"
+    "  testhashu32_fnv1: \"hashed\", /* comment */ testf: \"1.5\","
+    "  enemy: null }",
+  };
+  for (size_t i = 0; i < sizeof(documents) / sizeof(documents[0]); i++) {
+    TEST_EQ(parser.ParseJson(documents[i]), true);
+    std::string expected;
+    TEST_EQ(GenerateText(parser, parser.builder_.GetBufferPointer(), &expected),
+            true);
+
+    flatbuffers::FlatBufferBuilder fbb;
+    flatbuffers::Offset<Monster> root;
+    std::string error;
+    TEST_EQ(FromJson(documents[i], fbb, &root, &error), true);
+    TEST_EQ_STR(error.c_str(), "");
+    FinishMonsterBuffer(fbb, root);
+    flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+    std::string actual;
+    TEST_EQ(GenerateText(parser, fbb.GetBufferPointer(), &actual), true);
+    TEST_EQ_STR(actual.c_str(), expected.c_str());
+  }
+
+  // Errors report where they happened.
+  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::Offset<Monster> root;
+  std::string error;
+  TEST_EQ(FromJson("{ name: \"x\",\n  nope: 1 }", fbb, &root, &error), false);
+  TEST_EQ_STR(error.c_str(), "2:7: unknown field");
+  TEST_EQ(FromJson("{ hp: 1 }", fbb, &root, &error), false);
+  TEST_EQ_STR(error.c_str(), "1:9: required field is missing: name in Monster");
+  TEST_EQ(FromJson("{ name: \"x\", color: Purple }", fbb, &root, &error),
+          false);
+  TEST_EQ_STR(error.c_str(), "1:26: unknown enum value");
+  TEST_EQ(FromJson("{ name: \"x\", hp: 1, hp: 2 }", fbb, &root, &error),
+          false);
+  TEST_EQ_STR(error.c_str(), "1:23: field set more than once");
+  flatbuffers::Offset<Stat> stat;
+  TEST_EQ(FromJson("{ id: \"a\", id: \"b\" }", fbb, &stat, &error), false);
+  TEST_EQ_STR(error.c_str(), "1:14: field set more than once");
+
+  // null is checked like any other value, and only leaves out optional
+  // fields.
+  TEST_EQ(FromJson("{ name: \"x\", nope: null }", fbb, &root, &error), false);
+  TEST_EQ_STR(error.c_str(), "1:18: unknown field");
+  TEST_EQ(FromJson("{ name: \"x\", name: null }", fbb, &root, &error), false);
+  TEST_EQ_STR(error.c_str(), "1:18: field set more than once");
+  TEST_EQ(FromJson("{ name: \"x\", hp: null }", fbb, &root, &error), false);
+  TEST_EQ_STR(error.c_str(), "1:21: null for a non-optional scalar");
+  TEST_EQ(FromJson("{ name: null }", fbb, &root, &error), false);
+  TEST_EQ_STR(error.c_str(),
+              "1:14: required field is missing: name in Monster");
+}
+
+void SharedSchemaParserTest() {
+  std::string schemafile;
+  std::string jsonfile;
+  bool ok =
+      flatbuffers::LoadFile((test_data_path + "monster_test.fbs").c_str(),
+                            false, &schemafile) &&
+      flatbuffers::LoadFile((test_data_path + "monsterdata_test.golden").c_str(),
+                            false, &jsonfile);
+  TEST_EQ(ok, true);
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(test_data_path, "include_test");
+  const char *include_directories[] = { test_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  flatbuffers::Parser schema;
+  TEST_EQ(schema.Parse(schemafile.c_str(), include_directories), true);
+  TEST_EQ(schema.ParseJson(jsonfile.c_str()), true);
+
+  // Several parsers can be backed by one schema without parsing it again.
+  for (int i = 0; i < 2; i++) {
+    flatbuffers::Parser parser(schema, schema.opts);
+    TEST_EQ(parser.ParseJson(jsonfile.c_str()), true);
+    TEST_EQ(parser.builder_.GetSize(), schema.builder_.GetSize());
+    TEST_EQ(memcmp(parser.builder_.GetBufferPointer(),
+                   schema.builder_.GetBufferPointer(),
+                   parser.builder_.GetSize()),
+            0);
+    std::string jsongen;
+    TEST_EQ(GenerateText(parser, parser.builder_.GetBufferPointer(), &jsongen),
+            true);
+    TEST_EQ_STR(jsongen.c_str(), jsonfile.c_str());
+    // The borrowed definitions are read-only.
+    TEST_EQ(parser.Parse("table X { a:int; }"), false);
+  }
+  // Several parsers can share one schema on different threads.
+  bool same[2] = { false, false };
+  auto session = [&](bool *result) {
+    *result = true;
+    for (int i = 0; i < 20; i++) {
+      flatbuffers::Parser parser(schema, schema.opts);
+      *result = *result && parser.ParseJson(jsonfile.c_str()) &&
+                parser.builder_.GetSize() == schema.builder_.GetSize() &&
+                !memcmp(parser.builder_.GetBufferPointer(),
+                        schema.builder_.GetBufferPointer(),
+                        parser.builder_.GetSize());
+    }
+  };
+  std::thread other(session, &same[0]);
+  session(&same[1]);
+  other.join();
+  TEST_EQ(same[0], true);
+  TEST_EQ(same[1], true);
+
+  // Enum values qualified by their type are looked up in the schema.
+  flatbuffers::Parser parser(schema, schema.opts);
+  TEST_EQ(parser.ParseJson("{ name: \"x\", hp: \"Color.Blue\" }"), true);
+  auto monster =
+      MyGame::Example::GetMonster(parser.builder_.GetBufferPointer());
+  TEST_EQ(monster->hp(), MyGame::Example::Color_Blue);
+
+  // Nothing changes the borrowed definitions.
+  TEST_EQ(parser.SetRootType("Stat"), false);
+  TEST_EQ(parser.ParseFlexBuffer("{ a: 1 }", nullptr, &parser.flex_builder_),
+          false);
+  flatbuffers::Parser bfbs;
+  TEST_EQ(bfbs.Parse(schemafile.c_str(), include_directories), true);
+  bfbs.Serialize();
+  TEST_EQ(parser.Deserialize(bfbs.builder_.GetBufferPointer(),
+                             bfbs.builder_.GetSize()),
+          false);
+  TEST_EQ(parser.structs_.vec.empty(), true);
+  TEST_EQ(parser.root_struct_def_, schema.root_struct_def_);
+
+  // The schema is still intact after the sessions are gone.
+  TEST_EQ(schema.ParseJson(jsonfile.c_str()), true);
+  TEST_NOTNULL(schema.LookupStruct("MyGame.Example.Monster"));
+}
+
 template<typename T>
 void NumericUtilsTestInteger(const char *lower, const char *upper) {
   T x;
@@ -2263,6 +3127,65 @@ void UnicodeTest() {
               "\\u5225\\u30B5\\u30A4\\u30C8\\u20AC\\u0080\\uD83D\\uDE0E\"}");
 }
 
+void StringTokenTest() {
+  // Escape-free strings are copied from the source text, escaped ones from
+  // the unescaped token; both must survive reading the next token.
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table T { a:string; b:string (shared); c:[string]; }"
+                       "root_type T;"
+                       "{ a: \"plain text\", b: 'x\\ty\\\"z',"
+                       "  c: [\"\", \"\\u20AC and more\", \"end\"] }"),
+          true);
+  std::string jsongen;
+  parser.opts.indent_step = -1;
+  TEST_EQ(GenerateText(parser, parser.builder_.GetBufferPointer(), &jsongen),
+          true);
+  TEST_EQ_STR(jsongen.c_str(),
+              "{a: \"plain text\",b: \"x\\ty\\\"z\","
+              "c: [\"\",\"\\u20AC and more\",\"end\"]}");
+}
+
+struct ChunkedTextSink : public flatbuffers::TextSink {
+  explicit ChunkedTextSink(size_t _max_chunks)
+      : chunks(0), max_chunks(_max_chunks) {}
+  bool Write(const char *str, size_t size) FLATBUFFERS_OVERRIDE {
+    if (chunks == max_chunks) return false;
+    chunks++;
+    text.append(str, size);
+    return true;
+  }
+  std::string text;
+  size_t chunks;
+  size_t max_chunks;
+};
+
+void GenerateTextSinkTest() {
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table T { name:string; v:[int]; }"
+                       "root_type T;"),
+          true);
+  std::string json = "{ name: \"big\", v: [";
+  for (int i = 0; i < 100000; i++) {
+    if (i) json += ", ";
+    json += flatbuffers::NumToString(i * 7919);
+  }
+  json += "] }";
+  TEST_EQ(parser.ParseJson(json.c_str()), true);
+  auto buf = parser.builder_.GetBufferPointer();
+
+  std::string expected;
+  TEST_EQ(GenerateText(parser, buf, &expected), true);
+  ChunkedTextSink sink(static_cast<size_t>(-1));
+  TEST_EQ(GenerateText(parser, buf, &sink), true);
+  TEST_EQ(sink.chunks > 1, true);
+  TEST_EQ_STR(sink.text.c_str(), expected.c_str());
+
+  // A failing sink stops the generation.
+  ChunkedTextSink failing(1);
+  TEST_EQ(GenerateText(parser, buf, &failing), false);
+  TEST_EQ(failing.chunks, 1);
+}
+
 void UnicodeTestAllowNonUTF8() {
   flatbuffers::Parser parser;
   parser.opts.allow_non_utf8 = true;
@@ -2777,6 +3700,16 @@ void UnionVectorTest() {
               "  ]\n"
               "}");
 
+  // A copy of a visitor writes to its own string.
+  flatbuffers::ToStringVisitor copy(visitor);
+  copy.s.clear();
+  IterateFlatBuffer(fbb.GetBufferPointer(), MovieTypeTable(), &copy);
+  TEST_EQ_STR(copy.s.c_str(), visitor.s.c_str());
+  flatbuffers::ToStringVisitor assigned(" ");
+  assigned = visitor;
+  IterateFlatBuffer(fbb.GetBufferPointer(), MovieTypeTable(), &assigned);
+  TEST_EQ(assigned.s.size(), 2 * visitor.s.size());
+
   // Generate text using parsed schema.
   std::string jsongen;
   auto result = GenerateText(parser, fbb.GetBufferPointer(), &jsongen);
@@ -2845,6 +3778,211 @@ void ConformTest() {
   test_conform(parser, "enum E:byte { B, A }", "values differ for enum");
 }
 
+// Input files served from memory, for tests that install these with
+// SetLoadFileFunction and SetFileExistsFunction.
+static std::map<std::string, std::string> memory_files;
+
+static bool MemoryLoadFile(const char *name, bool binary, std::string *buf) {
+  (void)binary;
+  auto it = memory_files.find(name);
+  if (it == memory_files.end()) return false;
+  *buf = it->second;
+  return true;
+}
+
+static bool MemoryFileExists(const char *name) {
+  return memory_files.count(name) != 0;
+}
+
+// A parser reused for several schemas only parses the includes that have
+// changed since it last parsed them, along with the files depending on them.
+void IncludeCacheTest() {
+  auto load_file = flatbuffers::SetLoadFileFunction(MemoryLoadFile);
+  auto file_exists = flatbuffers::SetFileExistsFunction(MemoryFileExists);
+  memory_files["inc.fbs"] = "table Inc { a:int; }";
+  memory_files["other.fbs"] = "table Other { o:int; }";
+  memory_files["a.fbs"] =
+      "include \"inc.fbs\"; include \"other.fbs\"; table A { i:Inc; }";
+  memory_files["b.fbs"] = "include \"inc.fbs\"; table B { i:Inc; }";
+
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse(memory_files["a.fbs"].c_str(), nullptr, "a.fbs"),
+          true);
+  auto inc = parser.LookupStruct("Inc");
+  auto other = parser.LookupStruct("Other");
+  TEST_NOTNULL(inc);
+  // The unchanged include is not parsed again.
+  TEST_EQ(parser.Parse(memory_files["b.fbs"].c_str(), nullptr, "b.fbs"),
+          true);
+  TEST_EQ(parser.LookupStruct("Inc") == inc, true);
+  TEST_EQ(parser.LookupStruct("B")->fields.Lookup("i")->value.type.struct_def ==
+              inc,
+          true);
+
+  // A changed include is parsed again, and so are the files including it,
+  // even those that the parsed file doesn't include.
+  memory_files["inc.fbs"] = "table Inc { a:int; b:int; }";
+  TEST_EQ(parser.Parse(memory_files["b.fbs"].c_str(), nullptr, "b.fbs"),
+          true);
+  inc = parser.LookupStruct("Inc");
+  TEST_NOTNULL(inc);
+  TEST_NOTNULL(inc->fields.Lookup("b"));
+  TEST_EQ(parser.LookupStruct("B")->fields.Lookup("i")->value.type.struct_def ==
+              inc,
+          true);
+  TEST_EQ(parser.LookupStruct("A")->fields.Lookup("i")->value.type.struct_def ==
+              inc,
+          true);
+  TEST_EQ(parser.LookupStruct("Other") == other, true);
+  TEST_EQ(parser.Parse(memory_files["a.fbs"].c_str(), nullptr, "a.fbs"),
+          true);
+  TEST_NOTNULL(parser.LookupStruct("A"));
+  TEST_EQ(parser.LookupStruct("Other") == other, true);
+
+  // A changed root file is parsed again along with the files including it.
+  memory_files["c.fbs"] = "include \"a.fbs\"; table C { a:A; }";
+  TEST_EQ(parser.Parse(memory_files["c.fbs"].c_str(), nullptr, "c.fbs"),
+          true);
+  memory_files["a.fbs"] =
+      "include \"inc.fbs\"; include \"other.fbs\"; table A { i:Inc; j:int; }";
+  TEST_EQ(parser.Parse(memory_files["a.fbs"].c_str(), nullptr, "a.fbs"),
+          true);
+  auto a = parser.LookupStruct("A");
+  TEST_NOTNULL(a->fields.Lookup("j"));
+  TEST_EQ(a->generated, false);
+  TEST_EQ(parser.LookupStruct("C")->fields.Lookup("a")->value.type.struct_def ==
+              a,
+          true);
+
+  flatbuffers::SetLoadFileFunction(load_file);
+  flatbuffers::SetFileExistsFunction(file_exists);
+  memory_files.clear();
+
+  // Includes on disk are only read again if their size or time changed.
+  auto inc_path = test_data_path + "include_cache_inc.fbs";
+  auto root_path = test_data_path + "include_cache_root.fbs";
+  std::string root = "include \"include_cache_inc.fbs\"; table R { i:Inc; }";
+  TEST_EQ(flatbuffers::SaveFile(inc_path.c_str(), "table Inc { a:int; }",
+                                false),
+          true);
+  TEST_EQ(flatbuffers::SaveFile(root_path.c_str(), root, false), true);
+  flatbuffers::Parser disk_parser;
+  TEST_EQ(disk_parser.Parse(root.c_str(), nullptr, root_path.c_str()), true);
+  inc = disk_parser.LookupStruct("Inc");
+  TEST_EQ(disk_parser.Parse(root.c_str(), nullptr, root_path.c_str()), true);
+  TEST_EQ(disk_parser.LookupStruct("Inc") == inc, true);
+  TEST_EQ(flatbuffers::SaveFile(inc_path.c_str(),
+                                "table Inc { a:int; b:int; }", false),
+          true);
+  TEST_EQ(disk_parser.Parse(root.c_str(), nullptr, root_path.c_str()), true);
+  TEST_NOTNULL(disk_parser.LookupStruct("Inc")->fields.Lookup("b"));
+  std::remove(inc_path.c_str());
+  std::remove(root_path.c_str());
+}
+
+// What a flatc run with FlatcJsonOutput enabled reported and generated.
+static std::vector<std::string> flatc_errors;
+static std::map<std::string, std::string> flatc_outputs;
+
+static bool FlatcJsonOutput(const flatbuffers::Parser &parser,
+                            const std::string &path,
+                            const std::string &file_name) {
+  (void)path;
+  if (!parser.builder_.GetSize()) return true;  // A schema.
+  // Entries exist before the run, so that parallel jobs only write to them.
+  auto it = flatc_outputs.find(file_name);
+  return it != flatc_outputs.end() &&
+         GenerateText(parser, parser.builder_.GetBufferPointer(),
+                      &it->second);
+}
+
+static void FlatcError(const flatbuffers::FlatCompiler *flatc,
+                       const std::string &err, bool usage, bool show_exe_name) {
+  (void)flatc;
+  (void)usage;
+  (void)show_exe_name;
+  flatc_errors.push_back(err);
+}
+
+static void FlatcWarn(const flatbuffers::FlatCompiler *flatc,
+                      const std::string &warn, bool show_exe_name) {
+  (void)flatc;
+  (void)warn;
+  (void)show_exe_name;
+}
+
+// Converts the JSON files with flatc, and returns the outputs by file.
+static std::map<std::string, std::string> FlatcConvertJson(
+    const std::vector<std::string> &json_files, const char *jobs) {
+  const flatbuffers::FlatCompiler::Generator generators[] = {
+    { FlatcJsonOutput, nullptr, "--test-json", "JSON", false, nullptr,
+      flatbuffers::IDLOptions::kJson, "Test output", nullptr },
+  };
+  flatbuffers::FlatCompiler::InitParams params;
+  params.generators = generators;
+  params.num_generators = 1;
+  params.warn_fn = FlatcWarn;
+  params.error_fn = FlatcError;
+  flatbuffers::FlatCompiler flatc(params);
+  std::vector<const char *> argv;
+  argv.push_back("--test-json");
+  argv.push_back("--jobs");
+  argv.push_back(jobs);
+  argv.push_back("jobs.fbs");
+  flatc_outputs.clear();
+  flatc_errors.clear();
+  for (auto it = json_files.begin(); it != json_files.end(); ++it) {
+    argv.push_back(it->c_str());
+    flatc_outputs[flatbuffers::StripExtension(*it)];
+  }
+  flatc.Compile(static_cast<int>(argv.size()), argv.data());
+  return flatc_outputs;
+}
+
+// flatc --jobs converts JSON files to the same outputs as without it, and
+// reports errors in the same order.
+void FlatcJobsTest() {
+  auto load_file = flatbuffers::SetLoadFileFunction(MemoryLoadFile);
+  auto file_exists = flatbuffers::SetFileExistsFunction(MemoryFileExists);
+  memory_files["jobs.fbs"] = "table T { a:int; s:string; } root_type T;";
+  std::vector<std::string> json_files;
+  for (int i = 0; i < 20; i++) {
+    auto name = "in" + flatbuffers::NumToString(i) + ".json";
+    memory_files[name] =
+        "{ a: " + flatbuffers::NumToString(i * 7) + ", s: \"" + name + "\" }";
+    json_files.push_back(name);
+  }
+  auto serial = FlatcConvertJson(json_files, "1");
+  TEST_EQ(flatc_errors.empty(), true);
+  TEST_EQ(serial.size(), json_files.size());
+  TEST_EQ_STR(serial["in3"].c_str(), "{\n  a: 21,\n  s: \"in3.json\"\n}\n");
+  auto parallel = FlatcConvertJson(json_files, "4");
+  TEST_EQ(flatc_errors.empty(), true);
+  TEST_EQ(parallel == serial, true);
+
+  // The first error is the same as that of a serial run, which stops there.
+  // The files before it are all converted, and the jobs stop taking new ones
+  // after it, so that the later files are left alone unless already started.
+  memory_files["in5.json"] = "{ a: 1, b: 2 }";
+  memory_files["in12.json"] = "{ a: }";
+  FlatcConvertJson(json_files, "1");
+  TEST_EQ(flatc_errors.empty(), false);
+  auto first_error = flatc_errors.front();
+  TEST_NOTNULL(strstr(first_error.c_str(), "in5.json"));
+  parallel = FlatcConvertJson(json_files, "4");
+  TEST_EQ(flatc_errors.empty(), false);
+  TEST_EQ(flatc_errors.size() <= 2, true);
+  TEST_EQ_STR(flatc_errors[0].c_str(), first_error.c_str());
+  for (int i = 0; i < 5; i++) {
+    auto name = "in" + flatbuffers::NumToString(i);
+    TEST_EQ_STR(parallel[name].c_str(), serial[name].c_str());
+  }
+
+  flatbuffers::SetLoadFileFunction(load_file);
+  flatbuffers::SetFileExistsFunction(file_exists);
+  memory_files.clear();
+}
+
 void ParseProtoBufAsciiTest() {
   // We can put the parser in a mode where it will accept JSON that looks more
   // like Protobuf ASCII, for users that have data in that format.
@@ -3512,6 +4650,90 @@ void NativeTypeTest() {
   }
 }
 
+void ArenaUnPackTest() {
+  // A tree with many sub-tables, each with strings and vectors, that would
+  // take thousands of heap allocations to unpack.
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Scene::Node>> children;
+  for (int i = 0; i < 1000; i++) {
+    const Scene::Point path[] = { Scene::Point(1.0f * i, 2.0f),
+                                  Scene::Point(3.0f, 4.0f * i) };
+    std::vector<std::string> tags;
+    tags.push_back("a tag that is too long for small string optimization");
+    tags.push_back(flatbuffers::NumToString(i));
+    const int64_t values[] = { i, -i, 1LL << 40 };
+    const uint8_t flags[] = { 1, 0, static_cast<uint8_t>(i % 2) };
+    const Scene::Point pos(0.5f, 1.0f * i);
+    auto name = fbb.CreateString("node number " + flatbuffers::NumToString(i));
+    children.push_back(Scene::CreateNode(
+        fbb, name, &pos, fbb.CreateVectorOfStrings(tags),
+        fbb.CreateVectorOfStructs(path, 2), fbb.CreateVector(values, 3),
+        fbb.CreateVector(flags, 3)));
+  }
+  auto leaf = Scene::CreateNode(fbb, fbb.CreateString("leaf"));
+  fbb.Finish(Scene::CreateNode(fbb, fbb.CreateString("root"), nullptr, 0, 0,
+                               0, 0, fbb.CreateVector(children),
+                               Scene::Payload_Node, leaf.Union()));
+  auto root = Scene::GetNode(fbb.GetBufferPointer());
+
+  // Unpacking into an arena uses a handful of blocks, and packs to the same
+  // buffer as unpacking from the heap.
+  flatbuffers::Arena arena;
+  {
+    flatbuffers::unique_ptr<Scene::NodeT> heap_node(root->UnPack());
+    flatbuffers::unique_ptr<Scene::NodeT> arena_node(root->UnPack(arena));
+    TEST_EQ(flatbuffers::Arena::Current() == nullptr, true);
+    TEST_EQ(arena.num_blocks() > 0, true);
+    TEST_EQ(arena.num_blocks() <= 12, true);
+    TEST_EQ(arena_node->children.size(), 1000U);
+    TEST_EQ_STR(arena_node->children[999]->name.c_str(), "node number 999");
+    TEST_EQ_STR(arena_node->payload.AsNode()->name.c_str(), "leaf");
+
+    flatbuffers::FlatBufferBuilder heap_fbb, arena_fbb;
+    heap_fbb.Finish(Scene::Node::Pack(heap_fbb, heap_node.get()));
+    arena_fbb.Finish(Scene::Node::Pack(arena_fbb, arena_node.get()));
+    TEST_EQ(heap_fbb.GetSize(), arena_fbb.GetSize());
+    TEST_EQ(memcmp(heap_fbb.GetBufferPointer(), arena_fbb.GetBufferPointer(),
+                   heap_fbb.GetSize()),
+            0);
+
+    // Outside of a scope, the same objects grow from the heap.
+    const auto arena_size = arena.size();
+    arena_node->children.resize(2000);
+    arena_node->children[1999].reset(new Scene::NodeT());
+    arena_node->children[1999]->name = "a name on the heap, not the arena";
+    TEST_EQ(arena.size(), arena_size);
+
+    // Unpacking again into the same object reuses all of its storage.
+    arena_node->children.resize(1000);
+    root->UnPackTo(arena_node.get(), arena);
+    root->UnPackTo(arena_node.get(), arena);
+    TEST_EQ(arena_node->children.size(), 1000U);
+    TEST_EQ(arena.size(), arena_size);
+  }
+  arena.Reset();
+  TEST_EQ(arena.num_blocks(), 0U);
+
+  // Objects of any size are aligned enough for any force_align, in the arena
+  // as well as on the heap.
+  for (size_t size = 1; size < 100; size += 7) {
+    void *heap_object = flatbuffers::Arena::AllocateObject(size);
+    void *arena_object;
+    {
+      flatbuffers::ArenaScope scope(arena);
+      arena_object = flatbuffers::Arena::AllocateObject(size);
+    }
+    TEST_EQ(reinterpret_cast<uintptr_t>(heap_object) %
+                FLATBUFFERS_MAX_ALIGNMENT,
+            0U);
+    TEST_EQ(reinterpret_cast<uintptr_t>(arena_object) %
+                FLATBUFFERS_MAX_ALIGNMENT,
+            0U);
+    flatbuffers::Arena::DeallocateObject(heap_object);
+    flatbuffers::Arena::DeallocateObject(arena_object);
+  }
+}
+
 void FixedLengthArrayJsonTest(bool binary) {
   // VS10 does not support typed enums, exclude from tests
 #if !defined(_MSC_VER) || _MSC_VER >= 1700
@@ -3726,6 +4948,51 @@ void OptionalScalarsTest() {
   TEST_EQ(opts->maybe_i32().value(), -1);
   TEST_EQ(opts->maybe_enum().value(), optional_scalars::OptionalByte_Two);
   TEST_ASSERT(opts->maybe_i32() == flatbuffers::Optional<int64_t>(-1));
+
+  // A static layout stores every optional scalar, so a table with a null one
+  // is left to the regular builder.
+  for (int present = 0; present < 2; present++) {
+    flatbuffers::Optional<int8_t> maybe_i8;
+    if (present) maybe_i8 = 5;
+    fbb.Clear();
+    FinishScalarStuffBuffer(
+        fbb, optional_scalars::CreateScalarStuffStaticLayout(
+                 fbb, 1, maybe_i8, 42, 1, 2, 42, 1, 2, 42, 1, 2, 42, 1, 2, 42,
+                 1, 2, 42, 1, 2, 42, 1, 2, 42, 1.0f, 2.0f, 42.0f, 1.0, 2.0,
+                 42.0, true, false, true, optional_scalars::OptionalByte_One,
+                 optional_scalars::OptionalByte_Two,
+                 optional_scalars::OptionalByte_One));
+    opts = optional_scalars::GetMutableScalarStuff(fbb.GetBufferPointer());
+    TEST_EQ(opts->maybe_i8().has_value(), present != 0);
+    if (present) TEST_EQ(opts->maybe_i8().value(), 5);
+    TEST_EQ(opts->maybe_i16().value(), 2);
+    TEST_EQ(opts->maybe_bool().value(), false);
+    TEST_EQ(opts->maybe_enum().value(), optional_scalars::OptionalByte_Two);
+    TEST_EQ(opts->default_f64(), 42.0);
+  }
+}
+
+void OptionalScalarsJsonTest() {
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table T { a:int = null; b:double = null; "
+                       "c:bool = null; d:int = 5; }"
+                       "root_type T;"),
+          true);
+  // A value equal to the type's zero is still stored, null leaves the field
+  // out.
+  TEST_EQ(parser.ParseJson("{ a: 0, b: null, c: false }"), true);
+  auto root = flatbuffers::GetRoot<flatbuffers::Table>(
+      parser.builder_.GetBufferPointer());
+  TEST_EQ(root->CheckField(4), true);
+  TEST_EQ(root->CheckField(6), false);
+  TEST_EQ(root->CheckField(8), true);
+  TEST_EQ(root->CheckField(10), false);
+
+  // Only the fields that are present are printed.
+  std::string jsongen;
+  TEST_EQ(GenerateText(parser, parser.builder_.GetBufferPointer(), &jsongen),
+          true);
+  TEST_EQ_STR(jsongen.c_str(), "{\n  a: 0,\n  c: false\n}\n");
 }
 
 void ParseFlexbuffersFromJsonWithNullTest() {
@@ -3801,10 +5068,16 @@ int FlatBufferTests() {
   MutateFlatBuffersTest(flatbuf.data(), flatbuf.size());
 
   ObjectFlatBuffersTest(flatbuf.data());
+  UnPackToReuseTest(flatbuf.data());
+  PartialUnPackTest(flatbuf.data());
+  PrefetchFilterTest(flatbuf.data());
+  HashTest(flatbuf.data());
 
   MiniReflectFlatBuffersTest(flatbuf.data());
   MiniReflectFixedLengthArrayTest();
 
+  SortedVectorTest();
+  StaticLayoutTest();
   SizePrefixedTest();
 
   #ifndef FLATBUFFERS_NO_FILE_TESTS
@@ -3817,6 +5090,8 @@ int FlatBufferTests() {
     FixedLengthArrayJsonTest(false);
     FixedLengthArrayJsonTest(true);
     ReflectionTest(flatbuf.data(), flatbuf.size());
+    ResizeBatchTest(flatbuf.data(), flatbuf.size());
+    DiffPatchTest(flatbuf.data());
     ParseProtoTest();
     ParseProtoTestWithSuffix();
     ParseProtoTestWithIncludes();
@@ -3825,6 +5100,9 @@ int FlatBufferTests() {
     UnionVectorTest();
     LoadVerifyBinaryTest();
     GenerateTableTextTest();
+    SharedSchemaParserTest();
+    GeneratedJsonPrinterTest();
+    GeneratedJsonParserTest();
     TestEmbeddedBinarySchema();
   #endif
   // clang-format on
@@ -3841,6 +5119,8 @@ int FlatBufferTests() {
   IntegerOutOfRangeTest();
   IntegerBoundaryTest();
   UnicodeTest();
+  StringTokenTest();
+  GenerateTextSinkTest();
   UnicodeTestAllowNonUTF8();
   UnicodeTestGenerateTextFailsOnNonUTF8();
   UnicodeSurrogatesTest();
@@ -3850,12 +5130,15 @@ int FlatBufferTests() {
   ParseUnionTest();
   InvalidNestedFlatbufferTest();
   ConformTest();
+  IncludeCacheTest();
+  FlatcJobsTest();
   ParseProtoBufAsciiTest();
   TypeAliasesTest();
   EndianSwapTest();
   CreateSharedStringTest();
   JsonDefaultTest();
   JsonEnumsTest();
+  JsonDirectScalarTablesTest();
   FlexBuffersTest();
   FlexBuffersDeprecatedTest();
   UninitializedVectorTest();
@@ -3867,7 +5150,9 @@ int FlatBufferTests() {
   TestMonsterExtraFloats();
   FixedLengthArrayTest();
   NativeTypeTest();
+  ArenaUnPackTest();
   OptionalScalarsTest();
+  OptionalScalarsJsonTest();
   ParseFlexbuffersFromJsonWithNullTest();
   FlatbuffersSpanTest();
   FixedLengthArrayConstructorTest();
@@ -98,6 +98,7 @@ struct CharacterUnion {
   void Reset();
 
   static void *UnPack(const void *obj, Character type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, Character _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
 
   AttackerT *AsMuLan() {
@@ -525,10 +526,8 @@ inline MovieT *Movie::UnPack(const flatbuffers::resolver_function_t *_resolver)
 inline void Movie::UnPackTo(MovieT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = main_character_type(); _o->main_character.type = _e; }
-  { auto _e = main_character(); if (_e) _o->main_character.value = CharacterUnion::UnPack(_e, main_character_type(), _resolver); }
-  { auto _e = characters_type(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].type = static_cast<Character>(_e->Get(_i)); } } }
-  { auto _e = characters(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].value = CharacterUnion::UnPack(_e->Get(_i), characters_type()->GetEnum<Character>(_i), _resolver); } } }
+  { auto _e = main_character(); if (_e) _o->main_character.UnPackTo(_e, main_character_type(), _resolver); else _o->main_character.Reset(); }
+  { auto _e = characters(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].UnPackTo(_e->Get(_i), characters_type()->GetEnum<Character>(_i), _resolver); } } else _o->characters.clear(); }
 }
 
 inline flatbuffers::Offset<Movie> Movie::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MovieT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -623,6 +622,53 @@ inline void *CharacterUnion::UnPack(const void *obj, Character type, const flatb
   }
 }
 
+inline void CharacterUnion::UnPackTo(const void *obj, Character _type, const flatbuffers::resolver_function_t *resolver) {
+  if (type == _type && value) {
+    switch (_type) {
+      case Character_MuLan: {
+        auto ptr = reinterpret_cast<const Attacker *>(obj);
+        auto dst = reinterpret_cast<AttackerT *>(value);
+        ptr->UnPackTo(dst, resolver);
+        return;
+      }
+      case Character_Rapunzel: {
+        auto ptr = reinterpret_cast<const Rapunzel *>(obj);
+        auto dst = reinterpret_cast<Rapunzel *>(value);
+        *dst = *ptr;
+        return;
+      }
+      case Character_Belle: {
+        auto ptr = reinterpret_cast<const BookReader *>(obj);
+        auto dst = reinterpret_cast<BookReader *>(value);
+        *dst = *ptr;
+        return;
+      }
+      case Character_BookFan: {
+        auto ptr = reinterpret_cast<const BookReader *>(obj);
+        auto dst = reinterpret_cast<BookReader *>(value);
+        *dst = *ptr;
+        return;
+      }
+      case Character_Other: {
+        auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+        auto dst = reinterpret_cast<std::string *>(value);
+        dst->assign(ptr->c_str(), ptr->size());
+        return;
+      }
+      case Character_Unused: {
+        auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+        auto dst = reinterpret_cast<std::string *>(value);
+        dst->assign(ptr->c_str(), ptr->size());
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  value = UnPack(obj, _type, resolver);
+  type = _type;
+}
+
 inline flatbuffers::Offset<void> CharacterUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Character_MuLan: {